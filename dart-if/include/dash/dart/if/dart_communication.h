@@ -714,6 +714,39 @@ dart_ret_t dart_testall(
 dart_ret_t dart_handle_free(
   dart_handle_t * handle) DART_NOTHROW;
 
+/**
+ * 'HANDLE' variant of dart_allreduce.
+ * The reduction is started but completion is not guaranteed. A later
+ * \c dart_wait_local or successful \c dart_test_local on the handle is
+ * required before the buffers \c sendbuf and \c recvbuf may be accessed.
+ * All units in \c team have to start the reduction in the same order
+ * as other collective operations on \c team.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from
+ *                each unit.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to
+ *                use in \c op.
+ * \param op      The reduction operation to perform.
+ * \param team    The team to participate in the allreduce.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                with \c dart_wait_local, \c dart_test_local etc.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_allreduce_handle(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handle) DART_NOTHROW;
+
 /** \} */
 
 /**
@@ -160,6 +160,27 @@ dart_ret_t dart_gptr_getaddr(
   const dart_gptr_t    gptr,
         void        ** addr) DART_NOTHROW;
 
+/**
+ * Get the memory address for the specified global pointer gptr in the
+ * address space of the calling unit. In addition to the local memory
+ * elements returned by \ref dart_gptr_getaddr, this includes elements of
+ * units on the same node that are accessible through a shared-memory
+ * window of the segment.
+ *
+ * \param      gptr Global pointer
+ * \param[out] addr Pointer to a pointer that will hold the address if the
+ *                  memory element referenced by \c gptr is directly
+ *                  accessible by the calling unit, or \c NULL otherwise.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartGlobMem
+ */
+dart_ret_t dart_gptr_getaddr_shared(
+  const dart_gptr_t    gptr,
+        void        ** addr) DART_NOTHROW;
+
 /**
  * Set the local memory address for the specified global pointer such
  * the the specified address.
@@ -2213,6 +2213,57 @@ dart_ret_t dart_allreduce(
   return DART_OK;
 }
 
+dart_ret_t dart_allreduce_handle(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handleptr)
+{
+  *handleptr = DART_HANDLE_NULL;
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_allreduce_handle ! failed: nelem (%zu) > INT_MAX",
+                   nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_allreduce_handle ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+  MPI_Comm comm = team_data->comm;
+
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->dest         = DART_UNDEFINED_UNIT_ID;
+  handle->win          = MPI_WIN_NULL;
+  handle->needs_flush  = false;
+  handle->num_reqs     = 1;
+  CHECK_MPI_RET(
+    MPI_Iallreduce(
+           sendbuf,   // send buffer
+           recvbuf,   // receive buffer
+           nelem,     // buffer size
+           mpi_dtype, // datatype
+           mpi_op,    // reduce operation
+           comm,
+           &handle->reqs[0]),
+    "MPI_Iallreduce");
+  *handleptr = handle;
+  return DART_OK;
+}
+
 dart_ret_t dart_alltoall(
     const void *    sendbuf,
     void *          recvbuf,
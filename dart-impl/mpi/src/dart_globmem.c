@@ -72,6 +72,44 @@ dart_ret_t dart_gptr_getaddr(const dart_gptr_t gptr, void **addr)
   return DART_OK;
 }
 
+dart_ret_t dart_gptr_getaddr_shared(const dart_gptr_t gptr, void **addr)
+{
+  *addr = NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(gptr.teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown team %i", gptr.teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (team_data->unitid == gptr.unitid) {
+    return dart_gptr_getaddr(gptr, addr);
+  }
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  int16_t segid = gptr.segid;
+  if (segid <= DART_SEGMENT_LOCAL || gptr.unitid < 0 ||
+      gptr.unitid >= team_data->size) {
+    return DART_OK;
+  }
+  dart_team_unit_t luid = team_data->sharedmem_tab[gptr.unitid];
+  if (luid.id < 0) {
+    // unit is not located in the shared memory domain
+    return DART_OK;
+  }
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+                                   &(team_data->segdata), segid);
+  if (seginfo == NULL) {
+    DART_LOG_ERROR("dart_gptr_getaddr_shared ! Unknown segment %i", segid);
+    return DART_ERR_INVAL;
+  }
+  if (seginfo->baseptr != NULL && seginfo->baseptr[luid.id] != NULL) {
+    *addr = seginfo->baseptr[luid.id] + gptr.addr_or_offs.offset;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return DART_OK;
+}
+
 dart_ret_t dart_gptr_setaddr(dart_gptr_t* gptr, void* addr)
 {
   int16_t segid = gptr->segid;
@@ -647,7 +685,10 @@ dart_team_memregister_aligned(
 
   MPI_Comm comm = team_data->comm;
   MPI_Win win = team_data->window;
-  MPI_Win_attach(win, addr, nbytes);
+  /* Calling MPI_Win_attach with nbytes == 0 leads to errors, see #239 */
+  if (nbytes > 0) {
+    MPI_Win_attach(win, addr, nbytes);
+  }
   MPI_Get_address(addr, &disp);
   MPI_Allgather(&disp, 1, MPI_AINT, disp_set, 1, MPI_AINT, comm);
 
@@ -721,7 +762,10 @@ dart_team_memregister(
   MPI_Aint * disp_set = segment->disp;
   MPI_Comm   comm     = team_data->comm;
   MPI_Win    win      = team_data->window;
-  MPI_Win_attach(win, addr, nbytes);
+  /* Calling MPI_Win_attach with nbytes == 0 leads to errors, see #239 */
+  if (nbytes > 0) {
+    MPI_Win_attach(win, addr, nbytes);
+  }
   MPI_Get_address(addr, &disp);
   MPI_Allgather(&disp, 1, MPI_AINT, disp_set, 1, MPI_AINT, comm);
 
@@ -778,7 +822,17 @@ dart_team_memderegister(
     return DART_ERR_INVAL;
   }
 
-  MPI_Win_detach(win, sub_mem);
+  size_t nbytes;
+  if (dart_segment_get_size(
+        &team_data->segdata, segid, &nbytes) != DART_OK) {
+    DART_LOG_ERROR("dart_team_memderegister ! Unknown segment %i", segid);
+    return DART_ERR_INVAL;
+  }
+
+  /* Empty segments have not been attached in dart_team_memregister */
+  if (nbytes > 0) {
+    MPI_Win_detach(win, sub_mem);
+  }
   if (dart_segment_free(&team_data->segdata, segid) != DART_OK) {
     return DART_ERR_INVAL;
   }
@@ -28,11 +28,12 @@ void jacobi_global(const dash::Array<T>& v1,
 		   dash::Array<T>& v2);
 
 
-// jacobi iteration using local access
+// jacobi iteration using local access and ghost exchange
 // read from 'v1', write to 'v2'
 template<typename T>
 void jacobi_local(const dash::Array<T>& v1,
-		  dash::Array<T>& v2);
+		  dash::Array<T>& v2,
+		  dash::halo::GhostExchange<dash::Array<T>>& ghosts_v1);
 
 template<typename T>
 double test_global(dash::Array<T>& v1, dash::Array<T>& v2, size_t steps);
@@ -131,10 +132,14 @@ double test_local(dash::Array<T>& v1,
 {
   double tstart, tstop;
 
+  // one ghost element on each side of the local block
+  dash::halo::GhostExchange<dash::Array<T>> ghosts_v1(v1, 1);
+  dash::halo::GhostExchange<dash::Array<T>> ghosts_v2(v2, 1);
+
   TIMESTAMP(tstart);
   for( int i=0; i<steps; i++ ) {
-    jacobi_local(v1, v2);
-    jacobi_local(v2, v1);
+    jacobi_local(v1, v2, ghosts_v1);
+    jacobi_local(v2, v1, ghosts_v2);
     dash::barrier();
   }
   TIMESTAMP(tstop);
@@ -163,7 +168,8 @@ double test_global(dash::Array<T>& v1,
 
 template<typename T>
 void jacobi_local(const dash::Array<T>& v1,
-		  dash::Array<T>& v2)
+		  dash::Array<T>& v2,
+		  dash::halo::GhostExchange<dash::Array<T>>& ghosts_v1)
 {
   auto myid = dash::myid();
   auto size = dash::size();
@@ -185,10 +191,8 @@ void jacobi_local(const dash::Array<T>& v1,
   if( myid==0 )      ++first;
   if( myid==size-1 ) --last;
 
-  // TODO: use .async[]
-  // get my left and right neighbor's values that I need for my updates
-  auto left  = v1[pat.global(first)-1];
-  auto right = v1[pat.global(last)+1];
+  // fetch my left and right neighbor's values that I need for my updates
+  ghosts_v1.update_async();
 
   // do the stencil update v2<-v1 for the interior points
   for( auto i=first+1; i<last; ++i )
@@ -199,6 +203,13 @@ void jacobi_local(const dash::Array<T>& v1,
 	0.25 * v1.local[i+1];
     }
 
+  ghosts_v1.wait();
+  // at the global border the neighbor value is a local element
+  auto left_ghost  = ghosts_v1.ghost_at(pat.global(first)-1);
+  auto right_ghost = ghosts_v1.ghost_at(pat.global(last)+1);
+  T left  = left_ghost  ? *left_ghost  : v1.local[first-1];
+  T right = right_ghost ? *right_ghost : v1.local[last+1];
+
   // do the remaining left update
   v2.local[first] =
     0.25*left + 0.50*v1.local[first] + 0.25*v1.local[first+1];
@@ -104,6 +104,7 @@ typedef struct benchmark_params_t {
   extent_t    units_y;
   extent_t    units_inc;
   extent_t    threads;
+  extent_t    layers;
   float       cpu_gflops_peak;
   bool        mkl_dyn;
   bool        verify;
@@ -123,6 +124,14 @@ std::pair<double, double> test_dash(
   const benchmark_params & params,
   const PatternType      & pattern);
 
+template<class PatternType>
+std::pair<double, double> test_dash_25d(
+  extent_t                 n,
+  unsigned                 repeat,
+  extent_t                 layers,
+  const benchmark_params & params,
+  const PatternType      & pattern);
+
 void init_values(
   value_t                * matrix_a,
   value_t                * matrix_b,
@@ -135,6 +144,11 @@ std::pair<double, double> test_blas(
   unsigned                 repeat,
   const benchmark_params & params);
 
+std::pair<double, double> test_gemm(
+  extent_t                 sb,
+  unsigned                 repeat,
+  const benchmark_params & params);
+
 std::pair<double, double> test_plasma(
   extent_t                 sb,
   unsigned                 repeat,
@@ -315,6 +329,14 @@ void perform_test(
                                       dash::TILE(tilesize));
   pattern_t pattern(size_spec, dist_spec, team_spec);
 #endif
+  extent_t layers = params.layers;
+  if (variant == "dash25d") {
+    if (layers == 0) {
+      layers = dash::internal::summa_25d_num_layers<value_t>(
+                 pattern, pattern, dash::Team::All());
+    }
+    variant_id = variant + ".c" + std::to_string(layers);
+  }
 
   if (params.tilesize_base > 0) {
     if (params.tilesize_fixed) {
@@ -404,10 +426,14 @@ void perform_test(
   std::pair<double, double> t_mmult;
   if (variant == "mkl" || variant == "blas") {
     t_mmult = test_blas(n, num_repeats, params);
+  } else if (variant == "gemm") {
+    t_mmult = test_gemm(n, num_repeats, params);
   } else if (variant == "plasma") {
     t_mmult = test_plasma(n, num_repeats, params, tilesize);
   } else if (variant == "pblas") {
     t_mmult = test_pblas(n, num_repeats, params);
+  } else if (variant == "dash25d") {
+    t_mmult = test_dash_25d(n, num_repeats, layers, params, pattern);
   } else {
     t_mmult = test_dash(n, num_repeats, params, pattern);
   }
@@ -569,6 +595,53 @@ std::pair<double, double> test_dash(
   return time;
 }
 
+/**
+ * Returns pair of durations (init_secs, multiply_secs) of the 2.5D
+ * variant of SUMMA with the given number of layers.
+ *
+ */
+template<class PatternType>
+std::pair<double, double> test_dash_25d(
+  extent_t                  n,
+  unsigned                  repeat,
+  extent_t                  layers,
+  const benchmark_params  & params,
+  const PatternType       & pattern)
+{
+  std::pair<double, double> time;
+
+  dash::Matrix<value_t, 2, index_t, PatternType> matrix_a(pattern);
+  dash::Matrix<value_t, 2, index_t, PatternType> matrix_b(pattern);
+  dash::Matrix<value_t, 2, index_t, PatternType> matrix_c(pattern);
+
+  dash::barrier();
+
+  auto ts_init_start = Timer::Now();
+  init_values(matrix_a, matrix_b, matrix_c, params);
+  time.first = Timer::ElapsedSince(ts_init_start);
+
+  dash::barrier();
+
+  auto ts_multiply_start = Timer::Now();
+  dash::util::TraceStore::off();
+  for (unsigned i = 0; i < repeat; ++i) {
+    if (i == 0) {
+      dash::util::TraceStore::on();
+    }
+
+    dash::summa_25d(matrix_a, matrix_b, matrix_c, layers);
+
+    if (i == 0) {
+      dash::util::TraceStore::off();
+    }
+  }
+  time.second = Timer::ElapsedSince(ts_multiply_start);
+
+  dash::barrier();
+
+  return time;
+}
+
 void init_values(
   value_t  * matrix_a,
   value_t  * matrix_b,
@@ -681,6 +754,47 @@ std::pair<double, double> test_blas(
 #endif
 }
 
+/**
+ * Returns pair of durations (init_secs, multiply_secs) of the built-in
+ * GEMM kernel used by dash::summa if neither MKL nor BLAS is available.
+ *
+ */
+std::pair<double, double> test_gemm(
+  extent_t sb,
+  unsigned repeat,
+  const benchmark_params & params)
+{
+  std::pair<double, double> time;
+
+  if (dash::size() != 1) {
+    time.first  = 0;
+    time.second = 0;
+    return time;
+  }
+
+  std::vector<value_t> l_matrix_a(sb * sb);
+  std::vector<value_t> l_matrix_b(sb * sb);
+  std::vector<value_t> l_matrix_c(sb * sb);
+
+  auto ts_init_start = Timer::Now();
+  init_values(l_matrix_a.data(), l_matrix_b.data(), l_matrix_c.data(),
+              sb, params);
+  time.first = Timer::ElapsedSince(ts_init_start);
+
+  auto ts_multiply_start = Timer::Now();
+  for (unsigned i = 0; i < repeat; ++i) {
+    dash::internal::gemm_local(
+      l_matrix_a.data(),
+      l_matrix_b.data(),
+      l_matrix_c.data(),
+      sb, sb, sb,
+      dash::ROW_MAJOR);
+  }
+  time.second = Timer::ElapsedSince(ts_multiply_start);
+
+  return time;
+}
+
 /**
  * Returns pair of durations (init_secs, multiply_secs).
  *
@@ -1060,6 +1174,7 @@ benchmark_params parse_args(int argc, char * argv[])
   params.cpu_gflops_peak    = 41.4;
   params.mkl_dyn            = false;
   params.verify             = false;
+  params.layers             = 0;
 
   extent_t size_base        = 0;
   extent_t num_units_inc    = 0;
@@ -1097,6 +1212,8 @@ benchmark_params parse_args(int argc, char * argv[])
       params.verify   = atoi(argv[i+1]) == 1;
     } else if (flag == "-tb") {
       params.tilesize_base = static_cast<extent_t>(atoi(argv[i+1]));
+    } else if (flag == "-c") {
+      params.layers   = static_cast<extent_t>(atoi(argv[i+1]));
     } else if (flag == "-tf") {
       params.tilesize_fixed = !!(atoi(argv[i+1]));
     }
@@ -1157,6 +1274,13 @@ void print_params(
   conf.print_param("data type",                     "double");
 #else
   conf.print_param("data type",                     "float");
+#endif
+#if defined(DASH_ENABLE_MKL)
+  conf.print_param("local GEMM",                    "MKL");
+#elif defined(DASH_ENABLE_BLAS)
+  conf.print_param("local GEMM",                    "BLAS");
+#else
+  conf.print_param("local GEMM",                    "built-in");
 #endif
   conf.print_section_end();
 
@@ -1171,6 +1295,7 @@ void print_params(
   conf.print_param("-rmax",   "rep. max",           params.rep_max);
   conf.print_param("-rbase",  "rep. base",          params.rep_base);
   conf.print_param("-nt",     "threads/proc",       params.threads);
+  conf.print_param("-c",      "2.5D layers",        params.layers);
   conf.print_param("-mkldyn", "MKL dynamic",        params.mkl_dyn);
   conf.print_param("-verify", "run test iteration", params.verify);
   conf.print_param("-ninc",   "units inc.",         params.units_inc);
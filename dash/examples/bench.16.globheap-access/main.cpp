@@ -0,0 +1,128 @@
+/**
+ * Measures the cost of random access in global dynamic memory
+ * (dash::GlobHeapMem) depending on the number of local buckets.
+ *
+ * Resolving a global index to unit, bucket and bucket offset uses binary
+ * search on the cumulative unit and bucket sizes, so the time per access
+ * should only grow logarithmically with the number of buckets.
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef int value_t;
+
+void print_header();
+
+void perform_test(size_t nlocal, size_t nbuckets, size_t naccess);
+
+int main(int argc, char ** argv)
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  size_t nlocal       = 1 << 16;
+  size_t naccess      = 10000;
+  // MPI implementations limit the number of memory regions attached to a
+  // dynamic window (e.g. MCA parameter osc_rdma_max_attach in OpenMPI):
+  size_t max_nbuckets = 64;
+  if (argc > 1) {
+    nlocal       = static_cast<size_t>(atol(argv[1]));
+  }
+  if (argc > 2) {
+    naccess      = static_cast<size_t>(atol(argv[2]));
+  }
+  if (argc > 3) {
+    max_nbuckets = static_cast<size_t>(atol(argv[3]));
+  }
+
+  print_header();
+
+  for (size_t nbuckets = 1; nbuckets <= max_nbuckets && nbuckets <= nlocal;
+       nbuckets *= 2) {
+    perform_test(nlocal, nbuckets, naccess);
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void print_header()
+{
+  if (dash::myid() == 0) {
+    cout << setw(8)  << "NUNITS; ";
+    cout << setw(10) << "NLOCAL; ";
+    cout << setw(10) << "NBUCKETS; ";
+    cout << setw(10) << "NACCESS; ";
+    cout << setw(16) << "resolve [us/op]; ";
+    cout << setw(16) << "get [us/op]";
+    cout << endl;
+  }
+}
+
+void perform_test(size_t nlocal, size_t nbuckets, size_t naccess)
+{
+  auto myid   = dash::myid();
+  auto nunits = dash::size();
+
+  dash::GlobHeapMem<value_t> gdmem(0);
+
+  // Allocate local memory space in nbuckets buckets of equal size:
+  size_t bucket_size = nlocal / nbuckets;
+  for (size_t b = 0; b < nbuckets; ++b) {
+    gdmem.grow(bucket_size);
+  }
+  auto lbegin = gdmem.lbegin();
+  for (size_t li = 0; li < gdmem.local_size(); ++li) {
+    *(lbegin + li) = static_cast<value_t>(li);
+  }
+  gdmem.commit();
+
+  auto gsize = gdmem.size();
+
+  std::mt19937 rng(myid);
+  std::uniform_int_distribution<size_t> dist(0, gsize - 1);
+  std::vector<size_t> gidx(naccess);
+  for (auto & idx : gidx) {
+    idx = dist(rng);
+  }
+
+  // Index resolution only, no communication:
+  Timer::timestamp_t ts_start = Timer::Now();
+  for (size_t i = 0; i < naccess; ++i) {
+    auto gptr = gdmem.begin() + gidx[i];
+    dash__unused(gptr.dart_gptr());
+  }
+  double duration_resolve = Timer::ElapsedSince(ts_start);
+
+  // Index resolution and blocking read of the referenced element:
+  dash::barrier();
+  ts_start = Timer::Now();
+  for (size_t i = 0; i < naccess; ++i) {
+    value_t value;
+    dash::get_value(&value, gdmem.begin() + gidx[i]);
+  }
+  double duration_get = Timer::ElapsedSince(ts_start);
+  dash::barrier();
+
+  if (myid == 0) {
+    cout << setw(8)  << nunits   << ";";
+    cout << setw(10) << nlocal   << ";";
+    cout << setw(10) << nbuckets << ";";
+    cout << setw(10) << naccess  << ";";
+    cout << setw(16) << std::fixed << std::setprecision(4)
+                     << duration_resolve / naccess << ";";
+    cout << setw(16) << duration_get / naccess << endl;
+  }
+}
@@ -0,0 +1,156 @@
+/**
+ * Unbalanced Tree Search (UTS) benchmark on dash::WorkQueue.
+ *
+ * Traverses a binomial tree in which the root has b0 children and every
+ * other node has m children with probability q and no children otherwise.
+ * For q * m close to 1, the tree is highly unbalanced and its shape can
+ * only be determined by traversal, so load balance depends on work
+ * stealing.
+ * Child nodes are derived from their parent by a hash function so the tree
+ * is identical for any number of units.
+ *
+ * Usage:
+ *
+ *   bench.17.uts [-b0 <root children>] [-m <children>] [-q <probability>]
+ *                [-c <local queue capacity>]
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdint>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef struct node_t {
+  uint64_t seed;
+  int      depth;
+} node;
+
+typedef struct benchmark_params_t {
+  int    b0;
+  int    m;
+  double q;
+  size_t capacity;
+} benchmark_params;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+static inline uint64_t splitmix64(uint64_t x)
+{
+  x += 0x9e3779b97f4a7c15ULL;
+  x  = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x  = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+static inline int num_children(const node & n, const benchmark_params & p)
+{
+  if (n.depth == 0) {
+    return p.b0;
+  }
+  // Uniform random value in [0,1) from the node's seed:
+  double r = (splitmix64(n.seed) >> 11) * (1.0 / 9007199254740992.0);
+  return (r < p.q) ? p.m : 0;
+}
+
+int main(int argc, char ** argv)
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  auto params = parse_args(argc, argv);
+  auto myid   = dash::myid();
+  auto nunits = dash::size();
+
+  dash::WorkQueue<node> queue(params.capacity);
+  dash::Array<size_t>   counts(nunits);
+
+  if (myid == 0) {
+    queue.push(node { 42, 0 });
+  }
+  queue.barrier();
+
+  auto   ts_start = Timer::Now();
+  size_t lcount   = 0;
+  node   n;
+  while (queue.next(n)) {
+    ++lcount;
+    int nchildren = num_children(n, params);
+    for (int c = 0; c < nchildren; ++c) {
+      queue.push(node { splitmix64(n.seed * 31 + c + 1), n.depth + 1 });
+    }
+  }
+  double duration_s = 1.0e-6 * Timer::ElapsedSince(ts_start);
+
+  counts.local[0] = lcount;
+  counts.barrier();
+
+  if (myid == 0) {
+    size_t nnodes = 0;
+    size_t lmin   = std::numeric_limits<size_t>::max();
+    size_t lmax   = 0;
+    for (size_t u = 0; u < nunits; ++u) {
+      size_t u_count = counts[u];
+      nnodes += u_count;
+      lmin    = std::min(lmin, u_count);
+      lmax    = std::max(lmax, u_count);
+    }
+    cout << setw(8)  << "NUNITS; "
+         << setw(8)  << "B0; "
+         << setw(6)  << "M; "
+         << setw(10) << "Q; "
+         << setw(12) << "NODES; "
+         << setw(12) << "MIN.LOCAL; "
+         << setw(12) << "MAX.LOCAL; "
+         << setw(12) << "TIME [s]; "
+         << setw(14) << "MNODES/s"
+         << endl;
+    cout << setw(8)  << nunits   << ";"
+         << setw(8)  << params.b0 << ";"
+         << setw(6)  << params.m  << ";"
+         << setw(10) << params.q  << ";"
+         << setw(12) << nnodes    << ";"
+         << setw(12) << lmin      << ";"
+         << setw(12) << lmax      << ";"
+         << setw(12) << std::fixed << std::setprecision(4)
+                     << duration_s << ";"
+         << setw(14) << 1.0e-6 * nnodes / duration_s
+         << endl;
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.b0       = 2000;
+  params.m        = 8;
+  params.q        = 0.124875;
+  params.capacity = 1 << 16;
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (i + 1 >= argc) {
+      break;
+    }
+    if (flag == "-b0") {
+      params.b0       = atoi(argv[i+1]);
+    } else if (flag == "-m") {
+      params.m        = atoi(argv[i+1]);
+    } else if (flag == "-q") {
+      params.q        = atof(argv[i+1]);
+    } else if (flag == "-c") {
+      params.capacity = static_cast<size_t>(atol(argv[i+1]));
+    }
+  }
+  return params;
+}
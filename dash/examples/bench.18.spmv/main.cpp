@@ -0,0 +1,163 @@
+/**
+ * Sparse matrix-vector multiplication (SpMV) on dash::SparseMatrix.
+ *
+ * Assembles the matrix of the 5-point (2-D) or 7-point (3-D) finite
+ * difference discretization of the Poisson equation on a regular grid and
+ * measures the throughput of repeated products y = A x.
+ * Grid points are numbered in row-major order, so every unit references
+ * ghost entries of x in the neighboring grid planes of adjacent units.
+ *
+ * Usage:
+ *
+ *   bench.18.spmv [-d <dimensions (2|3)>] [-n <grid points per dimension>]
+ *                 [-i <iterations>]
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef double                             value_t;
+typedef dash::SparseMatrix<value_t>        matrix_t;
+typedef matrix_t::triplet_type             triplet_t;
+
+typedef struct benchmark_params_t {
+  int    ndim;
+  long   n;
+  int    iterations;
+} benchmark_params;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void poisson_triplets(
+  const benchmark_params & params,
+  long                     row_begin,
+  long                     row_end,
+  std::vector<triplet_t> & triplets);
+
+int main(int argc, char ** argv)
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  auto params = parse_args(argc, argv);
+  auto myid   = dash::myid();
+  auto nunits = dash::size();
+
+  long nrows  = params.n * params.n * (params.ndim == 3 ? params.n : 1);
+  matrix_t A(nrows, nrows);
+
+  // Every unit generates the rows it owns:
+  std::vector<triplet_t> triplets;
+  long row_begin = A.row_offset();
+  poisson_triplets(params, row_begin, row_begin + A.local_rows(),
+                   triplets);
+
+  auto ts_start = Timer::Now();
+  A.assemble(triplets.begin(), triplets.end());
+  double duration_assemble_s = 1.0e-6 * Timer::ElapsedSince(ts_start);
+
+  matrix_t::vector_type x(A.col_pattern());
+  matrix_t::vector_type y(A.row_pattern());
+  std::fill(x.lbegin(), x.lend(), 1.0);
+
+  // Warm-up:
+  A.multiply(x, y);
+
+  ts_start = Timer::Now();
+  for (int i = 0; i < params.iterations; ++i) {
+    A.multiply(x, y);
+  }
+  double duration_s = 1.0e-6 * Timer::ElapsedSince(ts_start);
+
+  dash::Array<size_t> nghosts(nunits);
+  nghosts.local[0] = A.num_ghosts();
+  nghosts.barrier();
+
+  if (myid == 0) {
+    size_t max_ghosts = 0;
+    for (size_t u = 0; u < nunits; ++u) {
+      max_ghosts = std::max<size_t>(max_ghosts, nghosts[u]);
+    }
+    double gflops = 2.0e-9 * A.nnz() * params.iterations / duration_s;
+    cout << setw(8)  << "NUNITS; "
+         << setw(6)  << "DIM; "
+         << setw(12) << "ROWS; "
+         << setw(12) << "NNZ; "
+         << setw(12) << "MAX.GHOSTS; "
+         << setw(14) << "ASSEMBLE [s]; "
+         << setw(14) << "SPMV [ms]; "
+         << setw(10) << "GFLOP/s"
+         << endl;
+    cout << setw(8)  << nunits      << ";"
+         << setw(6)  << params.ndim << ";"
+         << setw(12) << nrows       << ";"
+         << setw(12) << A.nnz()     << ";"
+         << setw(12) << max_ghosts  << ";"
+         << setw(14) << std::fixed << std::setprecision(4)
+                     << duration_assemble_s << ";"
+         << setw(14) << 1.0e3 * duration_s / params.iterations << ";"
+         << setw(10) << gflops
+         << endl;
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+void poisson_triplets(
+  const benchmark_params & params,
+  long                     row_begin,
+  long                     row_end,
+  std::vector<triplet_t> & triplets)
+{
+  long n      = params.n;
+  long plane  = n * n;
+  value_t diag = (params.ndim == 3) ? 6.0 : 4.0;
+  for (long i = row_begin; i < row_end; ++i) {
+    long ix = i % n;
+    long iy = (i / n) % n;
+    triplets.push_back(triplet_t { i, i, diag });
+    if (ix > 0)     { triplets.push_back(triplet_t { i, i - 1, -1.0 }); }
+    if (ix < n - 1) { triplets.push_back(triplet_t { i, i + 1, -1.0 }); }
+    if (iy > 0)     { triplets.push_back(triplet_t { i, i - n, -1.0 }); }
+    if (iy < n - 1) { triplets.push_back(triplet_t { i, i + n, -1.0 }); }
+    if (params.ndim == 3) {
+      long iz = i / plane;
+      if (iz > 0)     { triplets.push_back(triplet_t { i, i - plane, -1.0 }); }
+      if (iz < n - 1) { triplets.push_back(triplet_t { i, i + plane, -1.0 }); }
+    }
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.ndim       = 2;
+  params.n          = 512;
+  params.iterations = 100;
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (i + 1 >= argc) {
+      break;
+    }
+    if (flag == "-d") {
+      params.ndim       = atoi(argv[i+1]);
+    } else if (flag == "-n") {
+      params.n          = atol(argv[i+1]);
+    } else if (flag == "-i") {
+      params.iterations = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
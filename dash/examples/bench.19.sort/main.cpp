@@ -0,0 +1,165 @@
+/**
+ * Measures the throughput of dash::sort and dash::radix_sort on uniformly
+ * distributed random keys.
+ *
+ * Local phases of dash::sort (local sort, splitter histograms and the
+ * final merge of received partitions) use the threads available to every
+ * unit, see dash::util::UnitLocality::num_domain_threads. The number of
+ * threads can be limited with the -t parameter which sets the DASH
+ * configuration key DASH_MAX_UNIT_THREADS.
+ *
+ * The sort algorithm is selected with the -a parameter, either "sample"
+ * for dash::sort or "radix" for dash::radix_sort. With -m inplace,
+ * dash::sort exchanges partitions in place through a staging buffer of
+ * the size given by -s, see configuration key DASH_SORT_INPLACE. The peak
+ * size of temporary buffers of dash::sort is reported per unit.
+ *
+ * Usage:
+ *
+ *   bench.19.sort [-n <local keys>] [-t <max. threads per unit>]
+ *                 [-i <iterations>] [-a sample|radix]
+ *                 [-m copy|inplace] [-s <staging size, e.g. 4M>]
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+
+using std::cout;
+using std::endl;
+using std::setw;
+
+typedef dash::util::Timer<dash::util::TimeMeasure::Clock> Timer;
+
+typedef int64_t sort_key_t;
+
+typedef struct benchmark_params_t {
+  size_t nlocal;
+  int    max_threads;
+  int    iterations;
+  std::string algorithm;
+  std::string mode;
+  std::string staging_size;
+} benchmark_params;
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+int main(int argc, char ** argv)
+{
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  auto params = parse_args(argc, argv);
+  auto myid   = dash::myid();
+  auto nunits = dash::size();
+
+  if (params.max_threads > 0) {
+    dash::util::Config::set("DASH_MAX_UNIT_THREADS", params.max_threads);
+  }
+  if (params.mode == "inplace") {
+    dash::util::Config::set("DASH_SORT_INPLACE", true);
+  }
+  if (!params.staging_size.empty()) {
+    dash::util::Config::set("DASH_SORT_STAGING_SIZE", params.staging_size);
+  }
+  int nthreads = dash::util::UnitLocality().num_domain_threads();
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+
+  dash::Array<sort_key_t> keys(params.nlocal * nunits);
+
+  std::mt19937_64 rng(myid);
+  std::uniform_int_distribution<sort_key_t> dist(
+    0, std::numeric_limits<sort_key_t>::max());
+
+  double duration_min_s = std::numeric_limits<double>::max();
+  double duration_sum_s = 0;
+  size_t peak_extra     = 0;
+  for (int i = 0; i < params.iterations; ++i) {
+    for (auto lit = keys.lbegin(); lit != keys.lend(); ++lit) {
+      *lit = dist(rng);
+    }
+    keys.barrier();
+
+    auto ts_start = Timer::Now();
+    if (params.algorithm == "radix") {
+      dash::radix_sort(keys.begin(), keys.end());
+    } else {
+      dash::sort(keys.begin(), keys.end());
+    }
+    double duration_s = 1.0e-6 * Timer::ElapsedSince(ts_start);
+
+    duration_min_s  = std::min(duration_min_s, duration_s);
+    duration_sum_s += duration_s;
+    peak_extra      = std::max(peak_extra, dash::sort_stats().peak_extra_bytes);
+  }
+
+  // largest peak size of temporary buffers of all units
+  size_t max_peak_extra = 0;
+  dart_allreduce(&peak_extra, &max_peak_extra, 1,
+                 dash::dart_datatype<size_t>::value, DART_OP_MAX,
+                 dash::Team::All().dart_id());
+
+  if (myid == 0) {
+    double nkeys = static_cast<double>(keys.size());
+    cout << setw(8)  << "NUNITS; "
+         << setw(8)  << "ALGO; "
+         << setw(10) << "MODE; "
+         << setw(10) << "THREADS; "
+         << setw(14) << "NKEYS; "
+         << setw(12) << "MIN [s]; "
+         << setw(12) << "AVG [s]; "
+         << setw(14) << "MKEYS/s; "
+         << setw(14) << "EXTRA [MB]"
+         << endl;
+    cout << setw(8)  << nunits     << ";"
+         << setw(8)  << params.algorithm << ";"
+         << setw(10) << params.mode << ";"
+         << setw(10) << nthreads   << ";"
+         << setw(14) << keys.size() << ";"
+         << setw(12) << std::fixed << std::setprecision(4)
+                     << duration_min_s << ";"
+         << setw(12) << duration_sum_s / params.iterations << ";"
+         << setw(14) << 1.0e-6 * nkeys / duration_min_s << ";"
+         << setw(14) << max_peak_extra / (1024.0 * 1024.0)
+         << endl;
+  }
+
+  dash::finalize();
+
+  return 0;
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+  params.nlocal      = 1 << 22;
+  params.max_threads = 0;
+  params.iterations  = 5;
+  params.algorithm   = "sample";
+  params.mode        = "copy";
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (i + 1 >= argc) {
+      break;
+    }
+    if (flag == "-n") {
+      params.nlocal      = static_cast<size_t>(atol(argv[i+1]));
+    } else if (flag == "-t") {
+      params.max_threads = atoi(argv[i+1]);
+    } else if (flag == "-i") {
+      params.iterations  = atoi(argv[i+1]);
+    } else if (flag == "-a") {
+      params.algorithm   = argv[i+1];
+    } else if (flag == "-m") {
+      params.mode        = argv[i+1];
+    } else if (flag == "-s") {
+      params.staging_size = argv[i+1];
+    }
+  }
+  return params;
+}
@@ -0,0 +1,214 @@
+/**
+ * Measures the performance of the out-of-place and in-place
+ * transpose of a dash::Matrix distributed in tiles
+ */
+
+#include <libdash.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#ifdef MPI_IMPL_ID
+#include <mpi.h>
+#endif
+
+using std::cout;
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+typedef dash::util::Timer<
+          dash::util::TimeMeasure::Clock
+        > Timer;
+
+typedef typename dash::util::BenchmarkParams::config_params_type
+  bench_cfg_params;
+
+using TeamSpecT = dash::TeamSpec<2>;
+using ValueT    = double;
+using PatternT  = dash::TilePattern<2>;
+using MatrixT   = dash::Matrix<ValueT, 2, dash::default_index_t, PatternT>;
+using SizeSpecT = dash::SizeSpec<2>;
+using DistSpecT = dash::DistributionSpec<2>;
+
+typedef struct benchmark_params_t {
+
+  benchmark_params_t()
+  { }
+  int    reps        = 10;
+  int    rounds      = 10;
+  size_t matrix_ext  = 2048;
+  size_t tile_ext    = 128;
+} benchmark_params;
+
+void print_measurement_header();
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  std::string              name,
+  double                   time_in_s,
+  double                   bandwidth);
+
+benchmark_params parse_args(int argc, char * argv[]);
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params);
+
+double evaluate(
+  int reps, MatrixT & src, MatrixT & dst);
+
+double evaluate_in_place(
+  int reps, MatrixT & matrix);
+
+int main(int argc, char** argv)
+{
+  dash::init(&argc, &argv);
+
+  Timer::Calibrate(0);
+
+  dash::util::BenchmarkParams bench_params("bench.20.transpose");
+  bench_params.print_header();
+  bench_params.print_pinning();
+
+  benchmark_params params = parse_args(argc, argv);
+  auto bench_cfg = bench_params.config();
+
+  size_t matrix_ext = params.matrix_ext;
+  size_t tile_ext   = params.tile_ext;
+
+  auto& team_all = dash::Team::All();
+  TeamSpecT team_all_spec(team_all.size(), 1);
+  team_all_spec.balance_extents();
+
+  auto size_spec = SizeSpecT(matrix_ext, matrix_ext);
+  auto dist_spec = DistSpecT(dash::TILE(tile_ext), dash::TILE(tile_ext));
+
+  MatrixT src(size_spec, dist_spec, team_all, team_all_spec);
+  MatrixT dst(size_spec, dist_spec, team_all, team_all_spec);
+  dash::fill(src.begin(), src.end(), 1.0);
+
+  print_params(bench_params, params);
+  print_measurement_header();
+
+  int round = 0;
+
+  // Every element is read and written once:
+  size_t matrix_size_b = 2 * src.size() * sizeof(ValueT);
+
+  while(round < params.rounds) {
+    double res;
+    res = evaluate(params.reps, src, dst);
+    print_measurement_record(bench_cfg, "transpose",
+                             res, matrix_size_b / res / 1E6);
+
+    res = evaluate_in_place(params.reps, src);
+    print_measurement_record(bench_cfg, "transpose_in_place",
+                             res, matrix_size_b / res / 1E6);
+    round++;
+  }
+
+  if (dash::myid() == 0) {
+    cout << "Benchmark finished" << endl;
+  }
+
+  dash::finalize();
+  return 0;
+}
+
+double evaluate(
+  int reps, MatrixT & src, MatrixT & dst)
+{
+  dash::barrier();
+  auto ts_tot_start = Timer::Now();
+
+  for (int i = 0; i < reps; i++) {
+    dash::transpose(src, dst);
+  }
+
+  return Timer::ElapsedSince(ts_tot_start) / (double)reps / 1E6;
+}
+
+double evaluate_in_place(
+  int reps, MatrixT & matrix)
+{
+  dash::barrier();
+  auto ts_tot_start = Timer::Now();
+
+  for (int i = 0; i < reps; i++) {
+    dash::transpose(matrix);
+  }
+
+  return Timer::ElapsedSince(ts_tot_start) / (double)reps / 1E6;
+}
+
+void print_measurement_header()
+{
+  if (dash::myid() == 0) {
+    cout << std::right
+         << std::setw( 5) << "units"      << ","
+         << std::setw( 9) << "mpi.impl"   << ","
+         << std::setw(30) << "impl"       << ","
+         << std::setw(12) << "total [s]"    << ","
+         << std::setw(20) << "bandwidth [MB/s]"
+         << endl;
+  }
+}
+
+void print_measurement_record(
+  const bench_cfg_params & cfg_params,
+  std::string              name,
+  double                   time_in_s,
+  double                   bandwidth)
+{
+  if (dash::myid() == 0) {
+    std::string mpi_impl = dash__toxstr(DASH_MPI_IMPL_ID);
+    cout << std::right
+         << std::setw(5) << dash::size() << ","
+         << std::setw(9) << mpi_impl     << ","
+         << std::fixed << setprecision(2) << setw(30) << name << ","
+         << std::fixed << setprecision(8) << setw(12) << time_in_s << ","
+         << std::fixed << setprecision(8) << setw(20) << bandwidth
+         << endl;
+  }
+}
+
+benchmark_params parse_args(int argc, char * argv[])
+{
+  benchmark_params params;
+
+  for (auto i = 1; i < argc; i += 2) {
+    std::string flag = argv[i];
+    if (flag == "-r") {
+      params.reps = atoi(argv[i+1]);
+    }
+    if (flag == "-n") {
+      params.rounds = atoi(argv[i+1]);
+    }
+    if (flag == "-t") {
+      params.tile_ext = atoi(argv[i+1]);
+    }
+    if (flag == "-s") {
+      params.matrix_ext = atoi(argv[i+1]);
+    }
+  }
+  return params;
+}
+
+void print_params(
+  const dash::util::BenchmarkParams & bench_cfg,
+  const benchmark_params            & params)
+{
+  if (dash::myid() != 0) {
+    return;
+  }
+
+  bench_cfg.print_section_start("Runtime arguments");
+  bench_cfg.print_param("-r", "repetitions per round", params.reps);
+  bench_cfg.print_param("-n", "rounds",                params.rounds);
+  bench_cfg.print_param("-s",
+                        "matrix size (number of double elements per dimension)",
+                        params.matrix_ext);
+  bench_cfg.print_param("-t",
+                        "tile size (number of double elements per dimension)",
+                        params.tile_ext);
+  bench_cfg.print_section_end();
+}
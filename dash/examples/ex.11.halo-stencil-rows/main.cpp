@@ -0,0 +1,148 @@
+/**
+ * \example ex.11.halo-stencil-rows/main.cpp
+ *
+ * Compares the throughput of different ways to apply a stencil to the
+ * inner elements of a distributed 3D matrix:
+ *
+ * - iterator: StencilIterator with value_at for every stencil point
+ * - update:   StencilOperatorInner::update with a per element operation
+ * - rows:     StencilOperatorInner::update_weighted, row wise and vectorizable
+ * - tiled:    StencilOperatorInner::update_weighted with cache tiles
+ *
+ * Usage: ex.11.halo-stencil-rows [-n <extent>] [-i <iterations>]
+ *                                [-t <tile extent>]
+ */
+
+#include <libdash.h>
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+using std::cout;
+using std::endl;
+
+using element_t     = double;
+using Pattern_t     = dash::Pattern<3>;
+using index_t       = typename Pattern_t::index_type;
+using Matrix_t      = dash::Matrix<element_t, 3, index_t, Pattern_t>;
+using StencilP_t    = dash::halo::StencilPoint<3>;
+using StencilSpec_t = dash::halo::StencilSpec<StencilP_t, 6>;
+using HaloWrapper_t = dash::halo::HaloMatrixWrapper<Matrix_t>;
+
+using Timer = dash::util::Timer<dash::util::TimeMeasure::Clock>;
+
+template <typename StencilOpT, typename KernelT>
+void measure(const std::string& name, StencilOpT& stencil_op,
+             element_t* dst, int iterations, KernelT kernel) {
+  const auto num_points = stencil_op.inner.view().size();
+
+  // warm up
+  kernel(stencil_op, dst);
+
+  dash::barrier();
+  auto ts_start = Timer::Now();
+  for(int i = 0; i < iterations; ++i) {
+    kernel(stencil_op, dst);
+  }
+  auto time_s = Timer::ElapsedSince(ts_start) / (1000 * 1000);
+  dash::barrier();
+
+  if(dash::myid() == 0) {
+    cout << std::setw(10) << name << ", "
+         << std::fixed << std::setprecision(2) << std::setw(10)
+         << (num_points * iterations) / time_s / 1.0e6 << " MPoints/s/unit, "
+         << std::setw(8) << time_s << " s" << endl;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  index_t extent     = 256;
+  int     iterations = 10;
+  index_t tile       = 16;
+
+  dash::init(&argc, &argv);
+  Timer::Calibrate(0);
+
+  for(int i = 1; i < argc - 1; i += 2) {
+    std::string flag = argv[i];
+    if(flag == "-n") {
+      extent = std::atol(argv[i + 1]);
+    } else if(flag == "-i") {
+      iterations = std::atoi(argv[i + 1]);
+    } else if(flag == "-t") {
+      tile = std::atol(argv[i + 1]);
+    }
+  }
+
+  dash::TeamSpec<3> ts;
+  dash::SizeSpec<3> ss(extent, extent, extent);
+  dash::DistributionSpec<3> ds(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  ts.balance_extents();
+  Pattern_t pattern(ss, ds, ts);
+
+  Matrix_t matrix_src(pattern);
+  Matrix_t matrix_dst(pattern);
+  dash::fill(matrix_src.begin(), matrix_src.end(), 1.0);
+  dash::fill(matrix_dst.begin(), matrix_dst.end(), 0.0);
+
+  const element_t coeff_center = 0.4;
+  StencilSpec_t stencil_spec(
+      StencilP_t(0.1, -1, 0, 0), StencilP_t(0.1, 1, 0, 0),
+      StencilP_t(0.1, 0, -1, 0), StencilP_t(0.1, 0, 1, 0),
+      StencilP_t(0.1, 0, 0, -1), StencilP_t(0.1, 0, 0, 1));
+
+  HaloWrapper_t halo_wrapper(matrix_src, stencil_spec);
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+  using StencilOp_t = decltype(stencil_op);
+
+  if(dash::myid() == 0) {
+    cout << "units: " << dash::size() << ", extent: " << extent
+         << "^3, inner points per unit: " << stencil_op.inner.view().size()
+         << ", iterations: " << iterations << ", tile: " << tile << endl;
+  }
+
+  halo_wrapper.update();
+  auto* dst = matrix_dst.lbegin();
+
+  measure("iterator", stencil_op, dst, iterations,
+    [&](StencilOp_t& op, element_t* dst) {
+      auto end = op.inner.end();
+      for(auto it = op.inner.begin(); it != end; ++it) {
+        element_t value = coeff_center * *it;
+        for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i) {
+          value += stencil_spec[i].coefficient() * it.value_at(i);
+        }
+        dst[it.lpos()] = value;
+      }
+    });
+
+  measure("update", stencil_op, dst, iterations,
+    [&](StencilOp_t& op, element_t* dst) {
+      op.inner.update(dst,
+        [&](element_t* center, element_t* center_dst, index_t offset,
+            const std::array<index_t, 6>& offsets) {
+          element_t value = coeff_center * *center;
+          for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i) {
+            value += stencil_spec[i].coefficient() * center[offsets[i]];
+          }
+          *center_dst = value;
+        });
+    });
+
+  measure("rows", stencil_op, dst, iterations,
+    [&](StencilOp_t& op, element_t* dst) {
+      op.inner.update_weighted(dst, coeff_center);
+    });
+
+  measure("tiled", stencil_op, dst, iterations,
+    [&](StencilOp_t& op, element_t* dst) {
+      op.inner.update_weighted(dst, coeff_center, {{tile, tile, 0}});
+    });
+
+  dash::finalize();
+
+  return 0;
+}
@@ -18,15 +18,22 @@
 #include <dash/algorithm/Transform.h>
 #include <dash/algorithm/Bcast.h>
 #include <dash/algorithm/Reduce.h>
+#include <dash/algorithm/TransformReduce.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/Redistribute.h>
+#include <dash/algorithm/Transpose.h>
 #include <dash/algorithm/Fill.h>
 #include <dash/algorithm/Generate.h>
 #include <dash/algorithm/AllOf.h>
 #include <dash/algorithm/AnyOf.h>
 #include <dash/algorithm/Find.h>
+#include <dash/algorithm/Count.h>
 #include <dash/algorithm/Equal.h>
 #include <dash/algorithm/Sort.h>
+#include <dash/algorithm/RadixSort.h>
+#include <dash/algorithm/NthElement.h>
 
 #include <dash/algorithm/SUMMA.h>
+#include <dash/algorithm/SUMMA25D.h>
 
 #endif // DASH__ALGORITHM_H_
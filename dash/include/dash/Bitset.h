@@ -0,0 +1,601 @@
+#ifndef DASH__BITSET_H__INCLUDED
+#define DASH__BITSET_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Array.h>
+#include <dash/Distribution.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * \defgroup  DashBitsetConcept  Bitset Concept
+ * Concept of a distributed set of bits with atomic bit operations.
+ *
+ * \ingroup DashContainerConcept
+ * \{
+ * \par Description
+ *
+ * A fixed-size sequence of bits packed into words of unsigned integral
+ * type. Words are distributed to the units in the team by a
+ * one-dimensional pattern, like the elements of a \c dash::Array.
+ *
+ * Operations on single bits are atomic and can be called concurrently by
+ * any unit. Setting and clearing bits is implemented by bitwise
+ * accumulate operations (\c DART_OP_BOR, \c DART_OP_BAND) on the words
+ * containing the bits, so a single one-sided operation replaces a
+ * fetch-and-op on every element of an array of \c dash::Atomic.
+ *
+ * Batched operations accept a range of bit indices. Indices are sorted
+ * and combined to a single mask per word, and the masks of consecutive
+ * words at the same unit are accumulated in a single operation. All
+ * operations of a batch are issued before completing them with one flush
+ * per target unit.
+ *
+ * \par Member types
+ *
+ * Type                            | Definition
+ * ------------------------------- | ----------------------------------------------------------
+ * <tt>word_type</tt>              | Unsigned integral type bits are packed into
+ * <tt>size_type</tt>              | Unsigned integral type to represent the number of bits
+ * <tt>index_type</tt>             | Integral type to represent bit and word indices
+ *
+ * \par Member functions
+ *
+ * Function                     | Return type          | Definition
+ * ---------------------------- | -------------------- | -----------------------------------------------
+ * <b>Bit operations</b>        | &nbsp;               | &nbsp;
+ * <tt>set</tt>                 | <tt>void</tt>        | Atomically set a single bit or a range of bits
+ * <tt>reset</tt>               | <tt>void</tt>        | Atomically clear a single bit or a range of bits
+ * <tt>test</tt>                | <tt>bool</tt>        | Value of a single bit or a range of bits
+ * <tt>test_and_set</tt>        | <tt>bool</tt>        | Atomically set a bit and return its previous value
+ * <b>Collective operations</b> | &nbsp;               | &nbsp;
+ * <tt>count</tt>               | <tt>size_type</tt>   | Number of bits set in the bitset
+ * <tt>clear</tt>               | <tt>void</tt>        | Clear all bits
+ * <b>Local access</b>          | &nbsp;               | &nbsp;
+ * <tt>lbegin</tt>              | <tt>word_type *</tt> | Native pointer to the first local word
+ * <tt>lend</tt>                | <tt>word_type *</tt> | Native pointer past the last local word
+ * <tt>local_count</tt>         | <tt>size_type</tt>   | Number of bits set in local words
+ *
+ * \par Usage
+ *
+ * \code
+ *   dash::Bitset<> visited(num_vertices);
+ *   // mark all neighbors of local frontier vertices as visited:
+ *   visited.set(neighbors.begin(), neighbors.end());
+ *   visited.barrier();
+ *   auto num_visited = visited.count();
+ * \endcode
+ *
+ * \}
+ */
+
+/**
+ * A distributed fixed-size set of bits with atomic bit operations.
+ *
+ * \tparam  WordType  Unsigned integral type bits are packed into.
+ *
+ * \concept{DashBitsetConcept}
+ */
+template<typename WordType = uint64_t>
+class Bitset
+{
+  static_assert(std::is_unsigned<WordType>::value,
+                "Word type of dash::Bitset must be unsigned integral type");
+  static_assert(dash::dart_datatype<WordType>::value != DART_TYPE_UNDEFINED,
+                "Word type of dash::Bitset must have a DART data type");
+
+private:
+  typedef Bitset<WordType>                                          self_t;
+
+public:
+  typedef WordType                                               word_type;
+  typedef dash::default_size_t                                   size_type;
+  typedef dash::default_index_t                                 index_type;
+  typedef dash::Array<word_type>                                array_type;
+  typedef typename array_type::pattern_type                   pattern_type;
+
+  /// Number of bits in a word.
+  static constexpr size_type word_bits =
+                               std::numeric_limits<word_type>::digits;
+
+public:
+  /**
+   * Constructor, allocates a bitset of the given number of bits with all
+   * bits cleared.
+   *
+   * Collective operation.
+   */
+  explicit Bitset(
+    /// Number of bits in the bitset.
+    size_type                      nbits,
+    /// Distribution of words to units.
+    const dash::DistributionSpec<1> & distribution = dash::BLOCKED,
+    /// Team containing all units operating on the bitset.
+    dash::Team                   & team = dash::Team::All())
+  : _nbits(nbits),
+    _words(num_words(nbits), distribution, team),
+    _dtype(dash::dart_datatype<word_type>::value)
+  {
+    DASH_LOG_DEBUG("Bitset(nbits,dist,team)", "nbits:", nbits,
+                   "words:", _words.size());
+    std::fill(_words.lbegin(), _words.lend(), word_type(0));
+    _words.barrier();
+    DASH_LOG_DEBUG("Bitset(nbits,dist,team) >");
+  }
+
+  /**
+   * Constructor, allocates a bitset of the given number of bits with all
+   * bits cleared.
+   *
+   * Collective operation.
+   */
+  Bitset(
+    /// Number of bits in the bitset.
+    size_type    nbits,
+    /// Team containing all units operating on the bitset.
+    dash::Team & team)
+  : Bitset(nbits, dash::BLOCKED, team)
+  { }
+
+  Bitset(const self_t & other)             = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * The team containing all units operating on the bitset.
+   */
+  inline dash::Team & team() const noexcept
+  {
+    return _words.team();
+  }
+
+  /**
+   * Number of bits in the bitset.
+   */
+  constexpr size_type size() const noexcept
+  {
+    return _nbits;
+  }
+
+  /**
+   * Pattern used to distribute words to units.
+   * Maps local word offsets to global word indices, the word with global
+   * index \c w contains the bits <tt>[w * word_bits, (w+1) * word_bits)</tt>.
+   */
+  inline const pattern_type & pattern() const noexcept
+  {
+    return _words.pattern();
+  }
+
+  /**
+   * Native pointer to the first word in local memory.
+   */
+  inline word_type * lbegin() noexcept
+  {
+    return _words.lbegin();
+  }
+
+  /**
+   * Native pointer past the last word in local memory.
+   */
+  inline word_type * lend() noexcept
+  {
+    return _words.lend();
+  }
+
+  /**
+   * Native pointer to the first word in local memory.
+   */
+  inline const word_type * lbegin() const noexcept
+  {
+    return _words.lbegin();
+  }
+
+  /**
+   * Native pointer past the last word in local memory.
+   */
+  inline const word_type * lend() const noexcept
+  {
+    return _words.lend();
+  }
+
+  /**
+   * Sets the bit at the given index.
+   *
+   * Atomic one-sided operation, blocks until the bit is set at the
+   * target unit.
+   */
+  void set(index_type bit)
+  {
+    word_type mask = bit_mask(bit);
+    auto      gptr = bit_gptr(bit);
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(gptr, &mask, 1, _dtype, DART_OP_BOR),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush(gptr), DART_OK);
+  }
+
+  /**
+   * Clears the bit at the given index.
+   *
+   * Atomic one-sided operation, blocks until the bit is cleared at the
+   * target unit.
+   */
+  void reset(index_type bit)
+  {
+    word_type mask = ~bit_mask(bit);
+    auto      gptr = bit_gptr(bit);
+    DASH_ASSERT_RETURNS(
+      dart_accumulate(gptr, &mask, 1, _dtype, DART_OP_BAND),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush(gptr), DART_OK);
+  }
+
+  /**
+   * Value of the bit at the given index.
+   *
+   * Atomic one-sided operation.
+   */
+  bool test(index_type bit) const
+  {
+    word_type nothing = 0;
+    word_type word;
+    auto      gptr    = bit_gptr(bit);
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(gptr, &nothing, &word, _dtype, DART_OP_NO_OP),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush(gptr), DART_OK);
+    return (word & bit_mask(bit)) != 0;
+  }
+
+  /**
+   * Sets the bit at the given index and returns its previous value.
+   * Of any number of units concurrently setting the same bit, exactly one
+   * unit obtains \c false.
+   *
+   * Atomic one-sided operation.
+   */
+  bool test_and_set(index_type bit)
+  {
+    word_type mask = bit_mask(bit);
+    word_type prev;
+    auto      gptr = bit_gptr(bit);
+    DASH_ASSERT_RETURNS(
+      dart_fetch_and_op(gptr, &mask, &prev, _dtype, DART_OP_BOR),
+      DART_OK);
+    DASH_ASSERT_RETURNS(dart_flush(gptr), DART_OK);
+    return (prev & mask) != 0;
+  }
+
+  /**
+   * Sets all bits at indices in the given range.
+   * Issues a single accumulate operation for every contiguous sequence of
+   * words at the same unit and blocks until all bits are set.
+   *
+   * Atomic one-sided operation.
+   */
+  template<typename InputIt>
+  void set(InputIt first, InputIt last)
+  {
+    accumulate_bits(first, last, DART_OP_BOR);
+  }
+
+  /**
+   * Clears all bits at indices in the given range.
+   * Issues a single accumulate operation for every contiguous sequence of
+   * words at the same unit and blocks until all bits are cleared.
+   *
+   * Atomic one-sided operation.
+   */
+  template<typename InputIt>
+  void reset(InputIt first, InputIt last)
+  {
+    accumulate_bits(first, last, DART_OP_BAND);
+  }
+
+  /**
+   * Writes the values of the bits at indices in the given range to the
+   * output range, in the order of the indices.
+   * Reads every contiguous sequence of words at the same unit in a single
+   * get operation.
+   *
+   * Words are read non-atomically, bits modified concurrently by other
+   * units may or may not be observed. Use a barrier to separate phases
+   * of modification and batched tests.
+   *
+   * One-sided operation.
+   *
+   * \return  Output iterator past the last written value.
+   */
+  template<typename InputIt, typename OutputIt>
+  OutputIt test(InputIt first, InputIt last, OutputIt out) const
+  {
+    DASH_LOG_TRACE("Bitset.test(first,last,out)");
+    std::vector<index_type> bits(first, last);
+    word_batch_t batch;
+    collect_words(bits.begin(), bits.end(), DART_OP_BOR, batch);
+
+    std::vector<word_type> values(batch.words.size());
+    for (const auto & run : batch.runs) {
+      DASH_ASSERT_RETURNS(
+        dart_get(values.data() + run.offset, word_gptr(run.word),
+                 run.nwords, _dtype, _dtype),
+        DART_OK);
+    }
+    flush_units(batch);
+
+    for (auto bit : bits) {
+      auto w   = word_index(bit);
+      auto pos = std::lower_bound(batch.words.begin(), batch.words.end(),
+                                  w) - batch.words.begin();
+      *out++   = (values[pos] & bit_mask(bit)) != 0;
+    }
+    DASH_LOG_TRACE("Bitset.test(first,last,out) >",
+                   "words:", batch.words.size(),
+                   "gets:",  batch.runs.size());
+    return out;
+  }
+
+  /**
+   * Number of bits set in words in local memory.
+   *
+   * Local operation.
+   */
+  size_type local_count() const
+  {
+    size_type nset = 0;
+    for (auto w = lbegin(); w != lend(); ++w) {
+      nset += popcount(*w);
+    }
+    return nset;
+  }
+
+  /**
+   * Number of bits set in the bitset.
+   * Counts set bits in local words and combines the local counts in a
+   * reduction.
+   *
+   * Collective operation.
+   */
+  size_type count() const
+  {
+    static_assert(sizeof(unsigned long long) == sizeof(uint64_t),
+                  "unexpected size of unsigned long long");
+    unsigned long long lcount = local_count();
+    unsigned long long gcount = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&lcount, &gcount, 1, DART_TYPE_ULONGLONG, DART_OP_SUM,
+                     team().dart_id()),
+      DART_OK);
+    return static_cast<size_type>(gcount);
+  }
+
+  /**
+   * Whether any bit in the bitset is set.
+   *
+   * Collective operation.
+   */
+  inline bool any() const
+  {
+    return count() > 0;
+  }
+
+  /**
+   * Whether no bit in the bitset is set.
+   *
+   * Collective operation.
+   */
+  inline bool none() const
+  {
+    return count() == 0;
+  }
+
+  /**
+   * Clears all bits.
+   *
+   * Collective operation.
+   */
+  void clear()
+  {
+    _words.barrier();
+    std::fill(lbegin(), lend(), word_type(0));
+    _words.barrier();
+  }
+
+  /**
+   * Synchronizes all units operating on the bitset.
+   *
+   * Collective operation.
+   */
+  inline void barrier()
+  {
+    _words.barrier();
+  }
+
+  /**
+   * Global index of the word containing the given bit.
+   */
+  static constexpr index_type word_index(index_type bit) noexcept
+  {
+    return bit / static_cast<index_type>(word_bits);
+  }
+
+  /**
+   * Mask of the given bit in the word containing it.
+   */
+  static constexpr word_type bit_mask(index_type bit) noexcept
+  {
+    return word_type(1) << (bit % static_cast<index_type>(word_bits));
+  }
+
+private:
+  /**
+   * Contiguous sequence of words at a single unit in a batch.
+   */
+  struct word_run_t {
+    /// Global index of the first word.
+    index_type  word;
+    /// Offset of the first word in the batch.
+    size_type   offset;
+    /// Number of words.
+    size_type   nwords;
+  };
+
+  /**
+   * Words targeted by a batched operation.
+   */
+  struct word_batch_t {
+    /// Sorted global indices of words in the batch.
+    std::vector<index_type>    words;
+    /// Masks of words in the batch.
+    std::vector<word_type>     masks;
+    /// Contiguous sequences of words at a single unit in the batch.
+    std::vector<word_run_t>    runs;
+    /// Units targeted in the batch.
+    std::vector<team_unit_t>   units;
+  };
+
+  static constexpr size_type num_words(size_type nbits) noexcept
+  {
+    return (nbits + word_bits - 1) / word_bits;
+  }
+
+  static inline size_type popcount(word_type w) noexcept
+  {
+    return static_cast<size_type>(
+             __builtin_popcountll(static_cast<unsigned long long>(w)));
+  }
+
+  inline dart_gptr_t word_gptr(index_type word) const
+  {
+    DASH_ASSERT_RANGE(
+      0, word, static_cast<index_type>(_words.size()) - 1,
+      "Bitset: word index out of range");
+    return (_words.begin() + word).dart_gptr();
+  }
+
+  /**
+   * Global pointer to the word containing the given bit.
+   */
+  inline dart_gptr_t bit_gptr(index_type bit) const
+  {
+    DASH_ASSERT_RANGE(
+      0, bit, static_cast<index_type>(_nbits) - 1,
+      "Bitset: bit index out of range");
+    return word_gptr(word_index(bit));
+  }
+
+  /**
+   * Combines bits in the given range to unique words and their masks,
+   * sorted by global word index, and splits them into runs of contiguous
+   * words at the same unit.
+   */
+  template<typename InputIt>
+  void collect_words(
+    InputIt          first,
+    InputIt          last,
+    dart_operation_t op,
+    word_batch_t   & batch) const
+  {
+    std::vector<std::pair<index_type, word_type>> word_masks;
+    for (; first != last; ++first) {
+      index_type bit = *first;
+      DASH_ASSERT_RANGE(
+        0, bit, static_cast<index_type>(_nbits) - 1,
+        "Bitset: bit index out of range");
+      word_masks.emplace_back(word_index(bit), bit_mask(bit));
+    }
+    std::sort(word_masks.begin(), word_masks.end(),
+              [](const std::pair<index_type, word_type> & a,
+                 const std::pair<index_type, word_type> & b) {
+                return (a.first) < (b.first);
+              });
+
+    const auto & pat       = _words.pattern();
+    index_type   run_lidx  = -1;
+    team_unit_t  run_unit  = UNDEFINED_TEAM_UNIT_ID;
+    for (const auto & wm : word_masks) {
+      if (!batch.words.empty() && batch.words.back() == wm.first) {
+        batch.masks.back() |= wm.second;
+        continue;
+      }
+      batch.words.push_back(wm.first);
+      batch.masks.push_back(wm.second);
+      auto lpos = pat.local(wm.first);
+      if (!batch.runs.empty() &&
+          lpos.unit  == run_unit &&
+          lpos.index == run_lidx + 1 &&
+          batch.words[batch.words.size() - 2] + 1 == wm.first) {
+        ++batch.runs.back().nwords;
+      } else {
+        batch.runs.push_back(
+          word_run_t { wm.first, batch.words.size() - 1, 1 });
+        if (std::find(batch.units.begin(), batch.units.end(), lpos.unit)
+            == batch.units.end()) {
+          batch.units.push_back(lpos.unit);
+        }
+      }
+      run_unit = lpos.unit;
+      run_lidx = lpos.index;
+    }
+    if (op == DART_OP_BAND) {
+      for (auto & mask : batch.masks) {
+        mask = ~mask;
+      }
+    }
+  }
+
+  template<typename InputIt>
+  void accumulate_bits(InputIt first, InputIt last, dart_operation_t op)
+  {
+    DASH_LOG_TRACE("Bitset.accumulate_bits()");
+    word_batch_t batch;
+    collect_words(first, last, op, batch);
+    for (const auto & run : batch.runs) {
+      DASH_ASSERT_RETURNS(
+        dart_accumulate(word_gptr(run.word),
+                        batch.masks.data() + run.offset,
+                        run.nwords, _dtype, op),
+        DART_OK);
+    }
+    flush_units(batch);
+    DASH_LOG_TRACE("Bitset.accumulate_bits >",
+                   "words:",       batch.words.size(),
+                   "accumulates:", batch.runs.size(),
+                   "units:",       batch.units.size());
+  }
+
+  /**
+   * Completes operations issued to all units targeted in the given
+   * batch.
+   */
+  void flush_units(const word_batch_t & batch) const
+  {
+    for (auto unit : batch.units) {
+      _words.flush(unit);
+    }
+  }
+
+private:
+  size_type                          _nbits;
+  array_type                         _words;
+  dart_datatype_t                    _dtype;
+};
+
+} // namespace dash
+
+#endif // DASH__BITSET_H__INCLUDED
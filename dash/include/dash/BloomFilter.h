@@ -0,0 +1,345 @@
+#ifndef DASH__BLOOM_FILTER_H__INCLUDED
+#define DASH__BLOOM_FILTER_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Bitset.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * \defgroup  DashBloomFilterConcept  Bloom Filter Concept
+ * Concept of a distributed probabilistic set membership structure.
+ *
+ * \ingroup DashContainerConcept
+ * \{
+ * \par Description
+ *
+ * A Bloom filter represents a set of keys by a \c dash::Bitset of
+ * \c m bits. Inserting a key sets the bits at \c k positions derived from
+ * the key's hash value, a key is considered contained in the set if all
+ * of its \c k bits are set. Membership queries can yield false positives
+ * but no false negatives.
+ *
+ * The \c k bit positions of a key are obtained by double hashing from a
+ * single hash value. Insertions and queries of key ranges collect the bit
+ * positions of all keys and set or test them in a single batched bitset
+ * operation.
+ *
+ * Given the expected number of keys \c n and the accepted probability of
+ * false positives \c p, the optimal number of bits is
+ * <tt>m = -n ln(p) / ln(2)^2</tt> with <tt>k = (m / n) ln(2)</tt> hash
+ * functions.
+ *
+ * \par Member functions
+ *
+ * Function                     | Return type          | Definition
+ * ---------------------------- | -------------------- | -----------------------------------------------
+ * <tt>insert</tt>              | <tt>void</tt>        | Add a single key or a range of keys to the set
+ * <tt>contains</tt>            | <tt>bool</tt>        | Whether a single key or a range of keys may be in the set
+ * <tt>approximate_size</tt>    | <tt>double</tt>      | Estimated number of keys in the set, collective
+ * <tt>clear</tt>               | <tt>void</tt>        | Remove all keys, collective
+ *
+ * \par Usage
+ *
+ * \code
+ *   // one million keys with 1% false positives:
+ *   dash::BloomFilter<uint64_t> seen(1000000, 0.01);
+ *   seen.insert(local_keys.begin(), local_keys.end());
+ *   seen.barrier();
+ *   std::vector<bool> maybe_dup(queries.size());
+ *   seen.contains(queries.begin(), queries.end(), maybe_dup.begin());
+ * \endcode
+ *
+ * \}
+ */
+
+/**
+ * A distributed Bloom filter.
+ *
+ * \tparam  Key   Type of the keys in the set.
+ * \tparam  Hash  Hash function object type for keys.
+ *
+ * \concept{DashBloomFilterConcept}
+ */
+template<
+  typename Key,
+  typename Hash = std::hash<Key> >
+class BloomFilter
+{
+private:
+  typedef BloomFilter<Key, Hash>                                    self_t;
+
+public:
+  typedef Key                                                     key_type;
+  typedef Hash                                                      hasher;
+  typedef dash::Bitset<uint64_t>                               bitset_type;
+  typedef typename bitset_type::size_type                        size_type;
+  typedef typename bitset_type::index_type                      index_type;
+
+public:
+  /**
+   * Constructor, allocates a filter for the expected number of keys with
+   * the given probability of false positives.
+   *
+   * Collective operation.
+   */
+  BloomFilter(
+    /// Expected number of keys in the set.
+    size_type    nkeys,
+    /// Accepted probability of false positives, in range (0,1).
+    double       fp_rate,
+    /// Team containing all units operating on the filter.
+    dash::Team & team = dash::Team::All(),
+    /// Hash function object.
+    const Hash & hash = Hash())
+  : BloomFilter(optimal_num_bits(nkeys, fp_rate),
+                optimal_num_hashes(optimal_num_bits(nkeys, fp_rate), nkeys),
+                team,
+                hash)
+  { }
+
+  /**
+   * Constructor, allocates a filter with the given number of bits and
+   * hash functions.
+   *
+   * Collective operation.
+   */
+  BloomFilter(
+    /// Number of bits in the filter.
+    size_type    nbits,
+    /// Number of hash functions.
+    int          nhashes,
+    /// Team containing all units operating on the filter.
+    dash::Team & team = dash::Team::All(),
+    /// Hash function object.
+    const Hash & hash = Hash())
+  : _bits(nbits, team),
+    _nhashes(nhashes),
+    _hash(hash)
+  {
+    DASH_LOG_DEBUG("BloomFilter(nbits,nhashes,team)",
+                   "bits:", nbits, "hashes:", nhashes);
+    if (nbits == 0 || nhashes < 1) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "BloomFilter: number of bits and hash functions must be positive," <<
+        " got " << nbits << " bits, " << nhashes << " hash functions");
+    }
+  }
+
+  /**
+   * Optimal number of bits for the given number of keys and probability
+   * of false positives.
+   */
+  static size_type optimal_num_bits(size_type nkeys, double fp_rate)
+  {
+    if (!(fp_rate > 0.0 && fp_rate < 1.0)) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "BloomFilter: false positive rate must be in range (0,1), got " <<
+        fp_rate);
+    }
+    double ln2 = std::log(2.0);
+    double m   = -static_cast<double>(std::max<size_type>(nkeys, 1)) *
+                 std::log(fp_rate) / (ln2 * ln2);
+    return static_cast<size_type>(std::ceil(m));
+  }
+
+  /**
+   * Optimal number of hash functions for the given number of bits and
+   * keys.
+   */
+  static int optimal_num_hashes(size_type nbits, size_type nkeys)
+  {
+    double k = static_cast<double>(nbits) /
+               static_cast<double>(std::max<size_type>(nkeys, 1)) *
+               std::log(2.0);
+    return std::max(1, static_cast<int>(std::round(k)));
+  }
+
+  /**
+   * The team containing all units operating on the filter.
+   */
+  inline dash::Team & team() const noexcept
+  {
+    return _bits.team();
+  }
+
+  /**
+   * Number of bits in the filter.
+   */
+  constexpr size_type num_bits() const noexcept
+  {
+    return _bits.size();
+  }
+
+  /**
+   * Number of hash functions.
+   */
+  constexpr int num_hashes() const noexcept
+  {
+    return _nhashes;
+  }
+
+  /**
+   * The bitset representing the filter.
+   */
+  inline const bitset_type & bits() const noexcept
+  {
+    return _bits;
+  }
+
+  /**
+   * Adds a key to the set.
+   *
+   * One-sided operation.
+   */
+  void insert(const key_type & key)
+  {
+    std::vector<index_type> positions;
+    add_positions(key, positions);
+    _bits.set(positions.begin(), positions.end());
+  }
+
+  /**
+   * Adds all keys in the given range to the set in a single batched
+   * bitset operation.
+   *
+   * One-sided operation.
+   */
+  template<typename InputIt>
+  void insert(InputIt first, InputIt last)
+  {
+    std::vector<index_type> positions;
+    for (; first != last; ++first) {
+      add_positions(*first, positions);
+    }
+    _bits.set(positions.begin(), positions.end());
+  }
+
+  /**
+   * Whether the key may be in the set. Returns \c true for all keys that
+   * have been inserted and for a fraction of other keys.
+   *
+   * One-sided operation.
+   */
+  bool contains(const key_type & key) const
+  {
+    std::vector<index_type> positions;
+    add_positions(key, positions);
+    std::vector<char> values(positions.size());
+    _bits.test(positions.begin(), positions.end(), values.begin());
+    return std::all_of(values.begin(), values.end(),
+                       [](char v) { return v != 0; });
+  }
+
+  /**
+   * Writes for every key in the given range whether it may be in the set
+   * to the output range, testing bits of all keys in a single batched
+   * bitset operation.
+   *
+   * One-sided operation.
+   *
+   * \return  Output iterator past the last written value.
+   */
+  template<typename InputIt, typename OutputIt>
+  OutputIt contains(InputIt first, InputIt last, OutputIt out) const
+  {
+    std::vector<index_type> positions;
+    for (; first != last; ++first) {
+      add_positions(*first, positions);
+    }
+    std::vector<char> values(positions.size());
+    _bits.test(positions.begin(), positions.end(), values.begin());
+    for (auto v = values.begin(); v != values.end(); v += _nhashes) {
+      *out++ = std::all_of(v, v + _nhashes,
+                           [](char b) { return b != 0; });
+    }
+    return out;
+  }
+
+  /**
+   * Estimated number of distinct keys in the set, derived from the
+   * number of bits set.
+   *
+   * Collective operation.
+   */
+  double approximate_size() const
+  {
+    double m     = static_cast<double>(num_bits());
+    double nset  = static_cast<double>(_bits.count());
+    if (nset >= m) {
+      return std::numeric_limits<double>::infinity();
+    }
+    return -m / _nhashes * std::log(1.0 - nset / m);
+  }
+
+  /**
+   * Removes all keys from the set.
+   *
+   * Collective operation.
+   */
+  inline void clear()
+  {
+    _bits.clear();
+  }
+
+  /**
+   * Synchronizes all units operating on the filter.
+   *
+   * Collective operation.
+   */
+  inline void barrier()
+  {
+    _bits.barrier();
+  }
+
+private:
+  static inline uint64_t mix(uint64_t x) noexcept
+  {
+    // splitmix64 finalizer, spreads weak hash values like the identity
+    // hash of integral keys over all bits:
+    x += 0x9e3779b97f4a7c15ULL;
+    x  = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x  = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+  }
+
+  /**
+   * Appends the bit positions of a key to the given vector, using double
+   * hashing <tt>h_i = h1 + i * h2</tt>.
+   */
+  void add_positions(
+    const key_type          & key,
+    std::vector<index_type> & positions) const
+  {
+    uint64_t h1 = mix(static_cast<uint64_t>(_hash(key)));
+    uint64_t h2 = mix(h1) | 1;
+    uint64_t m  = static_cast<uint64_t>(num_bits());
+    for (int i = 0; i < _nhashes; ++i) {
+      positions.push_back(static_cast<index_type>((h1 + i * h2) % m));
+    }
+  }
+
+private:
+  bitset_type                       _bits;
+  int                               _nhashes;
+  Hash                              _hash;
+};
+
+} // namespace dash
+
+#endif // DASH__BLOOM_FILTER_H__INCLUDED
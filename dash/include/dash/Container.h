@@ -6,8 +6,13 @@
  * Concept of a distributed container.
  *
  * \see DashArrayConcept
+ * \see DashVectorConcept
  * \see DashMapConcept
+ * \see DashWorkQueueConcept
+ * \see DashBitsetConcept
+ * \see DashBloomFilterConcept
  * \see DashMatrixConcept
+ * \see DashSparseMatrixConcept
  * \see DashViewConcept
  * \see DashRangeConcept
  * \see DashIteratorConcept
@@ -70,10 +75,15 @@
 // Static containers:
 #include<dash/Array.h>
 #include<dash/Matrix.h>
+#include<dash/SparseMatrix.h>
 #include<dash/Coarray.h>
+#include<dash/Bitset.h>
+#include<dash/BloomFilter.h>
 
 // Dynamic containers:
 #include<dash/List.h>
+#include<dash/Vector.h>
 #include<dash/UnorderedMap.h>
+#include<dash/WorkQueue.h>
 
 #endif // DASH__CONTAINER_H_
@@ -0,0 +1,266 @@
+#ifndef DASH__EXECUTION_H__INCLUDED
+#define DASH__EXECUTION_H__INCLUDED
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Minimum number of local elements processed by a thread in algorithms
+ * invoked with a parallel execution policy.
+ */
+#define EXECUTION_MIN_NELEM_PER_THREAD (1 << 10)
+
+namespace dash {
+
+/**
+ * Execution policies for the unit-local portion of DASH algorithms,
+ * corresponding to the execution policies in \c std::execution.
+ *
+ * Algorithms in \ref DashAlgorithms accepting an execution policy as
+ * first argument remain collective operations on the global range.
+ * The policy only specifies how every unit processes its local elements:
+ *
+ * - \c dash::execution::seq       Sequentially in the calling thread.
+ * - \c dash::execution::par       Split among the threads available to
+ *                                 the unit, as reported by
+ *                                 \c dash::util::UnitLocality.
+ * - \c dash::execution::par_unseq Split among threads, with vectorized
+ *                                 execution in every thread.
+ *
+ * Without OpenMP support (\c DASH_ENABLE_OPENMP), all policies execute
+ * sequentially.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::for_each(dash::execution::par,
+ *                  array.begin(), array.end(),
+ *                  [](double & v) { v = std::sqrt(v); });
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+namespace execution {
+
+/// Sequential execution of the unit-local portion of an algorithm.
+struct sequenced_policy { };
+/// Threaded execution of the unit-local portion of an algorithm.
+struct parallel_policy { };
+/// Threaded and vectorized execution of the unit-local portion of an
+/// algorithm.
+struct parallel_unsequenced_policy { };
+
+constexpr sequenced_policy            seq { };
+constexpr parallel_policy             par { };
+constexpr parallel_unsequenced_policy par_unseq { };
+
+template <class T>
+struct is_execution_policy : std::false_type { };
+
+template <>
+struct is_execution_policy<sequenced_policy> : std::true_type { };
+
+template <>
+struct is_execution_policy<parallel_policy> : std::true_type { };
+
+template <>
+struct is_execution_policy<parallel_unsequenced_policy>
+  : std::true_type { };
+
+} // namespace execution
+
+namespace internal {
+
+template <class ExecutionPolicy>
+using enable_if_execution_policy = typename std::enable_if<
+  dash::execution::is_execution_policy<
+    typename std::decay<ExecutionPolicy>::type>::value
+  >::type;
+
+/**
+ * Number of threads to process \c nelem local elements, limited by the
+ * threads available to the unit (see
+ * \c dash::util::UnitLocality::num_domain_threads).
+ */
+inline int execution_num_threads(
+  dash::execution::sequenced_policy,
+  size_t)
+{
+  return 1;
+}
+
+template <class ExecutionPolicy>
+inline int execution_num_threads(
+  ExecutionPolicy,
+  size_t nelem)
+{
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  auto max_threads = std::max<size_t>(
+                       1, nelem / EXECUTION_MIN_NELEM_PER_THREAD);
+  auto n_threads   = static_cast<int>(std::min<size_t>(
+                       std::max(uloc.num_domain_threads(), 1),
+                       max_threads));
+  DASH_LOG_DEBUG("dash::execution", "threads:", n_threads);
+  return n_threads;
+#else
+  dash__unused(nelem);
+  return 1;
+#endif
+}
+
+/**
+ * Invokes \c func(i) for every local index \c i in \c [0, nelem).
+ */
+template <class IndexFunction>
+void execution_for(
+  dash::execution::sequenced_policy,
+  size_t        nelem,
+  IndexFunction func)
+{
+  for (size_t i = 0; i < nelem; ++i) {
+    func(i);
+  }
+}
+
+template <class IndexFunction>
+void execution_for(
+  dash::execution::parallel_policy policy,
+  size_t        nelem,
+  IndexFunction func)
+{
+#ifdef DASH_ENABLE_OPENMP
+  auto n_threads = execution_num_threads(policy, nelem);
+  auto n         = static_cast<int64_t>(nelem);
+  #pragma omp parallel for num_threads(n_threads) schedule(static)
+  for (int64_t i = 0; i < n; ++i) {
+    func(i);
+  }
+#else
+  execution_for(dash::execution::seq, nelem, func);
+#endif
+}
+
+template <class IndexFunction>
+void execution_for(
+  dash::execution::parallel_unsequenced_policy policy,
+  size_t        nelem,
+  IndexFunction func)
+{
+#ifdef DASH_ENABLE_OPENMP
+  auto n_threads = execution_num_threads(policy, nelem);
+  auto n         = static_cast<int64_t>(nelem);
+  #pragma omp parallel for simd num_threads(n_threads) schedule(static)
+  for (int64_t i = 0; i < n; ++i) {
+    func(i);
+  }
+#else
+  execution_for(dash::execution::seq, nelem, func);
+#endif
+}
+
+/**
+ * Smallest local index \c i in \c [0, nelem) for which \c pred(i) is
+ * true, or \c nelem if there is no such index.
+ */
+template <class IndexPredicate>
+size_t execution_find_first(
+  dash::execution::sequenced_policy,
+  size_t         nelem,
+  IndexPredicate pred)
+{
+  for (size_t i = 0; i < nelem; ++i) {
+    if (pred(i)) {
+      return i;
+    }
+  }
+  return nelem;
+}
+
+template <class ExecutionPolicy, class IndexPredicate>
+size_t execution_find_first(
+  ExecutionPolicy policy,
+  size_t          nelem,
+  IndexPredicate  pred)
+{
+#ifdef DASH_ENABLE_OPENMP
+  auto n_threads = execution_num_threads(policy, nelem);
+  if (n_threads > 1) {
+    // Every thread searches a contiguous chunk, so the first match is in
+    // the first chunk containing a match. Chunks are sized by the number
+    // of threads actually granted, which may be less than requested:
+    std::vector<size_t> t_first(n_threads, nelem);
+    #pragma omp parallel num_threads(n_threads)
+    {
+      size_t t_num   = omp_get_num_threads();
+      size_t t_id    = omp_get_thread_num();
+      size_t t_begin = nelem * t_id / t_num;
+      size_t t_end   = nelem * (t_id + 1) / t_num;
+      for (size_t i = t_begin; i < t_end; ++i) {
+        if (pred(i)) {
+          t_first[t_id] = i;
+          break;
+        }
+      }
+    }
+    return *std::min_element(t_first.begin(), t_first.end());
+  }
+#endif
+  return execution_find_first(dash::execution::seq, nelem, pred);
+}
+
+/**
+ * Number of local indices \c i in \c [0, nelem) for which \c pred(i) is
+ * true.
+ */
+template <class IndexPredicate>
+size_t execution_count_if(
+  dash::execution::sequenced_policy,
+  size_t         nelem,
+  IndexPredicate pred)
+{
+  size_t count = 0;
+  for (size_t i = 0; i < nelem; ++i) {
+    count += pred(i) ? 1 : 0;
+  }
+  return count;
+}
+
+template <class ExecutionPolicy, class IndexPredicate>
+size_t execution_count_if(
+  ExecutionPolicy policy,
+  size_t          nelem,
+  IndexPredicate  pred)
+{
+#ifdef DASH_ENABLE_OPENMP
+  auto    n_threads = execution_num_threads(policy, nelem);
+  auto    n         = static_cast<int64_t>(nelem);
+  int64_t count     = 0;
+  #pragma omp parallel for num_threads(n_threads) schedule(static) \
+                           reduction(+:count)
+  for (int64_t i = 0; i < n; ++i) {
+    count += pred(i) ? 1 : 0;
+  }
+  return static_cast<size_t>(count);
+#else
+  return execution_count_if(dash::execution::seq, nelem, pred);
+#endif
+}
+
+} // namespace internal
+
+} // namespace dash
+
+#endif // DASH__EXECUTION_H__INCLUDED
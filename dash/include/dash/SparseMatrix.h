@@ -0,0 +1,668 @@
+#ifndef DASH__SPARSE_MATRIX_H__INCLUDED
+#define DASH__SPARSE_MATRIX_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Array.h>
+
+#include <dash/pattern/CSRPattern.h>
+#include <dash/algorithm/Copy.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * \defgroup  DashSparseMatrixConcept  Sparse Matrix Concept
+ * Concept of a distributed sparse matrix in compressed sparse row format.
+ *
+ * \ingroup DashContainerConcept
+ * \{
+ * \par Description
+ *
+ * A two-dimensional sparse matrix with rows distributed to units in
+ * contiguous row blocks. Every unit stores the nonzero entries of its
+ * rows in compressed sparse row (CSR) format in local memory.
+ *
+ * Dense vectors multiplied with the matrix are \c dash::Array instances
+ * with a \c dash::CSRPattern: vectors <tt>y</tt> in <tt>y = A x</tt> are
+ * distributed like the matrix rows (\c row_pattern), vectors <tt>x</tt>
+ * like its columns (\c col_pattern).
+ *
+ * The matrix is assembled collectively from coordinate (COO) triplets.
+ * Every unit may contribute triplets of any row, triplets are routed to
+ * the units owning their rows, and duplicate entries are summed.
+ *
+ * Assembly determines the entries of \c x outside of the local column
+ * block that are referenced by local rows (ghost entries), sorted by
+ * their owning unit. Column indices are renumbered to index the local
+ * block of \c x followed by the ghost entries, and the nonzeros of every
+ * row are ordered such that entries in the local column block come
+ * first.
+ * The sparse matrix-vector product fetches all ghost entries in a single
+ * batched exchange, issuing one get per contiguous range of ghost entries
+ * at a unit, and computes the local part of the product while the ghost
+ * exchange is in progress.
+ *
+ * \par Member functions
+ *
+ * Function                     | Return type            | Definition
+ * ---------------------------- | ---------------------- | -----------------------------------------------
+ * <tt>assemble</tt>            | <tt>void</tt>          | Build the matrix from COO triplets, collective
+ * <tt>multiply</tt>            | <tt>void</tt>          | Sparse matrix-vector product <tt>y = A x</tt>, collective
+ * <tt>row_pattern</tt>         | <tt>pattern_type</tt>  | Distribution of rows, for vectors <tt>y</tt>
+ * <tt>col_pattern</tt>         | <tt>pattern_type</tt>  | Distribution of columns, for vectors <tt>x</tt>
+ * <tt>nnz</tt>                 | <tt>size_type</tt>     | Number of nonzero entries in the matrix
+ * <tt>local_nnz</tt>           | <tt>size_type</tt>     | Number of nonzero entries in local rows
+ * <tt>num_ghosts</tt>          | <tt>size_type</tt>     | Number of remote vector entries referenced by local rows
+ *
+ * \par Usage
+ *
+ * \code
+ *   dash::SparseMatrix<double> A(n, n);
+ *   A.assemble(local_triplets.begin(), local_triplets.end());
+ *   dash::SparseMatrix<double>::vector_type x(A.col_pattern());
+ *   dash::SparseMatrix<double>::vector_type y(A.row_pattern());
+ *   dash::fill(x.begin(), x.end(), 1.0);
+ *   A.multiply(x, y);
+ * \endcode
+ *
+ * \}
+ */
+
+/**
+ * A distributed sparse matrix in compressed sparse row format with
+ * row-block distribution.
+ *
+ * \tparam  ElementType  Type of the matrix entries, must be trivially
+ *                       copyable.
+ * \tparam  IndexType    Integral type of row and column indices.
+ *
+ * \concept{DashSparseMatrixConcept}
+ */
+template<
+  typename ElementType,
+  typename IndexType = dash::default_index_t >
+class SparseMatrix
+{
+  static_assert(std::is_trivially_copyable<ElementType>::value,
+                "Element type of dash::SparseMatrix must be trivially "
+                "copyable");
+
+private:
+  typedef SparseMatrix<ElementType, IndexType>                      self_t;
+
+public:
+  typedef ElementType                                           value_type;
+  typedef IndexType                                             index_type;
+  typedef typename std::make_unsigned<IndexType>::type           size_type;
+  typedef dash::CSRPattern<1, dash::ROW_MAJOR, index_type>    pattern_type;
+  /// Dense vector type distributed by \c row_pattern or \c col_pattern.
+  typedef dash::Array<value_type, index_type, pattern_type>    vector_type;
+
+  /**
+   * Matrix entry in coordinate format.
+   */
+  struct triplet_type {
+    index_type row;
+    index_type col;
+    value_type value;
+  };
+
+public:
+  /**
+   * Constructor, creates an empty matrix with rows and columns distributed
+   * to units in blocks of balanced size.
+   *
+   * Collective operation.
+   */
+  SparseMatrix(
+    /// Number of rows.
+    size_type    nrows,
+    /// Number of columns.
+    size_type    ncols,
+    /// Team containing all units operating on the matrix.
+    dash::Team & team = dash::Team::All())
+  : SparseMatrix(balanced_sizes(nrows, team.size()),
+                 balanced_sizes(ncols, team.size()),
+                 team)
+  { }
+
+  /**
+   * Constructor, creates an empty matrix with the given number of rows
+   * and columns at every unit.
+   * The column distribution determines the distribution of vectors
+   * \c x in <tt>y = A x</tt>.
+   *
+   * Collective operation.
+   */
+  SparseMatrix(
+    /// Number of rows of every unit in the team.
+    const std::vector<size_type> & local_rows,
+    /// Number of columns of every unit in the team.
+    const std::vector<size_type> & local_cols,
+    /// Team containing all units operating on the matrix.
+    dash::Team                   & team = dash::Team::All())
+  : _team(&team),
+    _myid(team.myid()),
+    _row_pattern(checked_local_sizes(local_rows, team), team),
+    _col_pattern(checked_local_sizes(local_cols, team), team),
+    _row_offsets(prefix_sums(local_rows)),
+    _col_offsets(prefix_sums(local_cols)),
+    _row_ptr(local_rows[team.myid()] + 1, 0),
+    _row_split(local_rows[team.myid()], 0)
+  {
+    DASH_LOG_DEBUG("SparseMatrix(lrows,lcols,team)",
+                   "rows:", _row_pattern.size(),
+                   "cols:", _col_pattern.size());
+  }
+
+  SparseMatrix(const self_t & other)       = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * The team containing all units operating on the matrix.
+   */
+  inline dash::Team & team() const noexcept
+  {
+    return *_team;
+  }
+
+  /**
+   * Number of rows.
+   */
+  inline size_type nrows() const noexcept
+  {
+    return _row_pattern.size();
+  }
+
+  /**
+   * Number of columns.
+   */
+  inline size_type ncols() const noexcept
+  {
+    return _col_pattern.size();
+  }
+
+  /**
+   * Number of nonzero entries in the matrix.
+   */
+  inline size_type nnz() const noexcept
+  {
+    return _nnz;
+  }
+
+  /**
+   * Number of nonzero entries in local rows.
+   */
+  inline size_type local_nnz() const noexcept
+  {
+    return _values.size();
+  }
+
+  /**
+   * Number of local rows.
+   */
+  inline size_type local_rows() const noexcept
+  {
+    return _row_ptr.size() - 1;
+  }
+
+  /**
+   * Global index of the first local row.
+   */
+  inline index_type row_offset() const noexcept
+  {
+    return _row_offsets[_myid];
+  }
+
+  /**
+   * Number of remote vector entries referenced by local rows.
+   */
+  inline size_type num_ghosts() const noexcept
+  {
+    return _ghost_cols.size();
+  }
+
+  /**
+   * Distribution of matrix rows, vectors \c y in <tt>y = A x</tt> must be
+   * distributed by this pattern.
+   */
+  inline const pattern_type & row_pattern() const noexcept
+  {
+    return _row_pattern;
+  }
+
+  /**
+   * Distribution of matrix columns, vectors \c x in <tt>y = A x</tt> must
+   * be distributed by this pattern.
+   */
+  inline const pattern_type & col_pattern() const noexcept
+  {
+    return _col_pattern;
+  }
+
+  /**
+   * Offsets of the nonzero entries of every local row in \c lvalues and
+   * \c lcol_indices, followed by the number of local nonzero entries.
+   */
+  inline const index_type * lrow_ptr() const noexcept
+  {
+    return _row_ptr.data();
+  }
+
+  /**
+   * Global column indices of local nonzero entries.
+   */
+  inline const index_type * lcol_indices() const noexcept
+  {
+    return _col_indices.data();
+  }
+
+  /**
+   * Values of local nonzero entries.
+   */
+  inline value_type * lvalues() noexcept
+  {
+    return _values.data();
+  }
+
+  /**
+   * Values of local nonzero entries.
+   */
+  inline const value_type * lvalues() const noexcept
+  {
+    return _values.data();
+  }
+
+  /**
+   * Builds the matrix from the given COO triplets, replacing all previous
+   * entries.
+   * Every unit may pass triplets of any row. Entries with identical row
+   * and column index are summed.
+   *
+   * Collective operation.
+   */
+  template<typename InputIt>
+  void assemble(InputIt first, InputIt last)
+  {
+    DASH_LOG_DEBUG("SparseMatrix.assemble()");
+    auto triplets = redistribute(first, last);
+
+    std::sort(triplets.begin(), triplets.end(),
+              [](const triplet_type & a, const triplet_type & b) {
+                return (a.row <  b.row) ||
+                       (a.row == b.row && a.col < b.col);
+              });
+
+    // Merge duplicate entries:
+    std::vector<triplet_type> merged;
+    merged.reserve(triplets.size());
+    for (const auto & t : triplets) {
+      if (!merged.empty() &&
+          merged.back().row == t.row && merged.back().col == t.col) {
+        merged.back().value += t.value;
+      } else {
+        merged.push_back(t);
+      }
+    }
+
+    build_local_csr(merged);
+    build_ghost_exchange();
+
+    unsigned long long lnnz = local_nnz();
+    unsigned long long gnnz = 0;
+    DASH_ASSERT_RETURNS(
+      dart_allreduce(&lnnz, &gnnz, 1, DART_TYPE_ULONGLONG, DART_OP_SUM,
+                     _team->dart_id()),
+      DART_OK);
+    _nnz = static_cast<size_type>(gnnz);
+    DASH_LOG_DEBUG("SparseMatrix.assemble >",
+                   "nnz:", _nnz, "local nnz:", local_nnz(),
+                   "ghosts:", num_ghosts(),
+                   "ghost runs:", _ghost_runs.size());
+  }
+
+  /**
+   * Sparse matrix-vector product <tt>y = A x</tt>.
+   *
+   * Fetches all ghost entries of \c x in a single batched exchange and
+   * computes the product of the local column block while the exchange is
+   * in progress.
+   * Synchronizes all units before reading \c x and before returning, so
+   * \c x may be modified by its owners after the call.
+   *
+   * Collective operation.
+   */
+  void multiply(const vector_type & x, vector_type & y)
+  {
+    DASH_LOG_TRACE("SparseMatrix.multiply()");
+    DASH_ASSERT_EQ(x.lsize(), _col_pattern.local_size(),
+                   "SparseMatrix.multiply: x must be distributed by " <<
+                   "col_pattern()");
+    DASH_ASSERT_EQ(y.lsize(), _row_pattern.local_size(),
+                   "SparseMatrix.multiply: y must be distributed by " <<
+                   "row_pattern()");
+    dash::dart_storage<value_type> ds(1);
+
+    // Values of x written by their owners must be visible before ghost
+    // entries are read:
+    _team->barrier();
+
+    for (const auto & run : _ghost_runs) {
+      auto gptr = (x.begin() + run.col).dart_gptr();
+      DASH_ASSERT_RETURNS(
+        dart_get(_ghost_values.data() + run.offset, gptr,
+                 run.ncols * ds.nelem, ds.dtype, ds.dtype),
+        DART_OK);
+    }
+
+    // Local column block while ghost entries are in transit:
+    const value_type * xl = x.lbegin();
+    value_type       * yl = y.lbegin();
+    auto nlrows = local_rows();
+    for (size_type r = 0; r < nlrows; ++r) {
+      value_type sum = value_type();
+      for (index_type k = _row_ptr[r]; k < _row_split[r]; ++k) {
+        sum += _values[k] * xl[_lcols[k]];
+      }
+      yl[r] = sum;
+    }
+
+    for (auto unit : _ghost_units) {
+      x.flush_local(unit);
+    }
+
+    // Ghost entries:
+    const value_type * xg     = _ghost_values.data();
+    index_type         nlcols = _col_pattern.local_size();
+    for (size_type r = 0; r < nlrows; ++r) {
+      value_type sum = value_type();
+      for (index_type k = _row_split[r]; k < _row_ptr[r + 1]; ++k) {
+        sum += _values[k] * xg[_lcols[k] - nlcols];
+      }
+      yl[r] += sum;
+    }
+
+    // Ghost entries of x must not be modified before all units read them:
+    _team->barrier();
+    DASH_LOG_TRACE("SparseMatrix.multiply >");
+  }
+
+private:
+  /**
+   * Contiguous range of ghost entries at a single unit.
+   */
+  struct ghost_run_t {
+    /// Global column index of the first entry.
+    index_type  col;
+    /// Offset of the first entry in the ghost buffer.
+    size_type   offset;
+    /// Number of entries.
+    size_type   ncols;
+  };
+
+  static std::vector<size_type> balanced_sizes(
+    size_type n,
+    size_type nunits)
+  {
+    std::vector<size_type> sizes(nunits, n / nunits);
+    for (size_type u = 0; u < n % nunits; ++u) {
+      ++sizes[u];
+    }
+    return sizes;
+  }
+
+  /**
+   * Validates that \c sizes specifies a local size for every unit in
+   * \c team before any member is initialized from it.
+   */
+  static const std::vector<size_type> & checked_local_sizes(
+    const std::vector<size_type> & sizes,
+    dash::Team                   & team)
+  {
+    if (sizes.size() != team.size()) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "SparseMatrix: expected local sizes of " << team.size() <<
+        " units, got " << sizes.size());
+    }
+    return sizes;
+  }
+
+  static std::vector<index_type> prefix_sums(
+    const std::vector<size_type> & sizes)
+  {
+    std::vector<index_type> offsets(sizes.size() + 1, 0);
+    for (size_t u = 0; u < sizes.size(); ++u) {
+      offsets[u + 1] = offsets[u] + sizes[u];
+    }
+    return offsets;
+  }
+
+  /**
+   * Unit owning the given global row or column index.
+   */
+  static team_unit_t owner(
+    const std::vector<index_type> & offsets,
+    index_type                      index)
+  {
+    auto it = std::upper_bound(offsets.begin(), offsets.end(), index);
+    return team_unit_t(static_cast<dart_unit_t>(
+                         std::distance(offsets.begin(), it) - 1));
+  }
+
+  /**
+   * Routes triplets to the units owning their rows.
+   * Triplets are written to a global buffer with one block per receiving
+   * unit, the offset of every sender in a block is determined from the
+   * number of triplets exchanged between all pairs of units.
+   */
+  template<typename InputIt>
+  std::vector<triplet_type> redistribute(InputIt first, InputIt last)
+  {
+    auto nunits = _team->size();
+    std::vector<std::vector<triplet_type>> send_bufs(nunits);
+    for (; first != last; ++first) {
+      const triplet_type & t = *first;
+      if (t.row < 0 || t.row >= static_cast<index_type>(nrows()) ||
+          t.col < 0 || t.col >= static_cast<index_type>(ncols())) {
+        DASH_THROW(
+          dash::exception::OutOfRange,
+          "SparseMatrix.assemble: entry (" << t.row << "," << t.col <<
+          ") out of range");
+      }
+      send_bufs[owner(_row_offsets, t.row)].push_back(t);
+    }
+
+    // Number of triplets sent from every unit (rows) to every unit
+    // (columns):
+    std::vector<unsigned long long> send_counts(nunits);
+    std::vector<unsigned long long> counts(nunits * nunits);
+    for (size_t u = 0; u < nunits; ++u) {
+      send_counts[u] = send_bufs[u].size();
+    }
+    DASH_ASSERT_RETURNS(
+      dart_allgather(send_counts.data(), counts.data(), nunits,
+                     DART_TYPE_ULONGLONG, _team->dart_id()),
+      DART_OK);
+
+    std::vector<size_type> recv_sizes(nunits, 0);
+    for (size_t src = 0; src < nunits; ++src) {
+      for (size_t dst = 0; dst < nunits; ++dst) {
+        recv_sizes[dst] += counts[src * nunits + dst];
+      }
+    }
+
+    typedef dash::CSRPattern<1, dash::ROW_MAJOR, index_type>
+      buf_pattern_t;
+    typedef dash::Array<triplet_type, index_type, buf_pattern_t>
+      buf_array_t;
+    buf_array_t recv_buf(buf_pattern_t(recv_sizes, *_team));
+
+    std::vector<index_type> block_offsets = prefix_sums(recv_sizes);
+    for (size_t dst = 0; dst < nunits; ++dst) {
+      if (send_bufs[dst].empty()) {
+        continue;
+      }
+      index_type offset = block_offsets[dst];
+      for (size_t src = 0; src < _myid; ++src) {
+        offset += counts[src * nunits + dst];
+      }
+      dash::copy(send_bufs[dst].data(),
+                 send_bufs[dst].data() + send_bufs[dst].size(),
+                 recv_buf.begin() + offset);
+    }
+    recv_buf.barrier();
+
+    return std::vector<triplet_type>(recv_buf.lbegin(), recv_buf.lend());
+  }
+
+  /**
+   * Builds local CSR arrays from sorted, unique triplets of local rows.
+   */
+  void build_local_csr(const std::vector<triplet_type> & triplets)
+  {
+    auto row0 = row_offset();
+    std::fill(_row_ptr.begin(), _row_ptr.end(), 0);
+    for (const auto & t : triplets) {
+      ++_row_ptr[t.row - row0 + 1];
+    }
+    std::partial_sum(_row_ptr.begin(), _row_ptr.end(), _row_ptr.begin());
+
+    _col_indices.resize(triplets.size());
+    _values.resize(triplets.size());
+    for (size_t k = 0; k < triplets.size(); ++k) {
+      _col_indices[k] = triplets[k].col;
+      _values[k]      = triplets[k].value;
+    }
+  }
+
+  /**
+   * Determines ghost entries referenced by local rows, renumbers column
+   * indices and reorders the nonzeros of every row such that entries in
+   * the local column block precede ghost entries.
+   */
+  void build_ghost_exchange()
+  {
+    index_type col_begin = _col_offsets[_myid];
+    index_type col_end   = _col_offsets[_myid + 1];
+    index_type nlcols    = col_end - col_begin;
+
+    _ghost_cols.clear();
+    for (auto col : _col_indices) {
+      if (col < col_begin || col >= col_end) {
+        _ghost_cols.push_back(col);
+      }
+    }
+    std::sort(_ghost_cols.begin(), _ghost_cols.end());
+    _ghost_cols.erase(std::unique(_ghost_cols.begin(), _ghost_cols.end()),
+                      _ghost_cols.end());
+    _ghost_values.resize(_ghost_cols.size());
+
+    // Ghost entries are sorted by global index and thus by owning unit,
+    // split them into ranges of consecutive columns at a unit:
+    _ghost_runs.clear();
+    _ghost_units.clear();
+    team_unit_t run_unit = UNDEFINED_TEAM_UNIT_ID;
+    for (size_t g = 0; g < _ghost_cols.size(); ++g) {
+      auto col  = _ghost_cols[g];
+      auto unit = owner(_col_offsets, col);
+      if (!_ghost_runs.empty() && unit == run_unit &&
+          _ghost_cols[g - 1] + 1 == col) {
+        ++_ghost_runs.back().ncols;
+        continue;
+      }
+      _ghost_runs.push_back(ghost_run_t { col, g, 1 });
+      if (unit != run_unit) {
+        _ghost_units.push_back(unit);
+      }
+      run_unit = unit;
+    }
+
+    // Renumber columns: local column block first, then ghost entries:
+    _lcols.resize(_col_indices.size());
+    for (size_t k = 0; k < _col_indices.size(); ++k) {
+      auto col = _col_indices[k];
+      if (col >= col_begin && col < col_end) {
+        _lcols[k] = col - col_begin;
+      } else {
+        _lcols[k] = nlcols +
+                    (std::lower_bound(_ghost_cols.begin(), _ghost_cols.end(),
+                                      col) - _ghost_cols.begin());
+      }
+    }
+
+    // Order entries of every row by renumbered column index so entries in
+    // the local column block come first:
+    std::vector<size_t> perm;
+    for (size_type r = 0; r < local_rows(); ++r) {
+      auto k_begin = _row_ptr[r];
+      auto k_end   = _row_ptr[r + 1];
+      perm.resize(k_end - k_begin);
+      std::iota(perm.begin(), perm.end(), static_cast<size_t>(k_begin));
+      std::sort(perm.begin(), perm.end(),
+                [&](size_t a, size_t b) { return _lcols[a] < _lcols[b]; });
+      apply_permutation(perm, k_begin, _lcols);
+      apply_permutation(perm, k_begin, _col_indices);
+      apply_permutation(perm, k_begin, _values);
+      _row_split[r] = std::lower_bound(
+                        _lcols.begin() + k_begin, _lcols.begin() + k_end,
+                        nlcols) - _lcols.begin();
+    }
+  }
+
+  template<typename T>
+  static void apply_permutation(
+    const std::vector<size_t> & perm,
+    index_type                  offset,
+    std::vector<T>            & values)
+  {
+    std::vector<T> tmp(perm.size());
+    for (size_t i = 0; i < perm.size(); ++i) {
+      tmp[i] = values[perm[i]];
+    }
+    std::copy(tmp.begin(), tmp.end(), values.begin() + offset);
+  }
+
+private:
+  dash::Team                 * _team;
+  team_unit_t                  _myid;
+  pattern_type                 _row_pattern;
+  pattern_type                 _col_pattern;
+  /// First global row of every unit, followed by the number of rows.
+  std::vector<index_type>      _row_offsets;
+  /// First global column of every unit, followed by the number of
+  /// columns.
+  std::vector<index_type>      _col_offsets;
+  size_type                    _nnz = 0;
+  /// Offsets of the nonzero entries of every local row.
+  std::vector<index_type>      _row_ptr;
+  /// Offset of the first ghost entry of every local row.
+  std::vector<index_type>      _row_split;
+  /// Global column indices of local nonzero entries.
+  std::vector<index_type>      _col_indices;
+  /// Renumbered column indices of local nonzero entries, in the local
+  /// column block followed by ghost entries.
+  std::vector<index_type>      _lcols;
+  std::vector<value_type>      _values;
+  /// Sorted global indices of ghost entries.
+  std::vector<index_type>      _ghost_cols;
+  std::vector<value_type>      _ghost_values;
+  std::vector<ghost_run_t>     _ghost_runs;
+  std::vector<team_unit_t>     _ghost_units;
+};
+
+} // namespace dash
+
+#endif // DASH__SPARSE_MATRIX_H__INCLUDED
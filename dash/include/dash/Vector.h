@@ -0,0 +1,781 @@
+#ifndef DASH__VECTOR_H__INCLUDED
+#define DASH__VECTOR_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/GlobRef.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Array.h>
+#include <dash/Allocator.h>
+#include <dash/Meta.h>
+
+#include <dash/memory/GlobHeapMem.h>
+
+#include <dash/algorithm/Copy.h>
+
+#include <dash/vector/LocalVectorRef.h>
+#include <dash/vector/GlobVectorIter.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dash {
+
+/**
+ * \defgroup  DashVectorConcept  Vector Concept
+ * Concept of a distributed one-dimensional growable vector container.
+ *
+ * \ingroup DashContainerConcept
+ * \{
+ * \par Description
+ *
+ * A dynamic one-dimensional container with random access in global index
+ * space.
+ * Units append elements to their local range without communication, the
+ * collective operation \c commit publishes the local sizes of all units.
+ * Global element order follows unit order: elements of unit \c u precede
+ * the elements of unit \c u+1, local elements are in insertion order.
+ *
+ * \par Member types
+ *
+ * Type                            | Definition
+ * ------------------------------- | ----------------------------------------------------------------------------------------
+ * <b>STL</b>                      | &nbsp;
+ * <tt>value_type</tt>             | First template parameter <tt>ElementType</tt>
+ * <tt>reference</tt>              | <tt>GlobRef<value_type></tt>
+ * <tt>const_reference</tt>        | <tt>GlobRef<const value_type></tt>
+ * <tt>iterator</tt>               | A random access iterator to <tt>value_type</tt>
+ * <tt>const_iterator</tt>         | A random access iterator to <tt>const value_type</tt>
+ * <tt>difference_type</tt>        | A signed integral type, identical to <tt>iterator_traits<iterator>::difference_type</tt>
+ * <tt>size_type</tt>              | Unsigned integral type to represent any non-negative value of <tt>difference_type</tt>
+ * <b>DASH-specific</b>            | &nbsp;
+ * <tt>index_type</tt>             | A signed integral type to represent positions in global index space
+ * <tt>local_type</tt>             | Proxy type for views on vector elements that are local to the calling unit
+ *
+ * \par Member functions
+ *
+ * Function                     | Return type          | Definition
+ * ---------------------------- | -------------------- | -----------------------------------------------
+ * <b>Iterators</b>             | &nbsp;               | &nbsp;
+ * <tt>begin</tt>               | <tt>iterator</tt>    | Iterator to first element in the vector
+ * <tt>end</tt>                 | <tt>iterator</tt>    | Iterator past last element in the vector
+ * <b>Capacity</b>              | &nbsp;               | &nbsp;
+ * <tt>size</tt>                | <tt>size_type</tt>   | Number of elements in the vector
+ * <tt>capacity</tt>            | <tt>size_type</tt>   | Number of elements the vector can hold in allocated memory
+ * <tt>empty</tt>               | <tt>bool</tt>        | Whether the vector is empty, i.e. size is 0
+ * <b>Element access</b>        | &nbsp;               | &nbsp;
+ * <tt>operator[]</tt>          | <tt>reference</tt>   | Access element at global index
+ * <tt>front</tt>               | <tt>reference</tt>   | Access the first element in the vector
+ * <tt>back</tt>                | <tt>reference</tt>   | Access the last element in the vector
+ * <b>Dynamic distribution</b>  | &nbsp;               | &nbsp;
+ * <tt>commit</tt>              | <tt>void</tt>        | Collectively publish local changes
+ * <tt>balance</tt>             | <tt>void</tt>        | Collectively redistribute elements in blocked distribution
+ * <b>Views (DASH specific)</b> | &nbsp;               | &nbsp;
+ * <tt>local</tt>               | <tt>local_type</tt>  | View on vector elements local to calling unit
+ *
+ * \par Local member functions
+ *
+ * Function                     | Return type          | Definition
+ * ---------------------------- | -------------------- | -----------------------------------------------
+ * <tt>local.push_back</tt>     | <tt>void</tt>        | Append element to local range
+ * <tt>local.emplace_back</tt>  | <tt>void</tt>        | Construct and append element to local range
+ * <tt>local.pop_back</tt>      | <tt>void</tt>        | Remove last local element
+ * <tt>local.reserve</tt>       | <tt>void</tt>        | Increase local capacity
+ * <tt>local.size</tt>          | <tt>size_type</tt>   | Number of local elements
+ * \}
+ *
+ * Usage examples:
+ *
+ * \code
+ *   dash::Vector<double> vec;
+ *
+ *   // Local operations, no communication:
+ *   for (int i = 0; i < dash::myid() + 1; ++i) {
+ *     vec.local.push_back(dash::myid() + 0.1 * i);
+ *   }
+ *   assert(vec.lsize() == dash::myid() + 1);
+ *
+ *   // Collectively publish local sizes:
+ *   vec.commit();
+ *
+ *   // Logical structure of vector for 3 units:
+ *   //
+ *   //     | unit 0 | unit 1   | unit 2        |
+ *   // ----|--------|----------|---------------|
+ *   //     | 0.0    | 1.0 1.1  | 2.0 2.1 2.2   |
+ *   // idx | 0      | 1   2    | 3   4   5     |
+ *
+ *   double v = vec[4];    // 2.1
+ *
+ *   // Collectively redistribute to blocked distribution:
+ *   vec.balance();
+ *
+ *   //     | unit 0   | unit 1   | unit 2   |
+ *   // ----|----------|----------|----------|
+ *   //     | 0.0 1.0  | 1.1 2.0  | 2.1 2.2  |
+ * \endcode
+ */
+
+/**
+ * A distributed one-dimensional vector with local, amortized constant time
+ * insertion and global random access.
+ *
+ * Local elements are stored in buckets of global dynamic memory
+ * (\c dash::GlobHeapMem) that grow geometrically.
+ *
+ * \concept{DashVectorConcept}
+ */
+template <
+    /// The underlying Element Type
+    typename ElementType,
+    /// The corresponding Memory Space
+    typename LocalMemorySpace = dash::HostSpace>
+class Vector {
+  static_assert(
+    dash::is_container_compatible<ElementType>::value,
+    "Type not supported for DASH containers");
+
+  template<typename T_, class A_>
+  friend class LocalVectorRef;
+
+  template<typename E_, class V_, class R_>
+  friend class GlobVectorIter;
+
+  /// Private Typedefs
+private:
+  typedef Vector<ElementType, LocalMemorySpace> self_t;
+
+  using glob_mem_type = dash::GlobHeapMem<
+      ElementType,
+      LocalMemorySpace,
+      dash::global_allocation_policy::epoch_synchronized,
+      dash::allocator::DefaultAllocator>;
+
+  /// Public types as required by DASH vector concept
+public:
+  typedef ElementType                    value_type;
+  typedef typename dash::default_index_t index_type;
+  typedef typename dash::default_size_t  size_type;
+
+  typedef LocalVectorRef<ElementType, LocalMemorySpace> local_type;
+
+/// Public types as required by STL vector concept
+public:
+  typedef index_type                                         difference_type;
+
+  typedef GlobVectorIter<value_type, self_t>                        iterator;
+  typedef GlobVectorIter<const value_type, self_t,
+                         GlobRef<const value_type> >          const_iterator;
+
+  typedef std::reverse_iterator<      iterator>             reverse_iterator;
+  typedef std::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+  typedef GlobRef<value_type>                                      reference;
+  typedef GlobRef<const value_type>                          const_reference;
+
+  typedef       value_type &                                 local_reference;
+  typedef const value_type &                           const_local_reference;
+
+  typedef typename glob_mem_type::local_pointer               local_iterator;
+  typedef typename glob_mem_type::const_local_pointer   const_local_iterator;
+
+public:
+  /// Local proxy object, allows use in range-based for loops.
+  local_type local;
+
+private:
+  /// Team containing all units interacting with the vector.
+  dash::Team             * _team              = nullptr;
+  /// DART id of the local unit.
+  team_unit_t              _myid{DART_UNDEFINED_UNIT_ID};
+  /// Global memory allocation and -access.
+  glob_mem_type          * _globmem           = nullptr;
+  /// Number of local elements.
+  size_type                _lsize             = 0;
+  /// Number of elements at remote units as published in last commit.
+  size_type                _remote_size       = 0;
+  /// Cumulative (postfix sum) local sizes of all units as published in
+  /// last commit.
+  std::vector<size_type>   _local_cumul_sizes;
+  /// Native pointer to the position of the next local element to insert.
+  value_type             * _tail_lptr         = nullptr;
+  /// Number of elements that can be inserted at _tail_lptr before the
+  /// end of its local bucket is reached.
+  size_type                _tail_free         = 0;
+  /// Minimum number of elements to allocate when local capacity is
+  /// exceeded.
+  /// Default is 4 KB.
+  size_type                _local_buffer_size
+                             = std::max<size_type>(
+                                 1, 4096 / sizeof(value_type));
+
+public:
+  /**
+   * Constructor, creates a new container instance with the specified
+   * initial global capacity and associated units.
+   * The vector is empty after construction.
+   */
+  explicit Vector(
+    size_type   nelem = 0,
+    Team      & team  = dash::Team::All())
+  : local(this),
+    _team(&team),
+    _myid(team.myid())
+  {
+    DASH_LOG_TRACE("Vector(nelem,team)", "nelem:", nelem);
+    if (_team->size() > 0) {
+      allocate(nelem, team);
+    }
+    DASH_LOG_TRACE("Vector(nelem,team) >");
+  }
+
+  /**
+   * Constructor, creates a new container instance with the specified
+   * initial global capacity, minimum local growth and associated units.
+   * The vector is empty after construction.
+   */
+  Vector(
+    size_type   nelem,
+    size_type   nlbuf,
+    Team      & team  = dash::Team::All())
+  : local(this),
+    _team(&team),
+    _myid(team.myid()),
+    _local_buffer_size(nlbuf)
+  {
+    DASH_LOG_TRACE("Vector(nelem,nlbuf,team)",
+                   "nelem:", nelem, "nlbuf:", nlbuf);
+    if (_team->size() > 0) {
+      allocate(nelem, team);
+    }
+    DASH_LOG_TRACE("Vector(nelem,nlbuf,team) >");
+  }
+
+  Vector(const self_t & other) = delete;
+
+  self_t & operator=(const self_t & rhs) = delete;
+
+  /**
+   * Destructor, deallocates local and global memory acquired by the
+   * container instance.
+   */
+  ~Vector()
+  {
+    DASH_LOG_TRACE_VAR("Vector.~Vector()", this);
+    deallocate();
+    DASH_LOG_TRACE_VAR("Vector.~Vector >", this);
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Distributed container
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * The team containing all units accessing this vector.
+   */
+  inline Team & team() const noexcept
+  {
+    if (_team != nullptr) {
+      return *_team;
+    }
+    return dash::Team::Null();
+  }
+
+  inline const glob_mem_type & globmem() const
+  {
+    return *_globmem;
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Dynamic distributed memory
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Publish changes of the local ranges of all units.
+   * Attaches local memory allocated since the last commit to global memory
+   * and updates the global index space from the local sizes of all units.
+   *
+   * Collective operation.
+   */
+  void commit()
+  {
+    DASH_LOG_TRACE_VAR("Vector.commit()", _team->dart_id());
+    // Apply changes in local memory spaces to global memory space:
+    if (_globmem != nullptr) {
+      _globmem->commit();
+    }
+    // Gather local sizes of all units:
+    std::vector<size_type> local_sizes(_team->size(), 0);
+    dash::dart_storage<size_type> ds(1);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        &_lsize,
+        local_sizes.data(),
+        ds.nelem,
+        ds.dtype,
+        _team->dart_id()),
+      DART_OK);
+    _remote_size = 0;
+    for (size_type u = 0; u < _team->size(); ++u) {
+      if (u != _myid) {
+        _remote_size += local_sizes[u];
+      }
+      _local_cumul_sizes[u] = local_sizes[u];
+      if (u > 0) {
+        _local_cumul_sizes[u] += _local_cumul_sizes[u-1];
+      }
+      DASH_LOG_TRACE("Vector.commit",
+                     "local size at unit", u, ":", local_sizes[u],
+                     "cumulative size:", _local_cumul_sizes[u]);
+    }
+    DASH_LOG_TRACE("Vector.commit >", "size:", size());
+  }
+
+  /**
+   * Establish a barrier for all units operating on the vector, publishing
+   * all changes to all units.
+   * Same as \c commit.
+   *
+   * Collective operation.
+   */
+  inline void barrier()
+  {
+    commit();
+  }
+
+  /**
+   * Redistribute the vector's elements to a blocked distribution such that
+   * every unit holds a contiguous range of at most
+   * \f$ \lceil size() / nunits \rceil \f$ elements.
+   * Preserves the global order of elements.
+   *
+   * Collective operation, commits local changes of all units.
+   */
+  void balance()
+  {
+    DASH_LOG_TRACE("Vector.balance()");
+    commit();
+    auto nglobal = size();
+    if (nglobal == 0) {
+      DASH_LOG_TRACE("Vector.balance >", "vector is empty");
+      return;
+    }
+    dash::Array<value_type> balanced(nglobal, dash::BLOCKED, *_team);
+    // Copy local elements to their position in the blocked distribution:
+    index_type g_offset = (_myid > 0) ? _local_cumul_sizes[_myid-1] : 0;
+    size_type  n_copy   = _lsize;
+    for (auto & bucket : _globmem->local_buckets()) {
+      if (n_copy == 0) {
+        break;
+      }
+      auto n_bucket = std::min<size_type>(bucket.size, n_copy);
+      DASH_LOG_TRACE("Vector.balance", "copy bucket",
+                     "size:", n_bucket, "to offset:", g_offset);
+      dash::copy(bucket.lptr,
+                 bucket.lptr + n_bucket,
+                 balanced.begin() + g_offset);
+      g_offset += n_bucket;
+      n_copy   -= n_bucket;
+    }
+    balanced.barrier();
+    // Replace local elements by the local block of the balanced range:
+    local_resize(0);
+    local_reserve(balanced.lsize());
+    for (auto lit = balanced.lbegin(); lit != balanced.lend(); ++lit) {
+      local_push_back(*lit);
+    }
+    commit();
+    DASH_LOG_TRACE("Vector.balance >", "local size:", _lsize);
+  }
+
+  /**
+   * Allocate memory for this container in global memory.
+   *
+   * Calls implicit barrier on the team associated with the container
+   * instance.
+   */
+  bool allocate(
+    /// Initial global capacity of the container.
+    size_type    nelem = 0,
+    /// Team containing all units associated with the container.
+    dash::Team & team  = dash::Team::All())
+  {
+    DASH_LOG_TRACE("Vector.allocate()");
+    DASH_LOG_TRACE_VAR("Vector.allocate", nelem);
+    if (_team == nullptr || *_team == dash::Team::Null()) {
+      DASH_LOG_TRACE("Vector.allocate",
+                     "initializing with specified team -",
+                     "team size:", team.size());
+      _team = &team;
+    } else {
+      DASH_LOG_TRACE("Vector.allocate",
+                     "initializing with initial team");
+    }
+    DASH_ASSERT_GT(_local_buffer_size, 0, "local buffer size must not be 0");
+    _local_cumul_sizes = std::vector<size_type>(_team->size(), 0);
+    _lsize       = 0;
+    _remote_size = 0;
+    _tail_lptr   = nullptr;
+    _tail_free   = 0;
+    _myid        = _team->myid();
+    auto lcap    = dash::math::div_ceil(nelem, _team->size());
+    DASH_LOG_TRACE("Vector.allocate", "initialize global memory,",
+                   "local capacity:", lcap);
+    _globmem     = new glob_mem_type(lcap, *_team);
+    // Register deallocator of this vector instance at the team
+    // instance that has been used to initialized it:
+    _team->register_deallocator(
+             this, std::bind(&Vector::deallocate, this));
+    // Assure all units are synchronized after allocation, otherwise
+    // other units might start working on the vector before allocation
+    // completed at all units:
+    if (dash::is_initialized()) {
+      DASH_LOG_TRACE("Vector.allocate",
+                     "waiting for allocation of all units");
+      _team->barrier();
+    }
+    DASH_LOG_TRACE("Vector.allocate >", "finished");
+    return true;
+  }
+
+  /**
+   * Free global memory allocated by this container instance.
+   *
+   * Calls implicit barrier on the team associated with the container
+   * instance.
+   */
+  void deallocate()
+  {
+    DASH_LOG_TRACE_VAR("Vector.deallocate()", this);
+    if (_globmem == nullptr) {
+      DASH_LOG_TRACE("Vector.deallocate >", "not allocated");
+      return;
+    }
+    // Assure all units are synchronized before deallocation, otherwise
+    // other units might still be working on the vector:
+    if (dash::is_initialized()) {
+      _team->barrier();
+    }
+    // Remove this function from team deallocator list to avoid
+    // double-free:
+    _team->unregister_deallocator(
+      this, std::bind(&Vector::deallocate, this));
+    delete _globmem;
+    _globmem     = nullptr;
+    _lsize       = 0;
+    _remote_size = 0;
+    _tail_lptr   = nullptr;
+    _tail_free   = 0;
+    _local_cumul_sizes.clear();
+    DASH_LOG_TRACE_VAR("Vector.deallocate >", this);
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Global Iterators
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Global iterator to the first element in the vector.
+   */
+  inline iterator begin() noexcept
+  {
+    return iterator(this, 0);
+  }
+
+  /**
+   * Global iterator to the first element in the vector.
+   */
+  inline const_iterator begin() const noexcept
+  {
+    return const_iterator(this, 0);
+  }
+
+  /**
+   * Global iterator past the last element in the vector as published in
+   * the last commit.
+   */
+  inline iterator end() noexcept
+  {
+    return iterator(this, gsize());
+  }
+
+  /**
+   * Global iterator past the last element in the vector as published in
+   * the last commit.
+   */
+  inline const_iterator end() const noexcept
+  {
+    return const_iterator(this, gsize());
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Local Iterators
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Iterator to the first local element in the vector.
+   */
+  inline local_iterator lbegin() noexcept
+  {
+    return _globmem->lbegin();
+  }
+
+  /**
+   * Iterator past the last local element in the vector.
+   */
+  inline local_iterator lend() noexcept
+  {
+    return _globmem->lbegin() + _lsize;
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Capacity
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Maximum number of elements a vector container can hold, e.g. due to
+   * system limitations.
+   * The maximum size is not guaranteed.
+   */
+  constexpr size_type max_size() const noexcept
+  {
+    return std::numeric_limits<index_type>::max();
+  }
+
+  /**
+   * The size of the vector, including local elements inserted since the
+   * last commit.
+   */
+  inline size_type size() const noexcept
+  {
+    return _remote_size + _lsize;
+  }
+
+  /**
+   * The number of elements that can be held in currently allocated storage
+   * of the vector.
+   */
+  inline size_type capacity() const noexcept
+  {
+    return _globmem != nullptr
+           ? _globmem->size()
+           : 0;
+  }
+
+  /**
+   * Whether the vector is empty.
+   */
+  inline bool empty() const noexcept
+  {
+    return size() == 0;
+  }
+
+  /**
+   * The number of elements in the local part of the vector.
+   */
+  inline size_type lsize() const noexcept
+  {
+    return _lsize;
+  }
+
+  /**
+   * The capacity of the local part of the vector.
+   */
+  inline size_type lcapacity() const noexcept
+  {
+    return _globmem != nullptr
+           ? _globmem->local_size()
+           : 0;
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // Element Access
+  //////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Global reference to the element at the given global index.
+   * Global indices are resolved from the local sizes published in the last
+   * commit.
+   *
+   * \complexity  O(log nunits + log number of buckets at the element's
+   *              unit), binary search on the published local sizes and the
+   *              unit's bucket size table
+   */
+  inline reference operator[](index_type global_index)
+  {
+    return reference(dart_gptr_at(global_index));
+  }
+
+  /**
+   * Global reference to the element at the given global index.
+   */
+  inline const_reference operator[](index_type global_index) const
+  {
+    return const_reference(dart_gptr_at(global_index));
+  }
+
+  /**
+   * Global reference to the element at the given global index, with
+   * range check.
+   *
+   * \throws  dash::exception::OutOfRange  if the index is not in the range
+   *          published in the last commit.
+   */
+  reference at(index_type global_index)
+  {
+    if (global_index < 0 ||
+        static_cast<size_type>(global_index) >= gsize()) {
+      DASH_THROW(
+        dash::exception::OutOfRange,
+        "Vector.at(): index " << global_index << " is out of range " <<
+        "[0," << gsize() << ")");
+    }
+    return (*this)[global_index];
+  }
+
+  /**
+   * Global reference to the first element in the vector.
+   */
+  inline reference front()
+  {
+    return (*this)[0];
+  }
+
+  /**
+   * Global reference to the last element in the vector.
+   */
+  inline reference back()
+  {
+    return (*this)[gsize() - 1];
+  }
+
+  /**
+   * Unit and local offset of the element at the given global index.
+   */
+  std::pair<team_unit_t, index_type> local_index_at(
+    index_type global_index) const
+  {
+    DASH_ASSERT_RANGE(
+      0, global_index, static_cast<index_type>(gsize()) - 1,
+      "Vector: global index out of range");
+    auto unit_it  = std::upper_bound(
+                      _local_cumul_sizes.begin(),
+                      _local_cumul_sizes.end(),
+                      static_cast<size_type>(global_index));
+    team_unit_t unit(std::distance(_local_cumul_sizes.begin(), unit_it));
+    index_type  l_idx = global_index;
+    if (unit > 0) {
+      l_idx -= _local_cumul_sizes[unit - 1];
+    }
+    return std::make_pair(unit, l_idx);
+  }
+
+private:
+  /**
+   * Number of elements in global index space as published in last commit.
+   */
+  inline size_type gsize() const noexcept
+  {
+    return _local_cumul_sizes.empty() ? 0 : _local_cumul_sizes.back();
+  }
+
+  /**
+   * DART global pointer to the element at the given global index.
+   */
+  dart_gptr_t dart_gptr_at(index_type global_index) const
+  {
+    DASH_LOG_TRACE_VAR("Vector.dart_gptr_at()", global_index);
+    auto l_pos = local_index_at(global_index);
+    DASH_ASSERT_LT(l_pos.first, _team->size(),
+                   "global index " << global_index << " out of range");
+    auto gptr  = _globmem->at(l_pos.first, l_pos.second).dart_gptr();
+    DASH_LOG_TRACE("Vector.dart_gptr_at >",
+                   "unit:", l_pos.first, "lidx:", l_pos.second,
+                   "gptr:", gptr);
+    return gptr;
+  }
+
+  /**
+   * Append element to the local range, allocating a new local bucket if
+   * the local capacity is exceeded.
+   */
+  inline void local_push_back(const value_type & value)
+  {
+    if (_tail_free == 0) {
+      update_tail();
+    }
+    *_tail_lptr++ = value;
+    --_tail_free;
+    ++_lsize;
+  }
+
+  template<typename... Args>
+  inline void local_emplace_back(Args &&... args)
+  {
+    if (_tail_free == 0) {
+      update_tail();
+    }
+    ::new (static_cast<void *>(_tail_lptr))
+      value_type(std::forward<Args>(args)...);
+    ++_tail_lptr;
+    --_tail_free;
+    ++_lsize;
+  }
+
+  void local_reserve(size_type lcap)
+  {
+    auto lcap_old = lcapacity();
+    if (lcap > lcap_old) {
+      DASH_LOG_TRACE("Vector.local_reserve", "globmem.grow(",
+                     lcap - lcap_old, ")");
+      _globmem->grow(lcap - lcap_old);
+      _tail_free = 0;
+    }
+  }
+
+  void local_resize(size_type lsize)
+  {
+    local_reserve(lsize);
+    _lsize     = lsize;
+    _tail_free = 0;
+  }
+
+  /**
+   * Resolve the insert position of the next local element.
+   * Increases the local capacity geometrically if it is exhausted.
+   */
+  void update_tail()
+  {
+    auto lcap = lcapacity();
+    if (_lsize == lcap) {
+      auto lcap_inc = std::max(lcap, _local_buffer_size);
+      DASH_LOG_TRACE("Vector.update_tail", "globmem.grow(", lcap_inc, ")");
+      _globmem->grow(lcap_inc);
+    }
+    // Find bucket containing local offset _lsize:
+    auto b_offset = _lsize;
+    for (auto & bucket : _globmem->local_buckets()) {
+      if (b_offset < bucket.size) {
+        _tail_lptr = bucket.lptr + b_offset;
+        _tail_free = bucket.size - b_offset;
+        return;
+      }
+      b_offset -= bucket.size;
+    }
+    DASH_THROW(dash::exception::RuntimeError,
+               "Vector.update_tail: local offset " << _lsize << " " <<
+               "exceeds local capacity " << lcapacity());
+  }
+
+};
+
+} // namespace dash
+
+#endif // DASH__VECTOR_H__INCLUDED
@@ -0,0 +1,16 @@
+#ifndef DASH__VERSION_H__INCLUDED
+#define DASH__VERSION_H__INCLUDED
+
+#define DASH_VERSION_MAJOR 0
+#define DASH_VERSION_MINOR 4
+#define DASH_VERSION_PATCH 0
+
+#define DASH_VERSION_STRING "0.4.0"
+
+#define DASH_HAVE_GIT_COMMIT 1
+
+#if defined(DASH_HAVE_GIT_COMMIT) && DASH_HAVE_GIT_COMMIT
+#define DASH_GIT_COMMIT "51dbb93"
+#endif
+
+#endif // DASH__VERSION_H__INCLUDED
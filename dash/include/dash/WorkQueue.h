@@ -0,0 +1,573 @@
+#ifndef DASH__WORK_QUEUE_H__INCLUDED
+#define DASH__WORK_QUEUE_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Team.h>
+#include <dash/Exception.h>
+#include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/Shared.h>
+
+#include <dash/algorithm/Copy.h>
+
+#include <dash/util/UnitLocality.h>
+
+#include <dash/internal/Logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+
+namespace dash {
+
+/**
+ * \defgroup  DashWorkQueueConcept  Work Queue Concept
+ * Concept of a distributed work-stealing task queue.
+ *
+ * \ingroup DashContainerConcept
+ * \{
+ * \par Description
+ *
+ * A distributed double-ended queue with a fixed local capacity at every
+ * unit. The owner of a local queue pushes and pops tasks at its tail in
+ * LIFO order without communication. Idle units steal half of the tasks
+ * available at a victim unit from the head of the victim's queue using
+ * a single remote get and atomic compare-and-swap.
+ *
+ * Every local queue is split into a private and a shared portion:
+ *
+ * \code
+ *   head           split                 tail
+ *    |  shared      |  private             |
+ *    [ t0 t1 t2 t3  | t4 t5 t6 t7 t8 t9    ] ...
+ *      ^ stolen by remote units              ^ push/pop by owner
+ * \endcode
+ *
+ * The owner releases tasks from its private portion to the shared portion
+ * once the private portion exceeds a threshold, and reacquires shared
+ * tasks when its private portion is empty.
+ * Head, split and an epoch counter of every queue are packed in a single
+ * 64 bit word, so a steal is committed by one atomic compare-and-swap and
+ * fails if the owner reacquired the victim's shared tasks in the meantime.
+ *
+ * Victims are selected randomly, alternating between units on the same
+ * node as the thief (see \c dash::util::UnitLocality) and any unit in the
+ * team. Idle units back off exponentially between unsuccessful steal
+ * attempts to reduce contention on the queue states of victims.
+ *
+ * Global termination is detected from a shared counter of active units:
+ * a unit is inactive while its queue is empty and unsuccessful steal
+ * attempts are ongoing. Tasks are either in the queue of an active unit
+ * or are transferred by a steal which keeps the thief active, so the
+ * counter value 0 implies that no tasks are left at any unit.
+ *
+ * \par Member types
+ *
+ * Type                            | Definition
+ * ------------------------------- | ----------------------------------------------------------
+ * <tt>value_type</tt>             | First template parameter <tt>ElementType</tt>
+ * <tt>size_type</tt>              | Unsigned integral type to represent queue capacities
+ *
+ * \par Member functions
+ *
+ * Function                     | Return type          | Definition
+ * ---------------------------- | -------------------- | -----------------------------------------------
+ * <b>Local operations</b>      | &nbsp;               | &nbsp;
+ * <tt>push</tt>                | <tt>void</tt>        | Add task at the tail of the local queue
+ * <tt>pop</tt>                 | <tt>bool</tt>        | Remove task from the tail of the local queue
+ * <tt>size</tt>                | <tt>size_type</tt>   | Number of tasks in the local queue
+ * <tt>capacity</tt>            | <tt>size_type</tt>   | Maximum number of tasks in the local queue
+ * <tt>empty</tt>               | <tt>bool</tt>        | Whether the local queue is empty
+ * <b>Load balancing</b>        | &nbsp;               | &nbsp;
+ * <tt>steal</tt>               | <tt>bool</tt>        | Try to steal tasks from a victim unit
+ * <tt>next</tt>                | <tt>bool</tt>        | Next task from local queue or steals, false on global termination
+ * <tt>reset</tt>               | <tt>void</tt>        | Collectively reset termination detection
+ *
+ * \par Usage
+ *
+ * \code
+ *   dash::WorkQueue<task_t> queue(capacity);
+ *   if (dash::myid() == 0) {
+ *     queue.push(root_task);
+ *   }
+ *   queue.barrier();
+ *   task_t task;
+ *   while (queue.next(task)) {
+ *     // process task, possibly push new tasks:
+ *     for (auto child : children(task)) {
+ *       queue.push(child);
+ *     }
+ *   }
+ * \endcode
+ *
+ * \}
+ */
+
+/**
+ * A distributed work-stealing task queue.
+ *
+ * \tparam  ElementType  Type of the tasks in the queue, must be trivially
+ *                       copyable.
+ *
+ * \concept{DashWorkQueueConcept}
+ */
+template<typename ElementType>
+class WorkQueue
+{
+  static_assert(std::is_trivially_copyable<ElementType>::value,
+                "Element type of dash::WorkQueue must be trivially copyable");
+
+private:
+  typedef WorkQueue<ElementType>                                    self_t;
+
+  /// Packed queue state: head, split and epoch of a unit's queue
+  typedef uint64_t                                            state_word_t;
+
+  /// Number of bits used for the head and split offsets in a state word
+  static constexpr int          offset_bits = 22;
+  /// Number of bits used for the epoch counter in a state word
+  static constexpr int          epoch_bits  = 64 - 2 * offset_bits;
+  static constexpr state_word_t offset_mask =
+                                  (state_word_t(1) << offset_bits) - 1;
+  static constexpr state_word_t epoch_mask  =
+                                  (state_word_t(1) << epoch_bits) - 1;
+  /// Maximum number of yields between unsuccessful steal attempts
+  static constexpr int          max_backoff = 64;
+
+  struct state_t {
+    state_word_t head;
+    state_word_t split;
+    state_word_t epoch;
+  };
+
+public:
+  typedef ElementType                                           value_type;
+  typedef dash::default_size_t                                   size_type;
+  typedef dash::default_index_t                                 index_type;
+
+public:
+  /**
+   * Constructor, allocates a queue with the given capacity at every unit
+   * in the team.
+   *
+   * Collective operation.
+   */
+  explicit WorkQueue(
+    /// Maximum number of tasks in the local queue of every unit.
+    size_type    local_capacity,
+    /// Team containing all units operating on the queue.
+    dash::Team & team = dash::Team::All())
+  : WorkQueue(local_capacity, 0, team)
+  { }
+
+  /**
+   * Constructor, allocates a queue with the given capacity at every unit
+   * in the team.
+   *
+   * Collective operation.
+   */
+  WorkQueue(
+    /// Maximum number of tasks in the local queue of every unit.
+    size_type    local_capacity,
+    /// Minimum number of tasks kept in the private portion of the local
+    /// queue when releasing tasks to thieves, defaults to 8.
+    size_type    release_threshold,
+    /// Team containing all units operating on the queue.
+    dash::Team & team)
+  : _team(&team),
+    _myid(team.myid()),
+    _capacity(local_capacity),
+    _release_threshold(release_threshold > 0 ? release_threshold : 8),
+    _data(local_capacity * team.size(), team),
+    _state(team.size(), team),
+    _active(static_cast<int>(team.size()), team_unit_t(0), team),
+    _rng(static_cast<std::minstd_rand::result_type>(team.myid() + 1))
+  {
+    DASH_LOG_DEBUG("WorkQueue(lcap,thresh,team)",
+                   "capacity:", local_capacity,
+                   "release threshold:", _release_threshold);
+    if (local_capacity == 0 || local_capacity > offset_mask) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "WorkQueue: local capacity must be in range " <<
+        "[1," << offset_mask << "], got " << local_capacity);
+    }
+    _lbegin = _data.lbegin();
+    _state.local[0] = dash::Atomic<state_word_t>(pack({ 0, 0, 0 }));
+    init_victims();
+    _team->barrier();
+    DASH_LOG_DEBUG("WorkQueue(lcap,thresh,team) >");
+  }
+
+  WorkQueue(const self_t & other)         = delete;
+  self_t & operator=(const self_t & other) = delete;
+
+  /**
+   * The team containing all units operating on the queue.
+   */
+  inline dash::Team & team() const noexcept
+  {
+    return *_team;
+  }
+
+  /**
+   * Maximum number of tasks in the local queue.
+   */
+  constexpr size_type capacity() const noexcept
+  {
+    return _capacity;
+  }
+
+  /**
+   * Number of tasks in the local queue, including tasks released to
+   * thieves that have not been stolen yet.
+   *
+   * Reads the local queue state atomically.
+   */
+  size_type size() const
+  {
+    return _tail - unpack(_state[_myid].get()).head;
+  }
+
+  /**
+   * Whether the local queue is empty.
+   */
+  inline bool empty() const
+  {
+    return size() == 0;
+  }
+
+  /**
+   * Adds a task at the tail of the local queue.
+   *
+   * Local operation, communication-free unless tasks are released to the
+   * shared portion of the queue.
+   *
+   * \throws  dash::exception::RuntimeError  if the local queue exceeds its
+   *          capacity.
+   *
+   * \complexity  Amortized O(1)
+   */
+  void push(const value_type & task)
+  {
+    if (_tail == _capacity) {
+      compact();
+    }
+    _lbegin[_tail++] = task;
+    if (_tail - _split >= 2 * _release_threshold) {
+      release();
+    }
+  }
+
+  /**
+   * Removes the task at the tail of the local queue.
+   * Reacquires tasks from the shared portion of the local queue if its
+   * private portion is empty.
+   *
+   * Local operation.
+   *
+   * \return  \c true if a task has been removed from the queue, \c false
+   *          if the local queue is empty.
+   */
+  bool pop(value_type & task)
+  {
+    if (_tail == _split && !reacquire()) {
+      return false;
+    }
+    task = _lbegin[--_tail];
+    return true;
+  }
+
+  /**
+   * Tries to steal tasks from another unit and moves them to the local
+   * queue.
+   * Steals half of the tasks in the shared portion of the victim's queue.
+   *
+   * One-sided operation.
+   *
+   * \return  \c true if at least one task has been stolen.
+   */
+  bool steal()
+  {
+    if (_team->size() < 2) {
+      return false;
+    }
+    return steal_from(next_victim());
+  }
+
+  /**
+   * Retrieves the next task to process from the local queue, or from
+   * other units if the local queue is empty.
+   * Blocks until a task could be obtained or all units terminated.
+   *
+   * Must be called by all units in the team until it returns \c false.
+   *
+   * \return  \c true if a task has been retrieved, \c false if the queues
+   *          of all units are empty and no unit is processing tasks.
+   */
+  bool next(value_type & task)
+  {
+    if (pop(task)) {
+      return true;
+    }
+    if (_team->size() < 2) {
+      return false;
+    }
+    // Local queue is empty, this unit becomes inactive:
+    auto active = _active.get();
+    active.sub(1);
+    DASH_LOG_TRACE("WorkQueue.next", "unit inactive");
+    int backoff = 1;
+    while (true) {
+      auto victim = next_victim();
+      if (!unpack_empty(_state[victim].get())) {
+        // Tasks observed at victim, become active before stealing so
+        // stolen tasks are accounted for as long as they are in transit:
+        active.add(1);
+        if (steal_from(victim)) {
+          DASH_LOG_TRACE("WorkQueue.next", "unit active, stole from",
+                         victim);
+          return pop(task);
+        }
+        active.sub(1);
+      }
+      if (active.get() == 0) {
+        DASH_LOG_TRACE("WorkQueue.next >", "global termination");
+        return false;
+      }
+      for (int i = 0; i < backoff; ++i) {
+        std::this_thread::yield();
+      }
+      if (backoff < max_backoff) {
+        backoff *= 2;
+      }
+    }
+  }
+
+  /**
+   * Resets termination detection so the queue can be used for another
+   * round of tasks after \c next returned \c false at all units.
+   *
+   * Collective operation.
+   */
+  void reset()
+  {
+    _team->barrier();
+    if (_myid == 0) {
+      _active.set(static_cast<int>(_team->size()));
+    }
+    _team->barrier();
+  }
+
+  /**
+   * Synchronizes all units operating on the queue.
+   *
+   * Collective operation.
+   */
+  inline void barrier()
+  {
+    _team->barrier();
+  }
+
+private:
+  static inline state_word_t pack(const state_t & s) noexcept
+  {
+    return (s.head & offset_mask) |
+           ((s.split & offset_mask) << offset_bits) |
+           ((s.epoch & epoch_mask)  << (2 * offset_bits));
+  }
+
+  static inline state_t unpack(state_word_t w) noexcept
+  {
+    return state_t {
+             w & offset_mask,
+             (w >> offset_bits) & offset_mask,
+             (w >> (2 * offset_bits)) & epoch_mask };
+  }
+
+  static inline bool unpack_empty(state_word_t w) noexcept
+  {
+    auto s = unpack(w);
+    return s.split == s.head;
+  }
+
+  /**
+   * Moves half of the tasks in the private portion of the local queue to
+   * its shared portion.
+   */
+  void release()
+  {
+    auto lstate = _state[_myid];
+    while (true) {
+      auto w = lstate.get();
+      auto s = unpack(w);
+      DASH_ASSERT_EQ(s.split, _split, "split modified by remote unit");
+      state_t s_new = s;
+      s_new.split   = _split + (_tail - _split) / 2;
+      if (lstate.compare_exchange(w, pack(s_new))) {
+        DASH_LOG_TRACE("WorkQueue.release",
+                       "split:", _split, "->", s_new.split);
+        _split = s_new.split;
+        return;
+      }
+    }
+  }
+
+  /**
+   * Moves all tasks in the shared portion of the local queue to its
+   * private portion.
+   * Increments the epoch so concurrent steals of these tasks fail.
+   *
+   * \return  \c true if at least one task has been reacquired.
+   */
+  bool reacquire()
+  {
+    auto lstate = _state[_myid];
+    while (true) {
+      auto w = lstate.get();
+      auto s = unpack(w);
+      if (s.split == s.head) {
+        return false;
+      }
+      state_t s_new = s;
+      s_new.split   = s.head;
+      s_new.epoch   = s.epoch + 1;
+      if (lstate.compare_exchange(w, pack(s_new))) {
+        DASH_LOG_TRACE("WorkQueue.reacquire",
+                       "split:", _split, "->", s_new.split);
+        _split = s_new.split;
+        return true;
+      }
+    }
+  }
+
+  /**
+   * Moves all tasks to the beginning of the local buffer.
+   */
+  void compact()
+  {
+    reacquire();
+    auto lstate = _state[_myid];
+    auto s      = unpack(lstate.get());
+    if (s.head == 0) {
+      DASH_THROW(
+        dash::exception::RuntimeError,
+        "WorkQueue.push: local capacity " << _capacity << " exceeded");
+    }
+    // Shared portion is empty, remote units do not access the buffer:
+    auto nlocal = _tail - s.head;
+    std::memmove(_lbegin, _lbegin + s.head, nlocal * sizeof(value_type));
+    _tail  = nlocal;
+    _split = 0;
+    lstate.set(pack({ 0, 0, s.epoch + 1 }));
+    DASH_LOG_TRACE("WorkQueue.compact", "local tasks:", nlocal);
+  }
+
+  /**
+   * Steal half of the tasks in the shared portion of the victim's queue.
+   */
+  bool steal_from(team_unit_t victim)
+  {
+    auto vstate = _state[victim];
+    auto w      = vstate.get();
+    auto s      = unpack(w);
+    if (s.split == s.head) {
+      return false;
+    }
+    auto nsteal = (s.split - s.head + 1) / 2;
+    _steal_buf.resize(nsteal);
+    // Read tasks before committing the steal, the read is discarded if
+    // the victim's state changed in the meantime:
+    auto gfirst = _data.begin() + (victim.id * _capacity + s.head);
+    dash::copy(gfirst, gfirst + nsteal, _steal_buf.data());
+    state_t s_new = s;
+    s_new.head   += nsteal;
+    if (!vstate.compare_exchange(w, pack(s_new))) {
+      DASH_LOG_TRACE("WorkQueue.steal_from", "steal from", victim,
+                     "failed");
+      return false;
+    }
+    DASH_LOG_TRACE("WorkQueue.steal_from", "stole", nsteal,
+                   "tasks from", victim);
+    for (const auto & task : _steal_buf) {
+      push(task);
+    }
+    return true;
+  }
+
+  /**
+   * Determine units on the same node as the calling unit.
+   */
+  void init_victims()
+  {
+    auto nunits = _team->size();
+    if (nunits < 2) {
+      return;
+    }
+    std::string myhost = dash::util::UnitLocality(*_team, _myid).host();
+    for (team_unit_t u{0}; u < nunits; ++u) {
+      if (u != _myid &&
+          dash::util::UnitLocality(*_team, u).host() == myhost) {
+        _node_victims.push_back(u);
+      }
+    }
+    DASH_LOG_TRACE("WorkQueue.init_victims",
+                   "units on same node:", _node_victims.size());
+  }
+
+  /**
+   * Random victim, alternating between units on the same node and any
+   * unit in the team.
+   */
+  team_unit_t next_victim()
+  {
+    ++_num_steal_attempts;
+    if (!_node_victims.empty() && (_num_steal_attempts % 2 == 1)) {
+      std::uniform_int_distribution<size_type> dist(
+                                                 0, _node_victims.size() - 1);
+      return _node_victims[dist(_rng)];
+    }
+    std::uniform_int_distribution<size_type> dist(0, _team->size() - 2);
+    team_unit_t victim(dist(_rng));
+    if (victim >= _myid) {
+      ++victim;
+    }
+    return victim;
+  }
+
+private:
+  typedef dash::Array<value_type>                              data_array;
+  typedef dash::Array<dash::Atomic<state_word_t>>             state_array;
+
+  dash::Team                     * _team;
+  team_unit_t                      _myid;
+  size_type                        _capacity;
+  size_type                        _release_threshold;
+  /// Task buffers of all units, local capacity elements per unit.
+  data_array                       _data;
+  /// Packed head, split and epoch of the queues of all units.
+  state_array                      _state;
+  /// Number of units that are processing tasks.
+  dash::Shared<dash::Atomic<int>>  _active;
+  /// Native pointer to the local task buffer.
+  value_type                     * _lbegin = nullptr;
+  /// Offset of the first task in the private portion of the local queue.
+  size_type                        _split  = 0;
+  /// Offset past the last task in the local queue.
+  size_type                        _tail   = 0;
+  /// Units on the same node as the calling unit.
+  std::vector<team_unit_t>         _node_victims;
+  size_type                        _num_steal_attempts = 0;
+  std::minstd_rand                 _rng;
+  std::vector<value_type>          _steal_buf;
+};
+
+} // namespace dash
+
+#endif // DASH__WORK_QUEUE_H__INCLUDED
@@ -3,6 +3,9 @@
 
 #include <dash/iterator/GlobIter.h>
 #include <dash/algorithm/Find.h>
+#include <dash/Future.h>
+
+#include <memory>
 
 
 namespace dash {
@@ -32,6 +35,44 @@ bool all_of(
   return find_if_not(first, last, p) == last;
 }
 
+/**
+ * Asynchronous variant of \c dash::all_of.
+ *
+ * Collective operation.
+ *
+ * \returns A \c dash::Future providing \c true if all elements satisfy \c p,
+ *          \c false otherwise.
+ *
+ * \see dash::all_of
+ * \see dash::find_if_not_async
+ * \ingroup DashAlgorithms
+ */
+template<
+  typename GlobIter,
+  typename UnaryPredicate>
+dash::Future<bool> all_of_async(
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Predicate applied to the elements in range [first, last)
+  UnaryPredicate p)
+{
+  auto fut_found = std::make_shared<dash::Future<GlobIter>>(
+                     find_if_not_async(first, last, p));
+  return dash::Future<bool>(
+    [fut_found, last]() {
+      return fut_found->get() == last;
+    },
+    [fut_found, last](bool * result) {
+      if (fut_found->test()) {
+        *result = (fut_found->get() == last);
+        return true;
+      }
+      return false;
+    });
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__ALL_OF_H__
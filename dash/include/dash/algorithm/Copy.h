@@ -11,8 +11,13 @@
 #include <algorithm>
 #include <future>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
+// Maximum number of pending transfers issued by a unit in a global-to-global
+// copy before waiting for their completion
+#define COPY_MAX_PENDING_TRANSFERS 64
+
 namespace dash {
 
 #ifdef DOXYGEN
@@ -23,6 +28,9 @@ namespace dash {
  *
  * In terms of data distribution, source and destination ranges passed to
  * \c dash::copy can be local (\c *ValueType) or global (\c GlobIter<ValueType>).
+ * If both ranges are global, every unit transfers the elements of the input
+ * range in its local memory and \c dash::copy is a collective operation on
+ * the team of the input range.
  *
  * For a non-blocking variant of \c dash::copy, see \c dash::copy_async.
  *
@@ -321,6 +329,127 @@ GlobOutputIt copy_impl(
   return out_last;
 }
 
+// =========================================================================
+// Global to Global
+// =========================================================================
+
+/**
+ * Waits for the remote completion of pending transfers in \c handles.
+ */
+inline void copy_waitall(std::vector<dart_handle_t> & handles)
+{
+  if (handles.empty()) {
+    return;
+  }
+  if (dart_waitall(handles.data(), handles.size()) != DART_OK) {
+    DASH_LOG_ERROR("dash::copy_waitall", "dart_waitall failed");
+    DASH_THROW(
+      dash::exception::RuntimeError,
+      "dash::copy_waitall: dart_waitall failed");
+  }
+  handles.clear();
+}
+
+/**
+ * Implementation of \c dash::copy (global to global).
+ *
+ * Every unit only transfers the elements of the input range in its local
+ * memory: for every contiguous local chunk of the input range, the
+ * overlapping contiguous chunks of the output range are written from local
+ * memory, without intermediate buffers.
+ * At most \c max_pending transfers are pending at any time, the unit waits
+ * for their completion before issuing further transfers.
+ * Transfers still pending on return are appended to \c handles.
+ */
+template <
+  typename GlobInputIt,
+  typename GlobOutputIt,
+  typename = typename std::enable_if<
+               dash::detail::is_global_iterator<GlobOutputIt>::value
+             >::type >
+GlobOutputIt copy_impl(
+  GlobInputIt                  in_first,
+  GlobInputIt                  in_last,
+  GlobOutputIt                 out_first,
+  std::vector<dart_handle_t> * handles,
+  size_t                       max_pending = COPY_MAX_PENDING_TRANSFERS)
+{
+  DASH_LOG_TRACE("dash::copy_impl() global -> global",
+                 "in_first:",  in_first.pos(),
+                 "in_last:",   in_last.pos(),
+                 "out_first:", out_first.pos());
+  typedef typename GlobInputIt::size_type   size_type;
+  typedef typename GlobInputIt::value_type  input_value_type;
+  typedef typename GlobOutputIt::value_type output_value_type;
+
+  static_assert(is_dash_copyable<input_value_type, output_value_type>::value,
+                "dash::copy can only be used on same-size arithmetic types or "
+                "same non-arithmetic types");
+
+  const size_type num_elem_total = dash::distance(in_first, in_last);
+  if (num_elem_total <= 0) {
+    DASH_LOG_TRACE("dash::internal::copy_impl", "input range empty");
+    return out_first;
+  }
+  auto out_last = out_first + num_elem_total;
+
+  std::vector<local_copy_chunk<input_value_type, output_value_type>>
+    local_chunks;
+  size_type num_elem_local = 0;
+
+  ContiguousRangeSet<GlobInputIt> in_range_set{in_first, in_last};
+
+  for (auto in_range : in_range_set) {
+    auto cur_in = in_range.first;
+    // Input elements are transferred by the unit owning them:
+    if (!cur_in.is_local()) {
+      continue;
+    }
+    const input_value_type * src_ptr = cur_in.local();
+    auto cur_out = out_first + dash::distance(in_first, cur_in);
+
+    ContiguousRangeSet<GlobOutputIt> out_range_set{
+      cur_out, cur_out + in_range.second };
+
+    for (auto out_range : out_range_set) {
+      auto cur_out_first = out_range.first;
+      auto num_copy_elem = out_range.second;
+
+      DASH_ASSERT_GT(num_copy_elem, 0, "Number of elements to copy is 0");
+      if (cur_out_first.is_local()) {
+        output_value_type * dest_ptr = cur_out_first.local();
+        if (DASH__ARCH__PAGE_SIZE > num_copy_elem*sizeof(input_value_type)) {
+          std::copy(src_ptr, src_ptr + num_copy_elem, dest_ptr);
+        } else {
+          // larger chunks are handled later to allow overlap
+          local_chunks.push_back({src_ptr, dest_ptr, num_copy_elem});
+        }
+      } else {
+        auto dst_gptr = cur_out_first.dart_gptr();
+        DASH_LOG_TRACE("dash::copy_impl", "src_ptr", src_ptr,
+                       "dst_gptr", dst_gptr, "num_copy_elem", num_copy_elem);
+        if (handles->size() >= max_pending) {
+          copy_waitall(*handles);
+        }
+        dart_handle_t handle;
+        dash::internal::put_handle(dst_gptr, src_ptr, num_copy_elem, &handle);
+        if (handle != DART_HANDLE_NULL) {
+          handles->push_back(handle);
+        }
+      }
+      src_ptr        += num_copy_elem;
+      num_elem_local += num_copy_elem;
+    }
+  }
+
+  do_local_copies(local_chunks);
+
+  DASH_LOG_TRACE("dash::copy_impl >",
+                 "local elements copied:", num_elem_local,
+                 "pending transfers:",     handles->size());
+  return out_last;
+}
+
 } // namespace internal
 
 
@@ -629,25 +758,143 @@ copy_async(
 }
 #endif
 
+// =========================================================================
+// Global to Global, Distributed Ranges
+// =========================================================================
+
+/**
+ * Variant of \c dash::copy as asynchronous global-to-global copy operation.
+ *
+ * Every unit transfers the elements of the input range in its local
+ * memory, so all units in the team of the input range have to call the
+ * operation.
+ * The returned future completes when the transfers of the calling unit
+ * are completed. The output range is complete when the futures of all
+ * units are completed, e.g. after waiting for the future and a barrier.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  typename = typename std::enable_if<
+               dash::detail::is_global_iterator<GlobInputIt>::value &&
+               dash::detail::is_global_iterator<GlobOutputIt>::value
+             >::type >
+dash::Future<GlobOutputIt> copy_async(
+  GlobInputIt  in_first,
+  GlobInputIt  in_last,
+  GlobOutputIt out_first)
+{
+  DASH_LOG_TRACE("dash::copy_async()", "async, global to global");
+  if (in_first == in_last) {
+    DASH_LOG_TRACE("dash::copy_async", "input range empty");
+    return dash::Future<GlobOutputIt>(out_first);
+  }
+
+  auto handles  = std::make_shared<std::vector<dart_handle_t>>();
+  auto out_last = dash::internal::copy_impl(in_first,
+                                            in_last,
+                                            out_first,
+                                            handles.get());
+  if (handles->empty()) {
+    return dash::Future<GlobOutputIt>(out_last);
+  }
+  return dash::Future<GlobOutputIt>(
+    // get
+    [=]() mutable {
+      dash::internal::copy_waitall(*handles);
+      return out_last;
+    },
+    // test
+    [=](GlobOutputIt *out) mutable {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_testall(handles->data(), handles->size(), &flag), DART_OK);
+      if (flag) {
+        handles->clear();
+        *out = out_last;
+      }
+      return (flag != 0);
+    },
+    // destroy
+    [=]() mutable {
+      for (auto& handle : *handles) {
+        DASH_ASSERT_RETURNS(
+          dart_handle_free(&handle), DART_OK);
+      }
+    }
+  );
+}
+
 /**
  * Specialization of \c dash::copy as global-to-global blocking copy
  * operation.
  *
+ * Input and output ranges may have different distributions, e.g. to
+ * redistribute a blocked range to a tiled range.
+ * Every unit transfers the elements of the input range in its local memory
+ * directly to their destination, so this is a collective operation on the
+ * team of the input range.
+ *
+ * Example:
+ *
+ * \code
+ *     dash::Array<double> blocked(n, dash::BLOCKED);
+ *     dash::Array<double> cyclic(n, dash::CYCLIC);
+ *     // ...
+ *     dash::copy(blocked.begin(), blocked.end(), cyclic.begin());
+ * \endcode
+ *
  * \ingroup  DashAlgorithms
  */
-template <typename ValueType, class GlobInputIt, class GlobOutputIt>
+template <
+  class GlobInputIt,
+  class GlobOutputIt,
+  typename = typename std::enable_if<
+               dash::detail::is_global_iterator<GlobInputIt>::value &&
+               dash::detail::is_global_iterator<GlobOutputIt>::value
+             >::type >
 GlobOutputIt copy(
-    GlobInputIt /*in_first*/,
-    GlobInputIt /*in_last*/,
-    GlobOutputIt /*out_first*/)
+  GlobInputIt  in_first,
+  GlobInputIt  in_last,
+  GlobOutputIt out_first)
 {
   DASH_LOG_TRACE("dash::copy()", "blocking, global to global");
 
-  // TODO:
-  // - Implement adapter for local-to-global dash::copy here
-  // - Return if global input range has no local sub-range
+  std::vector<dart_handle_t> handles;
+  auto out_last = dash::internal::copy_impl(in_first,
+                                            in_last,
+                                            out_first,
+                                            &handles);
+  DASH_LOG_TRACE("dash::copy", "Waiting for remote transfers to complete,",
+                 "num_handles: ", handles.size());
+  dash::internal::copy_waitall(handles);
+  // Wait for the transfers of all units:
+  in_first.pattern().team().barrier();
+  return out_last;
+}
 
-  return GlobOutputIt();
+/**
+ * Specialization of \c dash::copy as global-to-global blocking copy
+ * operation with explicit value type.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  typename ValueType,
+  class GlobInputIt,
+  class GlobOutputIt,
+  typename = typename std::enable_if<
+               dash::detail::is_global_iterator<GlobInputIt>::value &&
+               dash::detail::is_global_iterator<GlobOutputIt>::value
+             >::type >
+GlobOutputIt copy(
+  GlobInputIt  in_first,
+  GlobInputIt  in_last,
+  GlobOutputIt out_first)
+{
+  return dash::copy(in_first, in_last, out_first);
 }
 
 #endif // DOXYGEN
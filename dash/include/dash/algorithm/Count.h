@@ -0,0 +1,153 @@
+#ifndef DASH__ALGORITHM__COUNT_H__
+#define DASH__ALGORITHM__COUNT_H__
+
+#include <dash/Execution.h>
+#include <dash/algorithm/LocalRange.h>
+#include <dash/iterator/GlobIter.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <iterator>
+
+
+namespace dash {
+
+/**
+ * Returns the number of elements in the range \c [first,last) that satisfy
+ * the predicate \c p, with the local elements of every unit processed as
+ * specified by the execution policy.
+ *
+ * Collective operation.
+ *
+ * \see dash::execution
+ *
+ * \complexity  O(d) + O(nl), with \c d dimensions in the global iterators'
+ *              pattern and \c nl local elements within the global range
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobInputIt,
+  class UnaryPredicate,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+typename dash::iterator_traits<GlobInputIt>::difference_type
+count_if(
+  /// Execution policy for the local elements
+  ExecutionPolicy&& policy,
+  /// Iterator to the initial position in the sequence
+  GlobInputIt       first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt       last,
+  /// Predicate which will be applied to the elements in range [first, last)
+  UnaryPredicate    predicate)
+{
+  using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  using difference_t    = typename iterator_traits::difference_type;
+  static_assert(
+      iterator_traits::is_global_iterator::value,
+      "must be a global iterator");
+
+  auto & team   = first.pattern().team();
+  auto   lrange = dash::local_range(first, last);
+  auto   lfirst = lrange.begin;
+
+  unsigned long long l_count = dash::internal::execution_count_if(
+      policy, std::distance(lrange.begin, lrange.end),
+      [lfirst, &predicate](size_t i) { return predicate(lfirst[i]); });
+  unsigned long long g_count = 0;
+
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(
+      &l_count,
+      &g_count,
+      1,
+      DART_TYPE_ULONGLONG,
+      DART_OP_SUM,
+      team.dart_id()),
+    DART_OK);
+  return static_cast<difference_t>(g_count);
+}
+
+/**
+ * Returns the number of elements in the range \c [first,last) that satisfy
+ * the predicate \c p.
+ *
+ * Collective operation.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename GlobInputIt,
+  class UnaryPredicate>
+typename dash::iterator_traits<GlobInputIt>::difference_type
+count_if(
+  /// Iterator to the initial position in the sequence
+  GlobInputIt       first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt       last,
+  /// Predicate which will be applied to the elements in range [first, last)
+  UnaryPredicate    predicate)
+{
+  return dash::count_if(dash::execution::seq, first, last, predicate);
+}
+
+/**
+ * Returns the number of elements in the range \c [first,last) that compare
+ * equal to \c value, with the local elements of every unit processed as
+ * specified by the execution policy.
+ *
+ * Collective operation.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobInputIt,
+  typename ElementType,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+typename dash::iterator_traits<GlobInputIt>::difference_type
+count(
+  /// Execution policy for the local elements
+  ExecutionPolicy&&   policy,
+  /// Iterator to the initial position in the sequence
+  GlobInputIt         first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt         last,
+  /// Value to count using operator==
+  const ElementType & value)
+{
+  using value_t = typename dash::iterator_traits<GlobInputIt>::value_type;
+  return dash::count_if(
+      policy, first, last,
+      [&value](const value_t & v) { return v == value; });
+}
+
+/**
+ * Returns the number of elements in the range \c [first,last) that compare
+ * equal to \c value.
+ *
+ * Collective operation.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  typename GlobInputIt,
+  typename ElementType>
+typename dash::iterator_traits<GlobInputIt>::difference_type
+count(
+  /// Iterator to the initial position in the sequence
+  GlobInputIt         first,
+  /// Iterator to the final position in the sequence
+  GlobInputIt         last,
+  /// Value to count using operator==
+  const ElementType & value)
+{
+  return dash::count(dash::execution::seq, first, last, value);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__COUNT_H__
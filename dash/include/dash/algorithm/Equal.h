@@ -1,86 +1,105 @@
 #ifndef DASH__ALGORITHM__EQUAL_H__
 #define DASH__ALGORITHM__EQUAL_H__
 
+#include <dash/Execution.h>
+#include <dash/Future.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
 #include <dash/dart/if/dart_communication.h>
 #include <dash/iterator/GlobIter.h>
 
 namespace dash {
 namespace internal {
-  template<typename Ptr>
-  inline char equal_loc_impl(
-      const Ptr & l_first_1,
-      const Ptr & l_last_1,
-      const Ptr & l_first_2){
-    return static_cast<char>(std::equal(l_first_1, l_last_1, l_first_2));
-  }
-  template<typename Ptr, typename BinaryPredicate>
-  inline char equal_loc_impl(
-      const Ptr & l_first_1,
-      const Ptr & l_last_1,
-      const Ptr & l_first_2,
-      BinaryPredicate pred){
-    return static_cast<char>(std::equal(l_first_1, l_last_1, l_first_2, pred));
-  }
-
-  template<typename GlobIter>
-  char equal_overlapping_impl(
-      const GlobIter & first_1,
-      const GlobIter & last_1,
-      const GlobIter & first_2){
-    auto loc_idx_r   = dash::local_index_range(first_1, last_1);
-    auto dist        = loc_idx_r.end - loc_idx_r.begin;
-    auto git_beg_idx = first_1.pattern().global(loc_idx_r.begin);
-    auto offset      = git_beg_idx - first_1.gpos();
-    auto glfirst_1   = first_1+offset;  // globIt to first pos
-
-    // TODO: This should work for one-local-block ranges, but does not
-    // KNOWN ISSUE
-    return std::equal(glfirst_1, glfirst_1+dist, first_2+offset);
-  }
-  }  // namespace internal
 
   /**
-   * Returns true if the range \c [first1, last1) is equal to the range
-   * \c [first2, first2 + (last1 - first1)), and false otherwise.
+   * Compares the local elements in the range \c [first_1, last_1) to the
+   * corresponding elements in the range starting at \c first_2.
    *
-   * \ingroup     DashAlgorithms
+   * If both ranges have the same distribution and offset, the elements
+   * are compared in local memory as specified by the execution policy.
+   * Otherwise, the local elements are compared to the respective global
+   * elements of the second range.
    */
-  template <typename GlobIter>
-  bool equal(
-      /// Iterator to the initial position in the sequence
-      GlobIter first_1,
-      /// Iterator to the final position in the sequence
-      GlobIter last_1,
-      GlobIter first_2)
-  {
-    static_assert(
-        dash::iterator_traits<GlobIter>::is_global_iterator::value,
-        "invalid iterator: Need to be a global iterator");
-
-    auto& team = first_1.team();
-    auto  myid = team.myid();
-    // Global iterators to local range:
-    auto index_range_in  = dash::local_range(first_1, last_1);
-    auto l_first_1       = index_range_in.begin;
-    auto l_last_1        = index_range_in.end;
-    auto dist            = std::distance(l_first_1, l_last_1);
-    auto index_range_out = dash::local_range(first_2, first_2 + dist);
-    auto common_dist     = std::min(
-        std::distance(index_range_out.begin, index_range_out.end), dist);
-    char l_result = 1;
-
-    // check if local ranges are corresponding
-    if (common_dist == dist) {
-      l_result = ::dash::internal::equal_loc_impl(
-          l_first_1, l_last_1, first_2.local());
-    } else if(common_dist > 0) {
-    l_result = ::dash::internal::equal_overlapping_impl(
-        first_1, last_1, first_2);
+  template<typename ExecutionPolicy, typename GlobIter, class BinaryPredicate>
+  char equal_local_result(
+      ExecutionPolicy && policy,
+      const GlobIter   & first_1,
+      const GlobIter   & last_1,
+      const GlobIter   & first_2,
+      BinaryPredicate    pred){
+    auto & pattern     = first_1.pattern();
+    auto   myid        = pattern.team().myid();
+    auto   index_range = dash::local_index_range(first_1, last_1);
+    auto   dist        = index_range.end - index_range.begin;
+    if (dist == 0) {
+      return 1;
+    }
+    // Pointer to first element in local range:
+    auto const * l_first_1 = dash::local_begin(
+        static_cast<typename GlobIter::const_pointer>(first_1), myid)
+        + index_range.begin;
+
+    if (pattern        == first_2.pattern() &&
+        first_1.gpos() == first_2.gpos()) {
+      // local ranges are corresponding
+      auto const * l_first_2 = dash::local_begin(
+          static_cast<typename GlobIter::const_pointer>(first_2), myid)
+          + index_range.begin;
+      auto l_mismatch = dash::internal::execution_find_first(
+          policy, dist,
+          [l_first_1, l_first_2, &pred](size_t i) {
+            return !pred(l_first_1[i], l_first_2[i]);
+          });
+      return static_cast<char>(l_mismatch == static_cast<size_t>(dist));
+    }
+
+    using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+    auto g_offset = first_1.gpos();
+    for (decltype(dist) i = 0; i < dist; ++i) {
+      auto    g_index = pattern.global(index_range.begin + i);
+      value_t value_2 = first_2[g_index - g_offset];
+      if (!pred(l_first_1[i], value_2)) {
+        return 0;
+      }
+    }
+    return 1;
   }
+} // namespace internal
+
+/**
+ * Returns true if the range \c [first1, last1) is equal to the range
+ * \c [first2, first2 + (last1 - first1)) with respect to a specified
+ * predicate, and false otherwise. Local elements of every unit are compared
+ * as specified by the execution policy.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobIter,
+  class BinaryPredicate,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+bool equal(
+    /// Execution policy for the local elements
+    ExecutionPolicy&& policy,
+    /// Iterator to the initial position in the sequence
+    GlobIter first_1,
+    /// Iterator to the final position in the sequence
+    GlobIter last_1,
+    GlobIter first_2,
+    BinaryPredicate pred)
+{
+  static_assert(
+      dash::iterator_traits<GlobIter>::is_global_iterator::value,
+      "invalid iterator: Need to be a global iterator");
 
-  char r_result         = 0;
+  auto & team     = first_1.team();
+  char   l_result = ::dash::internal::equal_local_result(
+                      policy, first_1, last_1, first_2, pred);
+  char   r_result = 0;
 
   DASH_ASSERT_RETURNS(
     dart_allreduce(&l_result, &r_result, 1,
@@ -89,6 +108,51 @@ namespace internal {
   return r_result;
 }
 
+/**
+ * Returns true if the range \c [first1, last1) is equal to the range
+ * \c [first2, first2 + (last1 - first1)), and false otherwise. Local
+ * elements of every unit are compared as specified by the execution policy.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobIter,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+bool equal(
+    /// Execution policy for the local elements
+    ExecutionPolicy&& policy,
+    /// Iterator to the initial position in the sequence
+    GlobIter first_1,
+    /// Iterator to the final position in the sequence
+    GlobIter last_1,
+    GlobIter first_2)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+  return dash::equal(
+      policy, first_1, last_1, first_2,
+      [](const value_t & a, const value_t & b) { return a == b; });
+}
+
+/**
+ * Returns true if the range \c [first1, last1) is equal to the range
+ * \c [first2, first2 + (last1 - first1)), and false otherwise.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIter>
+bool equal(
+    /// Iterator to the initial position in the sequence
+    GlobIter first_1,
+    /// Iterator to the final position in the sequence
+    GlobIter last_1,
+    GlobIter first_2)
+{
+  return dash::equal(dash::execution::seq, first_1, last_1, first_2);
+}
+
 /**
  * Returns true if the range \c [first1, last1) is equal to the range
  * \c [first2, first2 + (last1 - first1)) with respect to a specified
@@ -103,38 +167,75 @@ bool equal(
     /// Iterator to the final position in the sequence
     GlobIter last_1,
     GlobIter first_2,
-    BinaryPredicate /*pred*/)
+    BinaryPredicate pred)
+{
+  return dash::equal(dash::execution::seq, first_1, last_1, first_2, pred);
+}
+
+/**
+ * Asynchronous variant of \c dash::equal.
+ * Compares the local elements and starts a non-blocking reduction of the
+ * local results of all units.
+ *
+ * Collective operation.
+ *
+ * \returns  A \c dash::Future providing \c true if the ranges are equal
+ *           with respect to \c pred, and \c false otherwise.
+ *
+ * \see dash::equal
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIter, class BinaryPredicate>
+dash::Future<bool> equal_async(
+    /// Iterator to the initial position in the sequence
+    GlobIter first_1,
+    /// Iterator to the final position in the sequence
+    GlobIter last_1,
+    GlobIter first_2,
+    BinaryPredicate pred)
 {
   static_assert(
       dash::iterator_traits<GlobIter>::is_global_iterator::value,
       "invalid iterator: Need to be a global iterator");
 
-  auto & team        = first_1.team();
-  auto myid          = team.myid();
-  // Global iterators to local range:
-  auto index_range_in   = dash::local_range(first_1, last_1);
-  auto l_first_1        = index_range_in.begin;
-  auto l_last_1         = index_range_in.end;
-  auto dist             = std::distance(l_first_1, l_last_1);
-  auto index_range_out  = dash::local_range(first_2, first_2 + dist);
-  auto common_dist      = std::min(std::distance(index_range_out.begin, index_range_out.end),dist);
-  char l_result         = 1;
-
-  // check if local ranges are corresponding
-  if(std::distance(index_range_out.begin, index_range_out.end) == dist){
-    l_result = ::dash::internal::equal_loc_impl(l_first_1, l_last_1, first_2.local());
-  } else if(common_dist > 0) {
-    l_result = ::dash::internal::equal_overlapping_impl(
-        first_1, last_1, first_2);
-  }
-
-  char r_result      = 0;
+  auto & team = first_1.team();
+  dash::internal::local_result<char> l_result;
+  l_result.value = ::dash::internal::equal_local_result(
+                     dash::execution::seq, first_1, last_1, first_2, pred);
+  l_result.valid = true;
+
+  return dash::internal::reduce_local_results_async<bool>(
+           l_result, dash::bit_and<char>(), true, team,
+           [](const dash::internal::local_result<char> & g_result) {
+             return g_result.value != 0;
+           });
+}
 
-  DASH_ASSERT_RETURNS(
-    dart_allreduce(&l_result, &r_result, 1,
-      DART_TYPE_BYTE, DART_OP_BAND, team.dart_id()),
-    DART_OK);
-  return r_result;
+/**
+ * Asynchronous variant of \c dash::equal.
+ *
+ * Collective operation.
+ *
+ * \returns  A \c dash::Future providing \c true if the ranges are equal,
+ *           and \c false otherwise.
+ *
+ * \see dash::equal
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIter>
+dash::Future<bool> equal_async(
+    /// Iterator to the initial position in the sequence
+    GlobIter first_1,
+    /// Iterator to the final position in the sequence
+    GlobIter last_1,
+    GlobIter first_2)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+  return dash::equal_async(
+      first_1, last_1, first_2,
+      [](const value_t & a, const value_t & b) { return a == b; });
 }
 
 } // namespace dash
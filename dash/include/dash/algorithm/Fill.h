@@ -3,6 +3,7 @@
 
 #include <dash/internal/Config.h>
 
+#include <dash/Execution.h>
 #include <dash/iterator/GlobIter.h>
 
 #include <dash/algorithm/LocalRange.h>
@@ -63,6 +64,36 @@ void fill(
 #endif
 }
 
+/**
+ * Assigns the given value to the elements in the range [first, last),
+ * with the local elements of every unit processed as specified by the
+ * execution policy.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobIterType,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+void fill(
+  /// Execution policy for the local elements
+  ExecutionPolicy&&   policy,
+  /// Iterator to the initial position in the sequence
+  GlobIterType        first,
+  /// Iterator to the final position in the sequence
+  GlobIterType        last,
+  /// Value which will be assigned to the elements in range [first, last)
+  const typename GlobIterType::value_type & value)
+{
+  auto index_range = dash::local_range(first, last);
+  auto lfirst      = index_range.begin;
+  dash::internal::execution_for(
+    policy, std::distance(index_range.begin, index_range.end),
+    [lfirst, &value](size_t i) { lfirst[i] = value; });
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__FILL_H__
@@ -2,40 +2,39 @@
 #define DASH__ALGORITHM__FIND_H__
 
 #include <dash/Array.h>
+#include <dash/Execution.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
 #include <dash/dart/if/dart_communication.h>
 #include <dash/iterator/GlobIter.h>
+#include <dash/Future.h>
+
+#include <limits>
 
 namespace dash {
 
+namespace internal {
+
 /**
- * Returns an iterator to the first element in the range \c [first,last) that
- * compares equal to \c val.
- * If no such element is found, the function returns \c last.
- *
- * \ingroup     DashAlgorithms
+ * Global index of the first element in the local portion of the range
+ * \c [first,last) found by \c local_find, or the maximum index value if
+ * there is no such element.
  */
 template<
   typename GlobIter,
-  typename ElementType>
-GlobIter find(
+  typename LocalFind>
+typename dash::iterator_traits<GlobIter>::index_type
+find_local_index(
   /// Iterator to the initial position in the sequence
   GlobIter   first,
   /// Iterator to the final position in the sequence
   GlobIter   last,
-  /// Value which is searched for using operator==
-  const ElementType & value)
+  /// Search in local range, returns pointer to the first match or the end
+  /// of the local range
+  LocalFind  local_find)
 {
-
-  //use iterator traits
-  using iterator_traits = dash::iterator_traits<GlobIter>;
-
-  using p_index_t = typename iterator_traits::index_type;
-
-  if(first >= last) {
-    return last;
-  }
+  using p_index_t = typename dash::iterator_traits<GlobIter>::index_type;
 
   p_index_t g_index;
   auto & pattern     = first.pattern();
@@ -58,7 +57,7 @@ GlobIter find(
 
    DASH_LOG_DEBUG("local index range", l_begin_index, l_end_index);
 
-   auto l_result = std::find(l_range_begin, l_range_end, value);
+   auto l_result = local_find(l_range_begin, l_range_end);
    if (l_result == l_range_end) {
      DASH_LOG_DEBUG("Not found in local range");
      g_index = std::numeric_limits<p_index_t>::max();
@@ -67,6 +66,38 @@ GlobIter find(
       g_index = pattern.global(l_hit_index);
     }
   }
+  return g_index;
+}
+
+/**
+ * Resolves the global position of the first element in the range
+ * \c [first,last) from the results of \c local_find applied to the local
+ * elements of every unit.
+ */
+template<
+  typename GlobIter,
+  typename LocalFind>
+GlobIter find_impl(
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Search in local range, returns pointer to the first match or the end
+  /// of the local range
+  LocalFind  local_find)
+{
+
+  //use iterator traits
+  using iterator_traits = dash::iterator_traits<GlobIter>;
+
+  using p_index_t = typename iterator_traits::index_type;
+
+  if(first >= last) {
+    return last;
+  }
+
+  auto & team    = first.pattern().team();
+  p_index_t g_index = find_local_index(first, last, local_find);
   team.barrier();
 
   // receive buffer for global maximal index
@@ -90,6 +121,172 @@ GlobIter find(
   return last;
 }
 
+/**
+ * Asynchronous variant of \c find_impl, resolves the global position of
+ * the first match in a non-blocking reduction.
+ */
+template<
+  typename GlobIter,
+  typename LocalFind>
+dash::Future<GlobIter> find_impl_async(
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Search in local range, returns pointer to the first match or the end
+  /// of the local range
+  LocalFind  local_find)
+{
+  using p_index_t      = typename dash::iterator_traits<GlobIter>::index_type;
+  using local_result_t = local_result<p_index_t>;
+
+  if(first >= last) {
+    return dash::Future<GlobIter>(last);
+  }
+
+  auto & team = first.pattern().team();
+  local_result_t l_result;
+  l_result.value = find_local_index(first, last, local_find);
+  l_result.valid = true;
+
+  return reduce_local_results_async<GlobIter>(
+           l_result, dash::min<p_index_t>(), true, team,
+           [first, last](const local_result_t & g_result) {
+             if (g_result.value == std::numeric_limits<p_index_t>::max()) {
+               DASH_LOG_DEBUG("element not found");
+               return last;
+             }
+             return first + g_result.value;
+           });
+}
+
+} // namespace internal
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val.
+ * If no such element is found, the function returns \c last.
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename GlobIter,
+  typename ElementType>
+GlobIter find(
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Value which is searched for using operator==
+  const ElementType & value)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+  return internal::find_impl(
+    first, last,
+    [&value](const value_t * l_first, const value_t * l_last) {
+      return std::find(l_first, l_last, value);
+    });
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * satisfies the predicate \c p, with the local elements of every unit
+ * searched as specified by the execution policy.
+ * If no such element is found, the function returns \c last.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobIter,
+  typename UnaryPredicate,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+GlobIter find_if(
+    /// Execution policy for the local elements
+    ExecutionPolicy&& policy,
+    /// Iterator to the initial position in the sequence
+    GlobIter first,
+    /// Iterator to the final position in the sequence
+    GlobIter last,
+    /// Predicate which will be applied to the elements in range [first, last)
+    UnaryPredicate predicate)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+  return internal::find_impl(
+    first, last,
+    [&policy, &predicate](const value_t * l_first, const value_t * l_last) {
+      return l_first + dash::internal::execution_find_first(
+                         policy, std::distance(l_first, l_last),
+                         [l_first, &predicate](size_t i) {
+                           return predicate(l_first[i]);
+                         });
+    });
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * compares equal to \c val, with the local elements of every unit searched
+ * as specified by the execution policy.
+ * If no such element is found, the function returns \c last.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  typename GlobIter,
+  typename ElementType,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+GlobIter find(
+  /// Execution policy for the local elements
+  ExecutionPolicy&&   policy,
+  /// Iterator to the initial position in the sequence
+  GlobIter            first,
+  /// Iterator to the final position in the sequence
+  GlobIter            last,
+  /// Value which is searched for using operator==
+  const ElementType & value)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+  return dash::find_if(
+    policy, first, last,
+    [&value](const value_t & v) { return v == value; });
+}
+
+/**
+ * Returns an iterator to the first element in the range \c [first,last) that
+ * does not satisfy the predicate \c p, with the local elements of every
+ * unit searched as specified by the execution policy.
+ * If no such element is found, the function returns \c last.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobIter,
+  class UnaryPredicate,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+GlobIter find_if_not(
+    /// Execution policy for the local elements
+    ExecutionPolicy&& policy,
+    /// Iterator to the initial position in the sequence
+    GlobIter first,
+    /// Iterator to the final position in the sequence
+    GlobIter last,
+    /// Predicate which will be applied to the elements in range [first, last)
+    UnaryPredicate predicate)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+  return dash::find_if(
+    policy, first, last,
+    [&predicate](const value_t & v) { return !predicate(v); });
+}
+
 /**
  * Returns an iterator to the first element in the range \c [first,last) that
  * satisfies the predicate \c p.
@@ -168,6 +365,90 @@ GlobIter find_if_not(
   return find_if(first, last, std::not1(predicate));
 }
 
+/**
+ * Asynchronous variant of \c dash::find_if.
+ * Searches the local elements and starts a non-blocking reduction of the
+ * local results of all units.
+ *
+ * Collective operation.
+ *
+ * \returns  A \c dash::Future providing an iterator to the first element
+ *           that satisfies \c predicate, or \c last if there is no such
+ *           element.
+ *
+ * \see dash::find_if
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIter, typename UnaryPredicate>
+dash::Future<GlobIter> find_if_async(
+    /// Iterator to the initial position in the sequence
+    GlobIter first,
+    /// Iterator to the final position in the sequence
+    GlobIter last,
+    /// Predicate which will be applied to the elements in range [first, last)
+    UnaryPredicate predicate)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+  return internal::find_impl_async(
+    first, last,
+    [&predicate](const value_t * l_first, const value_t * l_last) {
+      return std::find_if(l_first, l_last, predicate);
+    });
+}
+
+/**
+ * Asynchronous variant of \c dash::find_if_not.
+ *
+ * Collective operation.
+ *
+ * \see dash::find_if_not
+ * \see dash::find_if_async
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <typename GlobIter, typename UnaryPredicate>
+dash::Future<GlobIter> find_if_not_async(
+    /// Iterator to the initial position in the sequence
+    GlobIter first,
+    /// Iterator to the final position in the sequence
+    GlobIter last,
+    /// Predicate which will be applied to the elements in range [first, last)
+    UnaryPredicate predicate)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+  return dash::find_if_async(
+    first, last,
+    [&predicate](const value_t & v) { return !predicate(v); });
+}
+
+/**
+ * Asynchronous variant of \c dash::find.
+ *
+ * Collective operation.
+ *
+ * \see dash::find
+ * \see dash::find_if_async
+ *
+ * \ingroup     DashAlgorithms
+ */
+template<
+  typename GlobIter,
+  typename ElementType>
+dash::Future<GlobIter> find_async(
+  /// Iterator to the initial position in the sequence
+  GlobIter   first,
+  /// Iterator to the final position in the sequence
+  GlobIter   last,
+  /// Value which is searched for using operator==
+  const ElementType & value)
+{
+  using value_t = typename dash::iterator_traits<GlobIter>::value_type;
+  return dash::find_if_async(
+    first, last,
+    [&value](const value_t & v) { return v == value; });
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__FIND_H__
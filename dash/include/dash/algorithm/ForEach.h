@@ -1,6 +1,7 @@
 #ifndef DASH__ALGORITHM__FOR_EACH_H__
 #define DASH__ALGORITHM__FOR_EACH_H__
 
+#include <dash/Execution.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/iterator/GlobIter.h>
 
@@ -57,6 +58,43 @@ void for_each(
   team.barrier();
 }
 
+/**
+ * Invoke a function on every element in a range distributed by a pattern,
+ * with the local elements of every unit processed as specified by the
+ * execution policy.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobInputIt,
+  class UnaryFunction,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+void for_each(
+    /// Execution policy for the local elements
+    ExecutionPolicy&& policy,
+    /// Iterator to the initial position in the sequence
+    GlobInputIt first,
+    /// Iterator to the final position in the sequence
+    GlobInputIt last,
+    /// Function to invoke on every index in the range
+    UnaryFunction func)
+{
+  using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  static_assert(
+      iterator_traits::is_global_iterator::value,
+      "must be a global iterator");
+  auto & team   = first.pattern().team();
+  auto   lrange = dash::local_range(first, last);
+  auto   lfirst = lrange.begin;
+  dash::internal::execution_for(
+    policy, std::distance(lrange.begin, lrange.end),
+    [lfirst, &func](size_t i) { func(lfirst[i]); });
+  team.barrier();
+}
+
 /**
  * Invoke a function on every element in a range distributed by a pattern.
  * Being a collaborative operation, each unit will invoke the given
@@ -1,6 +1,7 @@
 #ifndef DASH__ALGORITHM__GENERATE_H__
 #define DASH__ALGORITHM__GENERATE_H__
 
+#include <dash/Execution.h>
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 #include <dash/iterator/GlobIter.h>
@@ -49,6 +50,44 @@ void generate(
   std::generate(lfirst, llast, gen);
 }
 
+/**
+ * Assigns each element in range [first, last) a value generated by the
+ * given function object g, with the local elements of every unit processed
+ * as specified by the execution policy.
+ *
+ * With a parallel execution policy, \c gen is invoked concurrently and must
+ * be safe to call from multiple threads.
+ *
+ * \see dash::execution
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  typename GlobInputIt,
+  class UnaryFunction,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+void generate(
+    /// Execution policy for the local elements
+    ExecutionPolicy&& policy,
+    /// Iterator to the initial position in the sequence
+    GlobInputIt first,
+    /// Iterator to the final position in the sequence
+    GlobInputIt last,
+    /// Generator function
+    UnaryFunction gen)
+{
+  using iterator_traits = dash::iterator_traits<GlobInputIt>;
+  static_assert(
+      iterator_traits::is_global_iterator::value,
+      "must be a global iterator");
+  auto lrange = dash::local_range(first, last);
+  auto lfirst = lrange.begin;
+  dash::internal::execution_for(
+    policy, std::distance(lrange.begin, lrange.end),
+    [lfirst, &gen](size_t i) { lfirst[i] = gen(); });
+}
+
 /**
  * Assigns each element in range [first, last) a value generated by the
  * given function object g. The index passed to the function is
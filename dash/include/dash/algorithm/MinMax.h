@@ -6,6 +6,9 @@
 #include <dash/Allocator.h>
 
 #include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Reduce.h>
+
+#include <dash/Future.h>
 
 #include <dash/util/Config.h>
 #include <dash/util/Trace.h>
@@ -15,6 +18,7 @@
 #include <dash/iterator/GlobIter.h>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 
 #ifdef DASH_ENABLE_OPENMP
@@ -371,6 +375,123 @@ const ElementType *max_element(
   return dash::min_element(first, last, compare);
 }
 
+/**
+ * Asynchronous variant of \c dash::min_element.
+ * Finds the local minimum and starts a non-blocking reduction of the
+ * local minima of all units.
+ *
+ * The returned future can be tested for the result or waited for.
+ * Destroying the future waits for the completion of the reduction.
+ *
+ * Collective operation.
+ *
+ * \return      A \c dash::Future providing an iterator to the first
+ *              occurrence of the smallest value in the range, or \c last
+ *              if the range is empty.
+ *
+ * \see dash::min_element
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    typename GlobInputIt,
+    class Compare = std::less<
+        const typename dash::iterator_traits<GlobInputIt>::value_type &> >
+dash::Future<GlobInputIt> min_element_async(
+    /// Iterator to the initial position in the sequence
+    const typename std::enable_if<
+        dash::iterator_traits<GlobInputIt>::is_global_iterator::value,
+        GlobInputIt>::type &first,
+    /// Iterator to the final position in the sequence
+    const GlobInputIt &last,
+    /// Element comparison function, defaults to std::less
+    Compare compare = Compare())
+{
+  typedef typename GlobInputIt::pattern_type     pattern_t;
+  typedef typename pattern_t::index_type         index_t;
+  typedef typename std::decay<
+      typename dash::iterator_traits<GlobInputIt>::value_type>::type value_t;
+
+  struct local_min_t {
+    value_t  value;
+    index_t  g_index;
+  };
+  typedef dash::internal::local_result<local_min_t> local_result_t;
+
+  auto & pattern = first.pattern();
+  auto & team    = pattern.team();
+
+  local_result_t l_result;
+  auto local_idx_range = dash::local_index_range(first, last);
+  if (local_idx_range.begin != local_idx_range.end) {
+    auto *lbegin = dash::local_begin(
+        static_cast<typename GlobInputIt::const_pointer>(first), team.myid());
+    const auto * l_range_begin = lbegin + local_idx_range.begin;
+    const auto * l_range_end   = lbegin + local_idx_range.end;
+
+    const value_t * lmin = dash::min_element(
+                             l_range_begin, l_range_end, compare);
+    l_result.value.value   = *lmin;
+    l_result.value.g_index = pattern.global(lmin - lbegin);
+    l_result.valid         = true;
+  }
+
+  // Commutative reduction, ties are resolved by the global index of the
+  // local minima:
+  auto min_op = [compare](const local_min_t & a, const local_min_t & b) {
+                  if (compare(b.value, a.value)) {
+                    return b;
+                  }
+                  if (compare(a.value, b.value)) {
+                    return a;
+                  }
+                  return (b.g_index < a.g_index) ? b : a;
+                };
+
+  GlobInputIt begin = first - first.gpos();
+  GlobInputIt end   = last;
+  // Units may have empty local ranges:
+  static constexpr bool units_non_empty = false;
+  return dash::internal::reduce_local_results_async<GlobInputIt>(
+           l_result, min_op, units_non_empty, team,
+           [begin, end](const local_result_t & g_result) {
+             if (!g_result.valid) {
+               // empty range
+               return end;
+             }
+             return begin + g_result.value.g_index;
+           });
+}
+
+/**
+ * Asynchronous variant of \c dash::max_element.
+ *
+ * Collective operation.
+ *
+ * \return      A \c dash::Future providing an iterator to the first
+ *              occurrence of the greatest value in the range, or \c last
+ *              if the range is empty.
+ *
+ * \see dash::max_element
+ * \see dash::min_element_async
+ *
+ * \ingroup     DashAlgorithms
+ */
+template <
+    class GlobIter,
+    class Compare = std::greater<const typename GlobIter::value_type &> >
+dash::Future<GlobIter> max_element_async(
+    /// Iterator to the initial position in the sequence
+    const GlobIter &first,
+    /// Iterator to the final position in the sequence
+    const GlobIter &last,
+    /// Element comparison function, defaults to std::greater
+    Compare compare = Compare())
+{
+  // Same as min_element_async with different compare function
+  return dash::min_element_async(first, last, compare);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__MIN_MAX_H__
@@ -0,0 +1,558 @@
+#ifndef DASH__ALGORITHM__NTH_ELEMENT_H
+#define DASH__ALGORITHM__NTH_ELEMENT_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <dash/Exception.h>
+#include <dash/Meta.h>
+#include <dash/Types.h>
+#include <dash/dart/if/dart.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Sort.h>
+
+#include <dash/internal/Logging.h>
+#include <dash/util/Trace.h>
+
+namespace dash {
+
+#ifdef DOXYGEN
+
+/**
+ * Returns the element that would occur at position \c nth if the range
+ * \c [begin, end) was sorted.
+ *
+ * In contrast to \c std::nth_element, elements are not moved. The element
+ * is found by bisection of the range of element values using the global
+ * histograms of \c dash::sort in \c O(log(max - min)) collective rounds,
+ * so no data is exchanged between units.
+ *
+ * Elements are compared using operator<. Additionally, the elements must
+ * be arithmetic.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<double> arr(1000);
+ *       // ...
+ *       double median = dash::nth_element(
+ *                         arr.begin(), arr.begin() + 500, arr.end());
+ * \endcode
+ *
+ * \return  The element at position \c nth in sorted order, at all units.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+typename GlobRandomIt::value_type nth_element(
+    GlobRandomIt begin, GlobRandomIt nth, GlobRandomIt end);
+
+/**
+ * Returns an element that would occur at position \c nth if the range
+ * \c [begin, end) was sorted by the values of a user-defined hash
+ * function. Resulting values of the hash function are required to be
+ * arithmetic.
+ *
+ * \see  dash::nth_element(GlobRandomIt, GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class SortableHash>
+typename GlobRandomIt::value_type nth_element(
+    GlobRandomIt begin,
+    GlobRandomIt nth,
+    GlobRandomIt end,
+    SortableHash hash);
+
+/**
+ * Writes the elements that would occur at the given positions if the range
+ * \c [begin, end) was sorted to the local output range starting at
+ * \c out_first, e.g. to obtain percentiles. All positions are selected in
+ * the same collective rounds.
+ *
+ * \return  Output iterator past the last written element.
+ *
+ * \see  dash::nth_element(GlobRandomIt, GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class InputIt, class OutputIt>
+OutputIt nth_elements(
+    GlobRandomIt begin,
+    GlobRandomIt end,
+    InputIt      positions_first,
+    InputIt      positions_last,
+    OutputIt     out_first);
+
+/**
+ * Writes the smallest elements of the range \c [begin, end) in ascending
+ * order to the local output range \c [out_first, out_last) at all units.
+ *
+ * The largest selected element is determined by \c dash::nth_element,
+ * only the selected elements are then gathered from the units.
+ *
+ * \return  Output iterator past the last written element.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class OutputIt>
+OutputIt partial_sort_copy(
+    GlobRandomIt begin, GlobRandomIt end, OutputIt out_first, OutputIt out_last);
+
+/**
+ * Writes the \c k largest elements of the range \c [begin, end) in
+ * descending order to the local output range starting at \c out_first at
+ * all units.
+ *
+ * The smallest selected element is determined by \c dash::nth_element,
+ * only the selected elements are then gathered from the units.
+ *
+ * \return  Output iterator past the last written element.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class OutputIt>
+OutputIt top_k(
+    GlobRandomIt begin, GlobRandomIt end, std::size_t k, OutputIt out_first);
+
+#else
+
+namespace detail {
+
+/**
+ * Finds the hash values of the elements at the given positions in sorted
+ * order of the local range \c [lbegin, lend) of all units by bisection of
+ * the range of hash values, using the partition border search of
+ * \c dash::sort with one border per position.
+ *
+ * \return  Pairs of the number of elements less than and less than or
+ *          equal to the selected value for every position.
+ */
+template <typename ValueType, class SortableHash, typename MappedType>
+std::vector<std::size_t> select__find_values(
+    ValueType const*               lbegin,
+    ValueType const*               lend,
+    std::vector<std::size_t> const& positions,
+    std::size_t                    nelem,
+    SortableHash                   sortable_hash,
+    std::vector<MappedType>&       values,
+    dash::Team&                    team)
+{
+  DASH_LOG_TRACE("< select__find_values", "positions:", positions.size());
+
+  auto const n_l_elem  = static_cast<std::size_t>(std::distance(lbegin, lend));
+  auto const nthreads  = psort__num_threads(n_l_elem);
+  auto const npos      = positions.size();
+  auto const ident     = [](MappedType const& v) { return v; };
+
+  // Sorted local hash values, the range itself is not modified
+  std::vector<MappedType> lkeys(n_l_elem);
+  std::transform(lbegin, lend, lkeys.begin(), sortable_hash);
+  psort__local_sort(
+      lkeys.data(),
+      lkeys.data() + n_l_elem,
+      std::less<MappedType>(),
+      nthreads);
+
+  auto const min_max = find_global_min_max(
+      lkeys.begin(), lkeys.end(), team.dart_id(), ident);
+
+  // Every position is a border between two virtual partitions, the
+  // element at position p is the smallest value with more than p elements
+  // less than or equal to it.
+  UnitInfo unit_info(npos + 1);
+  unit_info.acc_partition_count[0] = 0;
+  for (std::size_t i = 0; i < npos; ++i) {
+    unit_info.acc_partition_count[i + 1] = positions[i] + 1;
+  }
+  unit_info.acc_partition_count[npos + 1] = nelem;
+
+  PartitionBorder<MappedType> p_borders(npos, min_max.first, min_max.second);
+  std::iota(
+      p_borders.left_partition.begin(), p_borders.left_partition.end(), 0);
+
+  std::vector<std::size_t> valid_partitions(npos);
+  std::iota(valid_partitions.begin(), valid_partitions.end(), 0);
+
+  values.assign(npos, MappedType{});
+  std::vector<std::size_t> global_histo(npos * NLT_NLE_BLOCK, 0);
+
+  std::size_t iter = 0;
+  bool        done = false;
+  do {
+    ++iter;
+    psort__calc_boundaries(p_borders, values);
+
+    auto const l_nlt_nle = psort__local_histogram(
+        values,
+        valid_partitions,
+        p_borders,
+        lkeys.begin(),
+        lkeys.end(),
+        ident,
+        nthreads);
+
+    psort__global_histogram(
+        std::begin(l_nlt_nle),
+        std::next(std::begin(l_nlt_nle), npos * NLT_NLE_BLOCK),
+        std::begin(global_histo),
+        team.dart_id());
+
+    done = psort__validate_partitions(
+        unit_info, values, valid_partitions, p_borders, global_histo);
+  } while (!done);
+
+  DASH_LOG_TRACE("select__find_values >", "iterations:", iter);
+  return global_histo;
+}
+
+/**
+ * Gathers the \c k smallest (or largest) elements of the range
+ * \c [begin, end) at all units, in no particular order.
+ */
+template <class GlobRandomIt, class SortableHash>
+std::vector<typename GlobRandomIt::value_type> select__gather(
+    GlobRandomIt begin,
+    GlobRandomIt end,
+    std::size_t  k,
+    bool         largest,
+    SortableHash sortable_hash)
+{
+  using value_type = typename GlobRandomIt::value_type;
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  static_assert(
+      std::is_arithmetic<mapped_type>::value,
+      "Only arithmetic types are supported");
+
+  dash::util::Trace trace("Select");
+
+  auto&       pattern = begin.pattern();
+  dash::Team& team    = pattern.team();
+  auto const  nunits  = team.size();
+  auto const  myid    = team.myid();
+  auto const  nelem   = static_cast<std::size_t>(std::distance(begin, end));
+
+  k = std::min(k, nelem);
+  if (k == 0) {
+    return {};
+  }
+
+  auto const l_range  = dash::local_index_range(begin, end);
+  auto const n_l_elem = l_range.end - l_range.begin;
+  value_type const* lbegin =
+      dash::local_begin(
+          static_cast<typename GlobRandomIt::pointer>(begin), myid) +
+      l_range.begin;
+  value_type const* lend = lbegin + n_l_elem;
+
+  trace.enter_state("1:find_border_value");
+
+  // Value of the last selected element
+  std::vector<std::size_t> const positions{largest ? nelem - k : k - 1};
+  std::vector<mapped_type>       values;
+  auto const                     histo = select__find_values(
+      lbegin, lend, positions, nelem, sortable_hash, values, team);
+  auto const border = values[0];
+
+  // Number of selected elements not equal to the border value
+  std::size_t const nbelow = largest ? nelem - histo[1] : histo[0];
+
+  trace.exit_state("1:find_border_value");
+
+  trace.enter_state("2:select_local");
+
+  std::vector<value_type> selected;
+  std::size_t             l_nequal = 0;
+  for (auto it = lbegin; it != lend; ++it) {
+    auto const h = sortable_hash(*it);
+    if (largest ? border < h : h < border) {
+      selected.push_back(*it);
+    }
+    l_nequal += !(h < border) && !(border < h);
+  }
+
+  // Elements equal to the border value are selected in the order of units
+  std::vector<unsigned long long> nequal(nunits);
+  unsigned long long const        l_nequal_ull = l_nequal;
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          &l_nequal_ull,
+          nequal.data(),
+          1,
+          DART_TYPE_ULONGLONG,
+          team.dart_id()),
+      DART_OK);
+  std::size_t const nequal_before = std::accumulate(
+      nequal.begin(), nequal.begin() + myid, std::size_t{0});
+  std::size_t const nequal_needed = k - nbelow;
+  std::size_t       l_ntake =
+      (nequal_needed > nequal_before)
+          ? std::min(nequal_needed - nequal_before, l_nequal)
+          : 0;
+  for (auto it = lbegin; it != lend && l_ntake > 0; ++it) {
+    auto const h = sortable_hash(*it);
+    if (!(h < border) && !(border < h)) {
+      selected.push_back(*it);
+      --l_ntake;
+    }
+  }
+
+  trace.exit_state("2:select_local");
+
+  trace.enter_state("3:gather_selected");
+
+  // Gather selected elements at all units
+  auto const elem_size = dash::dart_storage<value_type>(1).nelem;
+
+  std::vector<unsigned long long> nselected(nunits);
+  unsigned long long const        l_nselected = selected.size();
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          &l_nselected,
+          nselected.data(),
+          1,
+          DART_TYPE_ULONGLONG,
+          team.dart_id()),
+      DART_OK);
+
+  std::vector<std::size_t> recv_counts(nunits);
+  std::vector<std::size_t> recv_displs(nunits, 0);
+  for (std::size_t u = 0; u < nunits; ++u) {
+    recv_counts[u] = nselected[u] * elem_size;
+    if (u > 0) {
+      recv_displs[u] = recv_displs[u - 1] + recv_counts[u - 1];
+    }
+  }
+  DASH_ASSERT_EQ(
+      std::accumulate(nselected.begin(), nselected.end(), std::size_t{0}),
+      k,
+      "invalid number of selected elements");
+
+  std::vector<value_type>            result(k);
+  dash::dart_storage<value_type> const ds(selected.size());
+  DASH_ASSERT_RETURNS(
+      dart_allgatherv(
+          selected.data(),
+          ds.nelem,
+          ds.dtype,
+          result.data(),
+          recv_counts.data(),
+          recv_displs.data(),
+          team.dart_id()),
+      DART_OK);
+
+  trace.exit_state("3:gather_selected");
+
+  return result;
+}
+
+}  // namespace detail
+
+template <class GlobRandomIt, class InputIt, class OutputIt, class SortableHash>
+OutputIt nth_elements(
+    GlobRandomIt begin,
+    GlobRandomIt end,
+    InputIt      positions_first,
+    InputIt      positions_last,
+    OutputIt     out_first,
+    SortableHash sortable_hash)
+{
+  using value_type = typename GlobRandomIt::value_type;
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  auto const nelem = static_cast<std::size_t>(std::distance(begin, end));
+
+  std::vector<std::size_t> positions(positions_first, positions_last);
+  for (auto const p : positions) {
+    if (p >= nelem) {
+      DASH_THROW(
+          dash::exception::OutOfRange,
+          "dash::nth_elements: position " << p << " is out of range [0,"
+                                          << nelem << ")");
+    }
+  }
+  if (positions.empty()) {
+    return out_first;
+  }
+
+  dash::Team& team   = begin.pattern().team();
+  auto const  nunits = team.size();
+  auto const  myid   = team.myid();
+
+  auto const        l_range  = dash::local_index_range(begin, end);
+  value_type const* lbegin =
+      dash::local_begin(
+          static_cast<typename GlobRandomIt::pointer>(begin), myid) +
+      l_range.begin;
+  value_type const* lend = lbegin + (l_range.end - l_range.begin);
+
+  std::vector<mapped_type> values;
+  detail::select__find_values(
+      lbegin, lend, positions, nelem, sortable_hash, values, team);
+
+  for (auto const& v : values) {
+    // Broadcast an element with the selected hash value from the first
+    // unit owning one
+    auto const l_match = std::find_if(
+        lbegin, lend, [&sortable_hash, &v](value_type const& e) {
+          auto const h = sortable_hash(e);
+          return !(h < v) && !(v < h);
+        });
+    unsigned long long const l_root =
+        (l_match != lend) ? static_cast<unsigned long long>(myid)
+                          : static_cast<unsigned long long>(nunits);
+    unsigned long long root;
+    DASH_ASSERT_RETURNS(
+        dart_allreduce(
+            &l_root,
+            &root,
+            1,
+            DART_TYPE_ULONGLONG,
+            DART_OP_MIN,
+            team.dart_id()),
+        DART_OK);
+
+    value_type elem{};
+    if (l_match != lend) {
+      elem = *l_match;
+    }
+    dash::dart_storage<value_type> const ds(1);
+    DASH_ASSERT_RETURNS(
+        dart_bcast(
+            &elem,
+            ds.nelem,
+            ds.dtype,
+            dash::team_unit_t{static_cast<dart_unit_t>(root)},
+            team.dart_id()),
+        DART_OK);
+    *out_first++ = elem;
+  }
+  return out_first;
+}
+
+template <class GlobRandomIt, class InputIt, class OutputIt>
+inline OutputIt nth_elements(
+    GlobRandomIt begin,
+    GlobRandomIt end,
+    InputIt      positions_first,
+    InputIt      positions_last,
+    OutputIt     out_first)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  return dash::nth_elements(
+      begin,
+      end,
+      positions_first,
+      positions_last,
+      out_first,
+      detail::identity_t<value_t const&>());
+}
+
+template <class GlobRandomIt, class SortableHash>
+typename GlobRandomIt::value_type nth_element(
+    GlobRandomIt begin,
+    GlobRandomIt nth,
+    GlobRandomIt end,
+    SortableHash sortable_hash)
+{
+  std::size_t const                 position = std::distance(begin, nth);
+  typename GlobRandomIt::value_type elem;
+  dash::nth_elements(
+      begin, end, &position, &position + 1, &elem, sortable_hash);
+  return elem;
+}
+
+template <class GlobRandomIt>
+inline typename GlobRandomIt::value_type nth_element(
+    GlobRandomIt begin, GlobRandomIt nth, GlobRandomIt end)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  return dash::nth_element(
+      begin, nth, end, detail::identity_t<value_t const&>());
+}
+
+template <class GlobRandomIt, class OutputIt, class SortableHash>
+OutputIt partial_sort_copy(
+    GlobRandomIt begin,
+    GlobRandomIt end,
+    OutputIt     out_first,
+    OutputIt     out_last,
+    SortableHash sortable_hash)
+{
+  using value_type = typename GlobRandomIt::value_type;
+
+  auto selected = detail::select__gather(
+      begin, end, std::distance(out_first, out_last), false, sortable_hash);
+  std::sort(
+      selected.begin(),
+      selected.end(),
+      [&sortable_hash](value_type const& a, value_type const& b) {
+        return sortable_hash(a) < sortable_hash(b);
+      });
+  return std::copy(selected.begin(), selected.end(), out_first);
+}
+
+template <class GlobRandomIt, class OutputIt>
+inline OutputIt partial_sort_copy(
+    GlobRandomIt begin, GlobRandomIt end, OutputIt out_first, OutputIt out_last)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  return dash::partial_sort_copy(
+      begin, end, out_first, out_last, detail::identity_t<value_t const&>());
+}
+
+template <class GlobRandomIt, class OutputIt, class SortableHash>
+OutputIt top_k(
+    GlobRandomIt begin,
+    GlobRandomIt end,
+    std::size_t  k,
+    OutputIt     out_first,
+    SortableHash sortable_hash)
+{
+  using value_type = typename GlobRandomIt::value_type;
+
+  auto selected =
+      detail::select__gather(begin, end, k, true, sortable_hash);
+  std::sort(
+      selected.begin(),
+      selected.end(),
+      [&sortable_hash](value_type const& a, value_type const& b) {
+        return sortable_hash(b) < sortable_hash(a);
+      });
+  return std::copy(selected.begin(), selected.end(), out_first);
+}
+
+template <class GlobRandomIt, class OutputIt>
+inline OutputIt top_k(
+    GlobRandomIt begin, GlobRandomIt end, std::size_t k, OutputIt out_first)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  return dash::top_k(
+      begin, end, k, out_first, detail::identity_t<value_t const&>());
+}
+
+#endif  // DOXYGEN
+
+}  // namespace dash
+
+#endif  // DASH__ALGORITHM__NTH_ELEMENT_H
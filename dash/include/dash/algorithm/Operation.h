@@ -7,6 +7,8 @@
 #include <dash/dart/if/dart_types.h>
 
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 
 /**
@@ -88,6 +90,29 @@ struct dart_reduce_operation<BinaryOperation,
                                   BinaryOperation::dart_operation()>
 { };
 
+/**
+ * Whether a binary operation provides a \c dart_operation_t, i.e. can be
+ * applied by DART accumulate operations.
+ * Overload for arbitrary functions such as lambdas.
+ */
+template<typename BinaryOperation, typename = void>
+struct has_dart_operation
+  : public std::false_type
+{ };
+
+/**
+ * Whether a binary operation provides a \c dart_operation_t.
+ * Overload for operations defining \c dart_operation().
+ */
+template<typename BinaryOperation>
+struct has_dart_operation<BinaryOperation,
+        typename std::conditional<
+          false,
+          decltype(std::declval<const BinaryOperation &>().dart_operation()),
+          void>::type>
+  : public std::true_type
+{ };
+
 } // namespace internal
 
 #ifdef DOXYGEN
@@ -0,0 +1,415 @@
+#ifndef DASH__ALGORITHM__RADIX_SORT_H
+#define DASH__ALGORITHM__RADIX_SORT_H
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <dash/Exception.h>
+#include <dash/Meta.h>
+#include <dash/Types.h>
+#include <dash/dart/if/dart.h>
+
+#include <dash/algorithm/LocalRange.h>
+
+#include <dash/internal/Logging.h>
+#include <dash/util/Trace.h>
+
+// Number of key bits sorted in a single pass
+#define RADIX_SORT_DIGIT_BITS 8
+#define RADIX_SORT_NBUCKETS (1 << RADIX_SORT_DIGIT_BITS)
+
+namespace dash {
+
+#ifdef DOXYGEN
+
+/**
+ * Sorts the elements in the range \c [begin, end) in ascending order using
+ * a distributed least-significant-digit radix sort. The order of equal
+ * elements is preserved.
+ *
+ * Elements must be arithmetic. Keys are mapped to unsigned integers of
+ * equal width preserving their order, so negative and floating-point
+ * values are supported.
+ *
+ * Every pass sorts by a digit of \c RADIX_SORT_DIGIT_BITS bits: units
+ * count the digits of their local elements, obtain global bucket offsets
+ * from the histograms of all units and write every bucket to its final
+ * position in a single all-to-all exchange of one-sided puts. Passes over
+ * digits that are equal for all keys are skipped.
+ *
+ * The cost is linear in the number of elements and independent of the
+ * key distribution. Every unit requires a temporary buffer for its local
+ * elements.
+ *
+ * As \c dash::sort, the range must be global (\c GlobIter<ValueType>) and
+ * elements must be ordered by unit in global index space, as in a
+ * one-dimensional blocked distribution.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end);
+
+/**
+ * Sorts the elements in the range \c [begin, end) in ascending order of
+ * their arithmetic keys obtained from \c sortable_hash using a distributed
+ * least-significant-digit radix sort. The order of elements with equal keys
+ * is preserved.
+ *
+ * \see  dash::radix_sort(GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class SortableHash>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
+
+/**
+ * Sorts the keys in the range \c [keys_begin, keys_end) in ascending
+ * order and applies the same permutation to the range of values starting
+ * at \c values_begin, which must have the same distribution as the range
+ * of keys.
+ *
+ * \see  dash::radix_sort(GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobKeyIt, class GlobValueIt>
+void radix_sort_by_key(
+    GlobKeyIt keys_begin, GlobKeyIt keys_end, GlobValueIt values_begin);
+
+#else
+
+namespace detail {
+
+/**
+ * Maps arithmetic keys to unsigned integers of equal width such that the
+ * order of keys is preserved.
+ */
+template <typename KeyT, typename Enable = void>
+struct radix_key_traits;
+
+template <typename KeyT>
+struct radix_key_traits<
+    KeyT,
+    typename std::enable_if<std::is_integral<KeyT>::value>::type> {
+  using unsigned_type = typename std::make_unsigned<KeyT>::type;
+
+  static constexpr unsigned_type to_unsigned(KeyT key) noexcept
+  {
+    // flip the sign bit of signed keys
+    return std::is_signed<KeyT>::value
+               ? static_cast<unsigned_type>(key) ^
+                     (unsigned_type(1) << (sizeof(KeyT) * CHAR_BIT - 1))
+               : static_cast<unsigned_type>(key);
+  }
+};
+
+template <typename KeyT>
+struct radix_key_traits<
+    KeyT,
+    typename std::enable_if<std::is_floating_point<KeyT>::value>::type> {
+  static_assert(
+      sizeof(KeyT) == sizeof(uint32_t) || sizeof(KeyT) == sizeof(uint64_t),
+      "Only 32 and 64 bit floating point keys are supported");
+
+  using unsigned_type = typename std::conditional<
+      sizeof(KeyT) == sizeof(uint32_t),
+      uint32_t,
+      uint64_t>::type;
+
+  static inline unsigned_type to_unsigned(KeyT key) noexcept
+  {
+    unsigned_type bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    auto const sign_bit = unsigned_type(1) << (sizeof(KeyT) * CHAR_BIT - 1);
+    // negative values: invert all bits, positive values: flip sign bit
+    return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+  }
+};
+
+/**
+ * Writes the consecutive local elements \c [lsrc, lsrc + nelem) to the
+ * global positions \c [gpos, gpos + nelem) of the range starting at
+ * \c gbegin, split at the boundaries of the units' local ranges.
+ */
+template <class GlobIt, typename ValueType>
+inline void radix_sort__put(
+    GlobIt                                gbegin,
+    std::vector<std::size_t> const&       unit_offsets,
+    std::size_t                           gpos,
+    ValueType const*                      lsrc,
+    std::size_t                           nelem)
+{
+  // first unit with elements at or after gpos
+  auto unit = std::distance(
+                  unit_offsets.begin(),
+                  std::upper_bound(
+                      unit_offsets.begin(), unit_offsets.end(), gpos)) -
+              1;
+  while (nelem > 0) {
+    auto const nput =
+        std::min<std::size_t>(nelem, unit_offsets[unit + 1] - gpos);
+    if (nput > 0) {
+      dash::dart_storage<ValueType> ds(nput);
+      DASH_ASSERT_RETURNS(
+          dart_put(
+              (gbegin + gpos).dart_gptr(), lsrc, ds.nelem, ds.dtype, ds.dtype),
+          DART_OK);
+    }
+    gpos += nput;
+    lsrc += nput;
+    nelem -= nput;
+    ++unit;
+  }
+}
+
+/**
+ * Distributed LSD radix sort of the range \c [begin, end) by keys obtained
+ * from \c key_fn. If \c values_begin is not \c nullptr, the range of
+ * values starting at \c *values_begin is permuted like the keys.
+ */
+template <class GlobKeyIt, class GlobValueIt, class KeyFn>
+void radix_sort__impl(
+    GlobKeyIt          begin,
+    GlobKeyIt          end,
+    GlobValueIt const* values_begin,
+    KeyFn              key_fn)
+{
+  using key_value_type = typename std::remove_cv<
+      typename dash::iterator_traits<GlobKeyIt>::value_type>::type;
+  using value_value_type = typename std::remove_cv<
+      typename dash::iterator_traits<GlobValueIt>::value_type>::type;
+  using mapped_type = typename std::decay<decltype(
+      key_fn(std::declval<key_value_type const&>()))>::type;
+  using traits        = radix_key_traits<mapped_type>;
+  using unsigned_type = typename traits::unsigned_type;
+
+  static_assert(
+      std::is_arithmetic<mapped_type>::value,
+      "Only arithmetic keys are supported");
+
+  dash::util::Trace trace("RadixSort");
+
+  auto const& pattern = begin.pattern();
+  dash::Team& team    = pattern.team();
+
+  if (team == dash::Team::Null()) {
+    DASH_LOG_TRACE("dash::radix_sort", "Sorting on dash::Team::Null()");
+    return;
+  }
+
+  auto const nunits = team.size();
+  auto const myid   = team.myid();
+
+  trace.enter_state("1:local_ranges");
+
+  auto const l_range = dash::local_index_range(begin, end);
+  auto const nlocal  = static_cast<std::size_t>(l_range.end - l_range.begin);
+
+  key_value_type* lkeys =
+      dash::local_begin(
+          static_cast<typename GlobKeyIt::pointer>(begin), myid) +
+      l_range.begin;
+  value_value_type* lvalues = nullptr;
+  if (values_begin != nullptr) {
+    GlobValueIt values_first = *values_begin;
+    auto const  values_last  = values_first + (end - begin);
+    auto const  v_range = dash::local_index_range(values_first, values_last);
+    DASH_ASSERT_EQ(
+        static_cast<std::size_t>(v_range.end - v_range.begin),
+        nlocal,
+        "keys and values must have the same distribution");
+    lvalues = dash::local_begin(
+                  static_cast<typename GlobValueIt::pointer>(values_first),
+                  myid) +
+              v_range.begin;
+  }
+
+  // global offset of the local range of every unit
+  std::vector<unsigned long long> unit_sizes(nunits);
+  unsigned long long const        nlocal_ull = nlocal;
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          &nlocal_ull,
+          unit_sizes.data(),
+          1,
+          DART_TYPE_ULONGLONG,
+          team.dart_id()),
+      DART_OK);
+  std::vector<std::size_t> unit_offsets(nunits + 1, 0);
+  std::partial_sum(
+      unit_sizes.begin(), unit_sizes.end(), std::next(unit_offsets.begin()));
+
+  trace.exit_state("1:local_ranges");
+
+  std::vector<key_value_type>   send_keys(nlocal);
+  std::vector<value_value_type> send_values(lvalues != nullptr ? nlocal : 0);
+  std::vector<unsigned_type>    ukeys(nlocal);
+
+  std::array<unsigned long long, RADIX_SORT_NBUCKETS> l_histo;
+  std::vector<unsigned long long> g_histo(nunits * RADIX_SORT_NBUCKETS);
+  std::array<std::size_t, RADIX_SORT_NBUCKETS> l_bucket_begin;
+  std::array<std::size_t, RADIX_SORT_NBUCKETS> g_bucket_begin;
+
+  auto const nbits   = static_cast<int>(sizeof(unsigned_type) * CHAR_BIT);
+  int        npasses = 0;
+
+  for (int shift = 0; shift < nbits; shift += RADIX_SORT_DIGIT_BITS) {
+    DASH_LOG_TRACE_VAR("dash::radix_sort", shift);
+
+    trace.enter_state("2:histogram");
+
+    l_histo.fill(0);
+    for (std::size_t i = 0; i < nlocal; ++i) {
+      ukeys[i] = traits::to_unsigned(key_fn(lkeys[i]));
+      ++l_histo[(ukeys[i] >> shift) & (RADIX_SORT_NBUCKETS - 1)];
+    }
+
+    DASH_ASSERT_RETURNS(
+        dart_allgather(
+            l_histo.data(),
+            g_histo.data(),
+            RADIX_SORT_NBUCKETS,
+            DART_TYPE_ULONGLONG,
+            team.dart_id()),
+        DART_OK);
+
+    trace.exit_state("2:histogram");
+
+    trace.enter_state("3:scan");
+
+    // Global offset of every bucket at the calling unit: elements in
+    // preceding buckets at all units and elements in the same bucket at
+    // preceding units
+    std::size_t g_offset         = 0;
+    int         nnonempty_bucket = 0;
+    for (std::size_t b = 0; b < RADIX_SORT_NBUCKETS; ++b) {
+      std::size_t b_total = 0;
+      for (std::size_t u = 0; u < nunits; ++u) {
+        if (u == static_cast<std::size_t>(myid)) {
+          g_bucket_begin[b] = g_offset + b_total;
+        }
+        b_total += g_histo[u * RADIX_SORT_NBUCKETS + b];
+      }
+      g_offset += b_total;
+      nnonempty_bucket += (b_total > 0);
+    }
+
+    trace.exit_state("3:scan");
+
+    if (nnonempty_bucket < 2) {
+      // digit is equal for all keys
+      continue;
+    }
+    ++npasses;
+
+    trace.enter_state("4:local_scatter");
+
+    // Stable local counting sort by digit into send buffers:
+    l_bucket_begin[0] = 0;
+    for (std::size_t b = 1; b < RADIX_SORT_NBUCKETS; ++b) {
+      l_bucket_begin[b] = l_bucket_begin[b - 1] + l_histo[b - 1];
+    }
+    auto l_bucket_pos = l_bucket_begin;
+    for (std::size_t i = 0; i < nlocal; ++i) {
+      auto const pos =
+          l_bucket_pos[(ukeys[i] >> shift) & (RADIX_SORT_NBUCKETS - 1)]++;
+      send_keys[pos] = lkeys[i];
+      if (lvalues != nullptr) {
+        send_values[pos] = lvalues[i];
+      }
+    }
+
+    trace.exit_state("4:local_scatter");
+
+    // All units must have read their local elements before they are
+    // overwritten:
+    trace.enter_state("5:barrier");
+    team.barrier();
+    trace.exit_state("5:barrier");
+
+    trace.enter_state("6:exchange_data (all-to-all)");
+
+    for (std::size_t b = 0; b < RADIX_SORT_NBUCKETS; ++b) {
+      if (l_histo[b] == 0) {
+        continue;
+      }
+      radix_sort__put(
+          begin,
+          unit_offsets,
+          g_bucket_begin[b],
+          send_keys.data() + l_bucket_begin[b],
+          l_histo[b]);
+      if (lvalues != nullptr) {
+        radix_sort__put(
+            *values_begin,
+            unit_offsets,
+            g_bucket_begin[b],
+            send_values.data() + l_bucket_begin[b],
+            l_histo[b]);
+      }
+    }
+    DASH_ASSERT_RETURNS(dart_flush_all(begin.dart_gptr()), DART_OK);
+    if (lvalues != nullptr) {
+      DASH_ASSERT_RETURNS(
+          dart_flush_all(values_begin->dart_gptr()), DART_OK);
+    }
+    team.barrier();
+
+    trace.exit_state("6:exchange_data (all-to-all)");
+  }
+
+  DASH_LOG_TRACE("dash::radix_sort >", "passes:", npasses);
+}
+
+}  // namespace detail
+
+template <class GlobRandomIt, class SortableHash>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash)
+{
+  if (begin >= end) {
+    begin.pattern().team().barrier();
+    return;
+  }
+  detail::radix_sort__impl(
+      begin, end, static_cast<GlobRandomIt const*>(nullptr), hash);
+}
+
+template <class GlobRandomIt>
+void radix_sort(GlobRandomIt begin, GlobRandomIt end)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  dash::radix_sort(begin, end, [](value_t const& v) { return v; });
+}
+
+template <class GlobKeyIt, class GlobValueIt>
+void radix_sort_by_key(
+    GlobKeyIt keys_begin, GlobKeyIt keys_end, GlobValueIt values_begin)
+{
+  using key_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobKeyIt>::value_type>::type;
+
+  if (keys_begin >= keys_end) {
+    keys_begin.pattern().team().barrier();
+    return;
+  }
+  detail::radix_sort__impl(
+      keys_begin, keys_end, &values_begin, [](key_t const& k) { return k; });
+}
+
+#endif  // DOXYGEN
+
+}  // namespace dash
+
+#endif  // DASH__ALGORITHM__RADIX_SORT_H
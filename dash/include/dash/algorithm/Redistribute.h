@@ -0,0 +1,705 @@
+#ifndef DASH__ALGORITHM__REDISTRIBUTE_H__INCLUDED
+#define DASH__ALGORITHM__REDISTRIBUTE_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+
+#include <dash/internal/Logging.h>
+
+#include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_types.h>
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+
+/**
+ * Row length of the square tiles of local transposes in a transposing
+ * redistribution, in bytes, chosen such that a source and a destination
+ * tile fit into the L1 cache.
+ */
+#ifndef DASH_TRANSPOSE_TILE_BYTES
+#define DASH_TRANSPOSE_TILE_BYTES 256
+#endif
+
+namespace dash {
+
+/**
+ * Mapping of element coordinates in the source of a redistribution to
+ * coordinates in the destination.
+ *
+ * \see dash::RedistributeSchedule
+ */
+enum class RedistributeMapping : int {
+  /// Element \c (i,j,...) is transferred to \c (i,j,...).
+  IDENTITY,
+  /// Element \c (i,j) of a two-dimensional source is transferred to
+  /// \c (j,i).
+  TRANSPOSE
+};
+
+namespace internal {
+
+/**
+ * Transposes the elements of a local \c nrows x \c ncols block in tiles of
+ * \c DASH_TRANSPOSE_TILE_BYTES. Row \c r of the source block starts at
+ * \c src + src_row_offsets[r], the result is stored in row-major order to
+ * \c dst, i.e. \c dst[c * nrows + r] = \c src(r,c).
+ */
+template <typename ValueType, typename IndexType>
+void transpose_local(
+  const ValueType * src,
+  const IndexType * src_row_offsets,
+  ValueType       * dst,
+  IndexType         nrows,
+  IndexType         ncols)
+{
+  constexpr IndexType tile = std::max<IndexType>(
+                               1, DASH_TRANSPOSE_TILE_BYTES / sizeof(ValueType));
+  for (IndexType r0 = 0; r0 < nrows; r0 += tile) {
+    IndexType r1 = std::min(r0 + tile, nrows);
+    for (IndexType c0 = 0; c0 < ncols; c0 += tile) {
+      IndexType c1 = std::min(c0 + tile, ncols);
+      for (IndexType r = r0; r < r1; ++r) {
+        const ValueType * src_row = src + src_row_offsets[r];
+        for (IndexType c = c0; c < c1; ++c) {
+          dst[c * nrows + r] = src_row[c];
+        }
+      }
+    }
+  }
+}
+
+} // namespace internal
+
+/**
+ * Schedule of the transfers redistributing the elements of a container
+ * with distribution \c SrcPatternT to a container of the same extents with
+ * distribution \c DstPatternT, e.g. from a \c dash::BlockPattern with
+ * blocked rows to a \c dash::TilePattern before calling \c dash::summa.
+ *
+ * The schedule is computed once from the intersections of the local blocks
+ * of the calling unit in the source pattern with the blocks of the
+ * destination pattern. Every unit transfers the elements in its local
+ * memory: consecutive rows of an intersection are merged into contiguous
+ * transfers, and transfers of equally sized rows with constant distances
+ * in source and destination memory are combined into a single strided
+ * transfer.
+ *
+ * With \c RedistributeMapping::TRANSPOSE, the local blocks are intersected
+ * with the transposed blocks of the destination. Every intersection is
+ * transposed in cache-sized tiles into a buffer, the transfers are
+ * scheduled from this buffer.
+ *
+ * The schedule only depends on the patterns and can be reused to
+ * redistribute any containers with these patterns.
+ *
+ * Example:
+ *
+ * \code
+ *   dash::Matrix<double, 2>                      a_rows(...);
+ *   dash::Matrix<double, 2, index_t, tile_pattern_t> a_tiled(...);
+ *
+ *   dash::RedistributeSchedule<decltype(a_rows.pattern()),
+ *                              tile_pattern_t>
+ *     schedule(a_rows.pattern(), a_tiled.pattern());
+ *
+ *   for (int iter = 0; iter < niter; ++iter) {
+ *     // ...
+ *     dash::redistribute(a_rows, a_tiled, schedule);
+ *   }
+ * \endcode
+ *
+ * \see dash::redistribute
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class SrcPatternT, class DstPatternT>
+class RedistributeSchedule
+{
+private:
+  typedef RedistributeSchedule<SrcPatternT, DstPatternT> self_t;
+
+  static constexpr dim_t NumDimensions = SrcPatternT::ndim();
+
+  static_assert(
+    SrcPatternT::ndim() == DstPatternT::ndim(),
+    "dash::RedistributeSchedule: patterns must have the same dimensions");
+
+public:
+  typedef typename SrcPatternT::index_type                  index_type;
+  typedef typename SrcPatternT::size_type                    size_type;
+  typedef std::array<index_type, NumDimensions>            coords_type;
+
+  /**
+   * Transfer of \c nblocks blocks of \c blocklen contiguous elements from
+   * local memory to the local memory of unit \c unit in the destination.
+   * For transposing schedules, source offsets refer to the buffer of
+   * transposed intersections.
+   */
+  struct transfer_type {
+    team_unit_t unit;
+    index_type  src_offset;
+    index_type  dst_offset;
+    size_type   blocklen;
+    size_type   nblocks;
+    size_type   src_stride;
+    size_type   dst_stride;
+  };
+
+private:
+  /**
+   * Intersection of a local block with a transposed destination block,
+   * \c nrows x \c ncols elements in destination coordinates, transposed
+   * into the buffer at offset \c buf_offset. Offsets of the
+   * \c ncols source rows are stored in \c _pack_src_rows starting at
+   * \c src_rows.
+   */
+  struct pack_type {
+    index_type buf_offset;
+    index_type nrows;
+    index_type ncols;
+    size_t     src_rows;
+  };
+
+public:
+  /**
+   * Computes the schedule of the calling unit for the given source and
+   * destination pattern.
+   *
+   * \throws dash::exception::InvalidArgument  if the extents of the
+   *                                           destination differ from the
+   *                                           (transposed) extents of the
+   *                                           source, or if a transposing
+   *                                           schedule is requested for
+   *                                           patterns that are not
+   *                                           two-dimensional and row-major
+   */
+  RedistributeSchedule(
+    const SrcPatternT   & src_pattern,
+    const DstPatternT   & dst_pattern,
+    RedistributeMapping   mapping = RedistributeMapping::IDENTITY)
+  : _team(&src_pattern.team()),
+    _mapping(mapping)
+  {
+    DASH_LOG_DEBUG("RedistributeSchedule()");
+    bool transposed = (mapping == RedistributeMapping::TRANSPOSE);
+    if (transposed &&
+        (NumDimensions != 2 ||
+         SrcPatternT::memory_order() != dash::ROW_MAJOR)) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::RedistributeSchedule: transposing redistribution requires "
+        "two-dimensional row-major patterns");
+    }
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      auto src_extent = src_pattern.extent(
+                          transposed ? NumDimensions - 1 - d : d);
+      if (src_extent != dst_pattern.extent(d)) {
+        DASH_THROW(
+          dash::exception::InvalidArgument,
+          "dash::RedistributeSchedule: extent of destination in " <<
+          "dimension " << d << " differs from " <<
+          (transposed ? "transposed " : "") << "extent of source: " <<
+          dst_pattern.extent(d) << " != " << src_extent);
+      }
+    }
+    if (SrcPatternT::memory_order() != DstPatternT::memory_order()) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::RedistributeSchedule: memory orders of patterns differ");
+    }
+    if (transposed) {
+      init_transposed_transfers(src_pattern, dst_pattern);
+    } else {
+      init_transfers(src_pattern, dst_pattern);
+    }
+    DASH_LOG_DEBUG("RedistributeSchedule >",
+                   "transfers:", _transfers.size());
+  }
+
+  ~RedistributeSchedule()
+  {
+    destroy_types();
+  }
+
+  RedistributeSchedule(const self_t & other)            = delete;
+  self_t & operator=(const self_t & other)              = delete;
+
+  /**
+   * Transfers of the calling unit, ordered by source offset.
+   */
+  const std::vector<transfer_type> & transfers() const noexcept
+  {
+    return _transfers;
+  }
+
+  /**
+   * The team of the source pattern.
+   */
+  dash::Team & team() const noexcept
+  {
+    return *_team;
+  }
+
+  /**
+   * Mapping of source coordinates to destination coordinates.
+   */
+  RedistributeMapping mapping() const noexcept
+  {
+    return _mapping;
+  }
+
+  /**
+   * Redistributes the elements of container \c src to container \c dst.
+   * For transposing schedules, \c src and \c dst may be the same
+   * container.
+   *
+   * Collective operation on the team of the source pattern.
+   */
+  template <class SrcContainerT, class DstContainerT>
+  void execute(
+    const SrcContainerT & src,
+    DstContainerT       & dst)
+  {
+    typedef typename DstContainerT::value_type value_t;
+    static_assert(
+      std::is_same<
+        typename std::remove_cv<typename SrcContainerT::value_type>::type,
+        value_t>::value,
+      "dash::redistribute: value types of containers differ");
+
+    DASH_LOG_DEBUG("RedistributeSchedule.execute()");
+    // Elements in the destination may still be accessed by other units:
+    _team->barrier();
+
+    const value_t * l_src  = src.lbegin();
+    value_t       * l_dst  = dst.lbegin();
+    auto myid              = _team->myid();
+    dart_gptr_t dst_gbegin = static_cast<dart_gptr_t>(
+                               dst.begin().globmem().begin());
+
+    std::vector<value_t> buffer;
+    if (_mapping == RedistributeMapping::TRANSPOSE) {
+      buffer.resize(_pack_size);
+      for (const auto & pack : _packs) {
+        internal::transpose_local(
+          l_src, _pack_src_rows.data() + pack.src_rows,
+          buffer.data() + pack.buf_offset, pack.ncols, pack.nrows);
+      }
+      if (static_cast<const void *>(&src) ==
+          static_cast<const void *>(&dst)) {
+        // In-place: all units have to finish reading their local elements
+        // before they are overwritten:
+        _team->barrier();
+      }
+      l_src = buffer.data();
+    }
+
+    init_types<value_t>();
+
+    std::vector<dart_handle_t> handles;
+    handles.reserve(_transfers.size());
+    for (size_t t = 0; t < _transfers.size(); ++t) {
+      const auto & tr = _transfers[t];
+      if (tr.unit == myid) {
+        for (size_type b = 0; b < tr.nblocks; ++b) {
+          std::copy(l_src + tr.src_offset + b * tr.src_stride,
+                    l_src + tr.src_offset + b * tr.src_stride + tr.blocklen,
+                    l_dst + tr.dst_offset + b * tr.dst_stride);
+        }
+        continue;
+      }
+      dart_gptr_t gptr = dst_gbegin;
+      gptr.unitid      = tr.unit;
+      gptr.addr_or_offs.offset += tr.dst_offset * sizeof(value_t);
+
+      dart_handle_t handle;
+      if (tr.nblocks == 1) {
+        dash::dart_storage<value_t> ds(tr.blocklen);
+        DASH_ASSERT_RETURNS(
+          dart_put_handle(gptr, l_src + tr.src_offset,
+                          ds.nelem, ds.dtype, ds.dtype, &handle),
+          DART_OK);
+      } else {
+        dash::dart_storage<value_t> ds(tr.nblocks * tr.blocklen);
+        DASH_ASSERT_RETURNS(
+          dart_put_handle(gptr, l_src + tr.src_offset,
+                          ds.nelem, _types[t].first, _types[t].second,
+                          &handle),
+          DART_OK);
+      }
+      if (handle != DART_HANDLE_NULL) {
+        handles.push_back(handle);
+      }
+    }
+    if (!handles.empty()) {
+      DASH_ASSERT_RETURNS(
+        dart_waitall(handles.data(), handles.size()),
+        DART_OK);
+    }
+    // Wait for the transfers of all units:
+    _team->barrier();
+    DASH_LOG_DEBUG("RedistributeSchedule.execute >");
+  }
+
+private:
+  /**
+   * Appends a row of \c len contiguous elements to the transfers, merged
+   * with the previous row of the same intersection if contiguous in source
+   * and destination.
+   */
+  void add_row(
+    team_unit_t unit,
+    index_type  src_offset,
+    index_type  dst_offset,
+    size_type   len,
+    bool        first_row)
+  {
+    if (!first_row) {
+      auto & last = _transfers.back();
+      if (last.unit == unit && last.nblocks == 1 &&
+          last.src_offset + static_cast<index_type>(last.blocklen)
+            == src_offset &&
+          last.dst_offset + static_cast<index_type>(last.blocklen)
+            == dst_offset) {
+        last.blocklen += len;
+        return;
+      }
+    }
+    _transfers.push_back(
+      transfer_type { unit, src_offset, dst_offset, len, 1, 0, 0 });
+  }
+
+  void init_transfers(
+    const SrcPatternT & src_pattern,
+    const DstPatternT & dst_pattern)
+  {
+    const dim_t fast_dim = (SrcPatternT::memory_order() == dash::ROW_MAJOR)
+                           ? NumDimensions - 1
+                           : 0;
+    auto num_local_blocks = src_pattern.local_blockspec().size();
+    for (size_type lb = 0; lb < num_local_blocks; ++lb) {
+      auto src_block = src_pattern.local_block(lb);
+      if (src_block.size() == 0) {
+        continue;
+      }
+      // Range of blocks in the destination pattern overlapping the source
+      // block:
+      coords_type b_first, b_last;
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        auto bs_d = static_cast<index_type>(dst_pattern.blocksize(d));
+        b_first[d] = src_block.offset(d) / bs_d;
+        b_last[d]  = (src_block.offset(d) + src_block.extent(d) - 1) / bs_d;
+      }
+      coords_type b_coords = b_first;
+      while (true) {
+        add_intersection(src_pattern, dst_pattern, src_block,
+                         dst_pattern.block(
+                           dst_pattern.blockspec().at(b_coords)),
+                         fast_dim);
+        if (!next_coords(b_coords, b_first, b_last, NumDimensions)) {
+          break;
+        }
+      }
+    }
+    combine_strided();
+  }
+
+  void init_transposed_transfers(
+    const SrcPatternT & src_pattern,
+    const DstPatternT & dst_pattern)
+  {
+    auto num_local_blocks = src_pattern.local_blockspec().size();
+    for (size_type lb = 0; lb < num_local_blocks; ++lb) {
+      auto src_block = src_pattern.local_block(lb);
+      if (src_block.size() == 0) {
+        continue;
+      }
+      // Transposed source block in destination coordinates:
+      coords_type t_lo, t_hi;
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        dim_t src_d = NumDimensions - 1 - d;
+        t_lo[d] = src_block.offset(src_d);
+        t_hi[d] = src_block.offset(src_d) + src_block.extent(src_d) - 1;
+      }
+      coords_type b_first, b_last;
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        auto bs_d = static_cast<index_type>(dst_pattern.blocksize(d));
+        b_first[d] = t_lo[d] / bs_d;
+        b_last[d]  = t_hi[d] / bs_d;
+      }
+      coords_type b_coords = b_first;
+      while (true) {
+        add_transposed_intersection(
+          src_pattern, dst_pattern, t_lo, t_hi,
+          dst_pattern.block(dst_pattern.blockspec().at(b_coords)));
+        if (!next_coords(b_coords, b_first, b_last, NumDimensions)) {
+          break;
+        }
+      }
+    }
+    combine_strided();
+  }
+
+  template <class SrcViewSpecT, class DstViewSpecT>
+  void add_intersection(
+    const SrcPatternT  & src_pattern,
+    const DstPatternT  & dst_pattern,
+    const SrcViewSpecT & src_block,
+    const DstViewSpecT & dst_block,
+    dim_t                fast_dim)
+  {
+    coords_type lo, hi;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      lo[d] = std::max<index_type>(src_block.offset(d), dst_block.offset(d));
+      hi[d] = std::min<index_type>(
+                src_block.offset(d) + src_block.extent(d),
+                dst_block.offset(d) + dst_block.extent(d)) - 1;
+      if (hi[d] < lo[d]) {
+        return;
+      }
+    }
+    auto unit    = dst_pattern.unit_at(lo);
+    auto row_len = static_cast<size_type>(hi[fast_dim] - lo[fast_dim] + 1);
+    // Rows of the intersection in the fastest dimension are contiguous in
+    // the local memory of source and destination:
+    coords_type row_last = hi;
+    row_last[fast_dim]   = lo[fast_dim];
+    coords_type coords   = lo;
+    bool        first    = true;
+    while (true) {
+      auto src_offset = src_pattern.local_index(coords).index;
+      auto dst_offset = dst_pattern.local_index(coords).index;
+      add_row(unit, src_offset, dst_offset, row_len, first);
+      first = false;
+      if (!next_coords(coords, lo, row_last, fast_dim)) {
+        break;
+      }
+    }
+  }
+
+  /**
+   * Schedules the intersection of the transposed source block
+   * \c [t_lo, t_hi] with a block of the destination: the intersection is
+   * transposed into the buffer, its rows are transferred from there.
+   */
+  template <class DstViewSpecT>
+  void add_transposed_intersection(
+    const SrcPatternT  & src_pattern,
+    const DstPatternT  & dst_pattern,
+    const coords_type  & t_lo,
+    const coords_type  & t_hi,
+    const DstViewSpecT & dst_block)
+  {
+    coords_type lo, hi;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      lo[d] = std::max<index_type>(t_lo[d], dst_block.offset(d));
+      hi[d] = std::min<index_type>(
+                t_hi[d], dst_block.offset(d) + dst_block.extent(d) - 1);
+      if (hi[d] < lo[d]) {
+        return;
+      }
+    }
+    index_type nrows = hi[0] - lo[0] + 1;
+    index_type ncols = hi[1] - lo[1] + 1;
+
+    // Rows of the intersection in the source are its columns in the
+    // destination:
+    pack_type pack { static_cast<index_type>(_pack_size), nrows, ncols,
+                     _pack_src_rows.size() };
+    for (index_type c = 0; c < ncols; ++c) {
+      coords_type src_coords {{ lo[1] + c, lo[0] }};
+      _pack_src_rows.push_back(src_pattern.local_index(src_coords).index);
+    }
+    _packs.push_back(pack);
+    _pack_size += nrows * ncols;
+
+    auto unit = dst_pattern.unit_at(lo);
+    for (index_type r = 0; r < nrows; ++r) {
+      coords_type dst_coords {{ lo[0] + r, lo[1] }};
+      add_row(unit,
+              pack.buf_offset + r * ncols,
+              dst_pattern.local_index(dst_coords).index,
+              static_cast<size_type>(ncols),
+              r == 0);
+    }
+  }
+
+  /**
+   * Advances \c coords in the range \c [first, last] in row-major order,
+   * skipping dimension \c skip_dim. Returns false at the end of the range.
+   */
+  static bool next_coords(
+    coords_type       & coords,
+    const coords_type & first,
+    const coords_type & last,
+    dim_t               skip_dim)
+  {
+    for (int d = NumDimensions - 1; d >= 0; --d) {
+      if (d == skip_dim) {
+        continue;
+      }
+      if (coords[d] < last[d]) {
+        ++coords[d];
+        return true;
+      }
+      coords[d] = first[d];
+    }
+    return false;
+  }
+
+  /**
+   * Combines consecutive transfers to the same unit with equal size and
+   * constant distances in source and destination into strided transfers.
+   */
+  void combine_strided()
+  {
+    std::vector<transfer_type> combined;
+    for (const auto & tr : _transfers) {
+      if (!combined.empty()) {
+        auto & last = combined.back();
+        if (last.unit == tr.unit && last.blocklen == tr.blocklen &&
+            tr.src_offset > last.src_offset &&
+            tr.dst_offset > last.dst_offset) {
+          size_type src_stride = tr.src_offset
+                                 - (last.src_offset +
+                                    (last.nblocks - 1) * last.src_stride);
+          size_type dst_stride = tr.dst_offset
+                                 - (last.dst_offset +
+                                    (last.nblocks - 1) * last.dst_stride);
+          if (last.nblocks == 1 &&
+              src_stride >= tr.blocklen && dst_stride >= tr.blocklen) {
+            last.src_stride = src_stride;
+            last.dst_stride = dst_stride;
+            last.nblocks    = 2;
+            continue;
+          }
+          if (last.nblocks > 1 &&
+              src_stride == last.src_stride &&
+              dst_stride == last.dst_stride) {
+            ++last.nblocks;
+            continue;
+          }
+        }
+      }
+      combined.push_back(tr);
+    }
+    _transfers = std::move(combined);
+  }
+
+  /**
+   * Creates the strided DART data types of the transfers for element type
+   * \c ValueType, reused in subsequent executions.
+   */
+  template <class ValueType>
+  void init_types()
+  {
+    dash::dart_storage<ValueType> ds(1);
+    if (!_types.empty() && _types_basetype == ds.dtype &&
+        _types_elem_size == ds.nelem) {
+      return;
+    }
+    destroy_types();
+    _types_basetype  = ds.dtype;
+    _types_elem_size = ds.nelem;
+    _types.resize(_transfers.size(),
+                  std::make_pair(DART_TYPE_UNDEFINED, DART_TYPE_UNDEFINED));
+    for (size_t t = 0; t < _transfers.size(); ++t) {
+      const auto & tr = _transfers[t];
+      if (tr.nblocks == 1) {
+        continue;
+      }
+      DASH_ASSERT_RETURNS(
+        dart_type_create_strided(ds.dtype,
+                                 tr.src_stride * ds.nelem,
+                                 tr.blocklen * ds.nelem,
+                                 &_types[t].first),
+        DART_OK);
+      DASH_ASSERT_RETURNS(
+        dart_type_create_strided(ds.dtype,
+                                 tr.dst_stride * ds.nelem,
+                                 tr.blocklen * ds.nelem,
+                                 &_types[t].second),
+        DART_OK);
+    }
+  }
+
+  void destroy_types()
+  {
+    for (auto & types : _types) {
+      if (types.first != DART_TYPE_UNDEFINED) {
+        dart_type_destroy(&types.first);
+        dart_type_destroy(&types.second);
+      }
+    }
+    _types.clear();
+  }
+
+private:
+  dash::Team                                           * _team;
+  RedistributeMapping                                    _mapping;
+  std::vector<transfer_type>                             _transfers;
+  std::vector<pack_type>                                 _packs;
+  std::vector<index_type>                                _pack_src_rows;
+  size_type                                              _pack_size = 0;
+  std::vector<std::pair<dart_datatype_t, dart_datatype_t>> _types;
+  dart_datatype_t                                        _types_basetype
+                                                           = DART_TYPE_UNDEFINED;
+  size_t                                                 _types_elem_size = 0;
+};
+
+/**
+ * Redistributes the elements of container \c src to container \c dst with
+ * the same extents but a different distribution, using a precomputed
+ * schedule.
+ *
+ * Collective operation on the team of the source container.
+ *
+ * \see dash::RedistributeSchedule
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class SrcContainerT, class DstContainerT, class ScheduleT>
+void redistribute(
+  const SrcContainerT & src,
+  DstContainerT       & dst,
+  ScheduleT           & schedule)
+{
+  schedule.execute(src, dst);
+}
+
+/**
+ * Redistributes the elements of container \c src to container \c dst with
+ * the same extents but a different distribution, e.g. from blocked rows to
+ * a tiled or block-cyclic distribution.
+ *
+ * Every element is transferred to the element at the same coordinates in
+ * the destination. The transfer schedule is computed for every call, use
+ * \c dash::RedistributeSchedule to reuse it for repeated redistributions.
+ *
+ * Collective operation on the team of the source container.
+ *
+ * \see dash::RedistributeSchedule
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class SrcContainerT, class DstContainerT>
+void redistribute(
+  const SrcContainerT & src,
+  DstContainerT       & dst)
+{
+  typedef typename std::decay<decltype(src.pattern())>::type src_pattern_t;
+  typedef typename std::decay<decltype(dst.pattern())>::type dst_pattern_t;
+  RedistributeSchedule<src_pattern_t, dst_pattern_t> schedule(
+    src.pattern(), dst.pattern());
+  schedule.execute(src, dst);
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__REDISTRIBUTE_H__INCLUDED
@@ -7,6 +7,10 @@
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 
+#include <dash/Future.h>
+
+#include <memory>
+
 
 namespace dash {
 
@@ -38,6 +42,172 @@ namespace internal {
       }
     }
   }
+
+  /**
+   * Combines the local results of all units in \c team using \c binary_op,
+   * with a predefined DART reduction if possible.
+   */
+  template<typename ValueType, typename BinaryOperation>
+  local_result<ValueType> reduce_local_results(
+    const local_result<ValueType> & l_result,
+    BinaryOperation                 binary_op,
+    bool                            non_empty,
+    dash::Team                    & team)
+  {
+    using local_result_t = struct local_result<ValueType>;
+    local_result_t g_result;
+    dart_operation_t dop =
+                  dash::internal::dart_reduce_operation<BinaryOperation>::value;
+    dart_datatype_t  dtype = dash::dart_storage<ValueType>::dtype;
+
+    if (!non_empty || dop == DART_OP_UNDEFINED || dtype == DART_TYPE_UNDEFINED)
+    {
+      dart_type_create_custom(sizeof(local_result_t), &dtype);
+
+      // we need a custom reduction operation because not every unit
+      // may have valid values
+      dart_op_create(
+        &dash::internal::reduce_custom_fn<ValueType, BinaryOperation>,
+        &binary_op, true, dtype, true, &dop);
+      dart_allreduce(&l_result, &g_result, 1, dtype, dop, team.dart_id());
+      dart_op_destroy(&dop);
+      dart_type_destroy(&dtype);
+    } else {
+      // ideal case: we can use DART predefined reductions
+      dart_allreduce(
+        &l_result.value, &g_result.value, 1, dtype, dop, team.dart_id());
+      g_result.valid = true;
+    }
+    if (!g_result.valid) {
+      DASH_LOG_ERROR("dash::reduce()", "Found invalid reduction value!");
+    }
+    return g_result;
+  }
+
+  /**
+   * State of a non-blocking reduction of local results, shared by the
+   * callbacks of the \c dash::Future returned for the reduction.
+   * The buffers and a custom reduction operation have to outlive the
+   * pending DART operation, so the destructor waits for its completion.
+   */
+  template<typename ValueType, typename BinaryOperation>
+  struct reduce_async_state {
+    local_result<ValueType> l_result;
+    local_result<ValueType> g_result;
+    BinaryOperation         binary_op;
+    dart_datatype_t         dtype  = DART_TYPE_UNDEFINED;
+    dart_operation_t        dop    = DART_OP_UNDEFINED;
+    bool                    custom = false;
+    dart_handle_t           handle = DART_HANDLE_NULL;
+
+    reduce_async_state(
+      const local_result<ValueType> & l_result,
+      BinaryOperation                 binary_op)
+    : l_result(l_result),
+      binary_op(binary_op)
+    { }
+
+    reduce_async_state(const reduce_async_state & other) = delete;
+    reduce_async_state & operator=(const reduce_async_state & other) = delete;
+
+    ~reduce_async_state()
+    {
+      if (handle != DART_HANDLE_NULL) {
+        wait();
+      }
+      if (custom) {
+        dart_op_destroy(&dop);
+        dart_type_destroy(&dtype);
+      }
+    }
+
+    void wait()
+    {
+      DASH_ASSERT_RETURNS(dart_wait_local(&handle), DART_OK);
+      complete();
+    }
+
+    bool test()
+    {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(dart_test_local(&handle, &flag), DART_OK);
+      if (flag) {
+        complete();
+      }
+      return (flag != 0);
+    }
+
+  private:
+    void complete()
+    {
+      if (!custom) {
+        g_result.valid = true;
+      }
+    }
+  };
+
+  /**
+   * Starts a non-blocking reduction of the local results of all units in
+   * \c team using \c binary_op.
+   *
+   * \returns  A future providing the value returned by \c result_fn for the
+   *           combined result.
+   */
+  template<
+    typename ResultType,
+    typename ValueType,
+    typename BinaryOperation,
+    typename ResultFunction>
+  dash::Future<ResultType> reduce_local_results_async(
+    const local_result<ValueType> & l_result,
+    BinaryOperation                 binary_op,
+    bool                            non_empty,
+    dash::Team                    & team,
+    ResultFunction                  result_fn)
+  {
+    using state_t = reduce_async_state<ValueType, BinaryOperation>;
+    auto state    = std::make_shared<state_t>(l_result, binary_op);
+    state->dop    =
+                  dash::internal::dart_reduce_operation<BinaryOperation>::value;
+    state->dtype  = dash::dart_storage<ValueType>::dtype;
+
+    if (!non_empty ||
+        state->dop == DART_OP_UNDEFINED || state->dtype == DART_TYPE_UNDEFINED)
+    {
+      state->custom = true;
+      dart_type_create_custom(sizeof(local_result<ValueType>), &state->dtype);
+      // the operation refers to the reduce function in the shared state
+      dart_op_create(
+        &dash::internal::reduce_custom_fn<ValueType, BinaryOperation>,
+        &state->binary_op, true, state->dtype, true, &state->dop);
+      DASH_ASSERT_RETURNS(
+        dart_allreduce_handle(
+          &state->l_result, &state->g_result, 1,
+          state->dtype, state->dop, team.dart_id(), &state->handle),
+        DART_OK);
+    } else {
+      DASH_ASSERT_RETURNS(
+        dart_allreduce_handle(
+          &state->l_result.value, &state->g_result.value, 1,
+          state->dtype, state->dop, team.dart_id(), &state->handle),
+        DART_OK);
+    }
+
+    return dash::Future<ResultType>(
+      // wait
+      [state, result_fn]() {
+        state->wait();
+        return result_fn(state->g_result);
+      },
+      // test
+      [state, result_fn](ResultType * out) {
+        if (state->test()) {
+          *out = result_fn(state->g_result);
+          return true;
+        }
+        return false;
+      });
+  }
 } // namespace internal
 
 
@@ -91,37 +261,14 @@ reduce(
   auto l_last      = in_last;
 
   local_result_t l_result;
-  local_result_t g_result;
   if (l_first != l_last) {
     l_result.value = std::accumulate(std::next(l_first),
                                      l_last, *l_first,
                                      binary_op);
     l_result.valid = true;
   }
-  dart_operation_t dop =
-                  dash::internal::dart_reduce_operation<BinaryOperation>::value;
-  dart_datatype_t  dtype = dash::dart_storage<value_t>::dtype;
-
-  if (!non_empty || dop == DART_OP_UNDEFINED || dtype == DART_TYPE_UNDEFINED)
-  {
-    dart_type_create_custom(sizeof(local_result_t), &dtype);
-
-    // we need a custom reduction operation because not every unit
-    // may have valid values
-    dart_op_create(
-      &dash::internal::reduce_custom_fn<value_t, BinaryOperation>,
-      &binary_op, true, dtype, true, &dop);
-    dart_allreduce(&l_result, &g_result, 1, dtype, dop, team.dart_id());
-    dart_op_destroy(&dop);
-    dart_type_destroy(&dtype);
-  } else {
-    // ideal case: we can use DART predefined reductions
-    dart_allreduce(&l_result.value, &g_result.value, 1, dtype, dop, team.dart_id());
-    g_result.valid = true;
-  }
-  if (!g_result.valid) {
-    DASH_LOG_ERROR("dash::reduce()", "Found invalid reduction value!");
-  }
+  auto g_result = dash::internal::reduce_local_results(
+                    l_result, binary_op, non_empty, team);
   auto result = g_result.value;
 
   result = binary_op(init, result);
@@ -230,6 +377,113 @@ reduce(
                       team);
 }
 
+/**
+ * Asynchronous variant of \c dash::reduce on local ranges.
+ * Accumulates the values in the local range and starts a non-blocking
+ * reduction of the local results of all units.
+ *
+ * The returned future can be tested for the result or waited for.
+ * Destroying the future waits for the completion of the reduction.
+ *
+ * Collective operation.
+ *
+ * \returns  A \c dash::Future providing the reduced value.
+ *
+ * \see dash::reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class LocalInputIter,
+  class InitType,
+  class BinaryOperation
+        = dash::plus<typename std::iterator_traits<LocalInputIter>::value_type>,
+  typename = typename std::enable_if<
+                        !dash::detail::is_global_iterator<LocalInputIter>::value
+                      >::type>
+dash::Future<typename std::iterator_traits<LocalInputIter>::value_type>
+reduce_async(
+  LocalInputIter    in_first,
+  LocalInputIter    in_last,
+  InitType          init,
+  BinaryOperation   binary_op = BinaryOperation(),
+  bool              non_empty = true,
+  dash::Team      & team = dash::Team::All())
+{
+  using value_t        = typename std::iterator_traits<LocalInputIter>::value_type;
+  using local_result_t = struct dash::internal::local_result<value_t>;
+
+  local_result_t l_result;
+  if (in_first != in_last) {
+    l_result.value = std::accumulate(std::next(in_first),
+                                     in_last, *in_first,
+                                     binary_op);
+    l_result.valid = true;
+  }
+  value_t init_value = init;
+  return dash::internal::reduce_local_results_async<value_t>(
+           l_result, binary_op, non_empty, team,
+           [init_value, binary_op](const local_result_t & g_result) {
+             if (!g_result.valid) {
+               DASH_LOG_ERROR("dash::reduce_async()",
+                              "Found invalid reduction value!");
+             }
+             return binary_op(init_value, g_result.value);
+           });
+}
+
+/**
+ * Asynchronous variant of \c dash::reduce on global ranges.
+ * Accumulates the local values in the range and starts a non-blocking
+ * reduction of the local results of all units.
+ *
+ * Collective operation.
+ *
+ * Example:
+ *
+ * \code
+ *   auto fut_residual = dash::reduce_async(
+ *                         residuals.begin(), residuals.end(),
+ *                         0.0, dash::max<double>());
+ *   // ... overlap with the next iteration ...
+ *   if (fut_residual.get() < epsilon) {
+ *     // converged
+ *   }
+ * \endcode
+ *
+ * \returns  A \c dash::Future providing the reduced value.
+ *
+ * \see dash::reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class InitType = typename dash::iterator_traits<GlobInputIt>::value_type,
+  class BinaryOperation
+          = dash::plus<typename dash::iterator_traits<GlobInputIt>::value_type>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+dash::Future<typename dash::iterator_traits<GlobInputIt>::value_type>
+reduce_async(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  InitType        init,
+  BinaryOperation binary_op = BinaryOperation())
+{
+  auto & team      = in_first.team();
+  auto index_range = dash::local_range(in_first, in_last);
+  // units may have empty local ranges
+  static constexpr bool units_non_empty = false;
+  return dash::reduce_async(index_range.begin,
+                            index_range.end,
+                            init,
+                            binary_op,
+                            units_non_empty,
+                            team);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__REDUCE_H__
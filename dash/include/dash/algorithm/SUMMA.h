@@ -6,6 +6,7 @@
 #include <dash/Pattern.h>
 #include <dash/Types.h>
 #include <dash/algorithm/Copy.h>
+#include <dash/algorithm/internal/Gemm.h>
 #include <dash/util/Trace.h>
 
 #include <utility>
@@ -49,43 +50,24 @@ void mmult_local(
   MemArrange        storage);
 #else
 /**
- * Naive matrix multiplication for local multiplication of matrix blocks,
- * used only for tests and where MKL is not available.
+ * Matrix multiplication for local multiplication of matrix blocks via the
+ * built-in cache-blocked GEMM kernel, used where neither MKL nor BLAS is
+ * available.
  */
 template <typename ValueType>
 void mmult_local(
-    /// Matrix to multiply, extents n x m
-    const ValueType *A,
-    /// Matrix to multiply, extents m x p
-    const ValueType *B,
-    /// Matrix to contain the multiplication result, extents n x p
-    ValueType *C,
-    long long  m,
-    long long  n,
-    long long  p,
-    MemArrange /*storage*/)
+  /// Matrix to multiply, m rows by k columns.
+  const ValueType * A,
+  /// Matrix to multiply, k rows by n columns.
+  const ValueType * B,
+  /// Matrix to contain the multiplication result, m rows by n columns.
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  MemArrange        storage)
 {
-#ifndef DEBUG
-  DASH_THROW(
-    dash::exception::RuntimeError,
-    "Called fallback implementation of DGEMM (only enabled in Debug)");
-#endif
-  ValueType c_sum = 0;
-  for (auto i = 0; i < n; ++i) {
-    // row i = 0...n
-    for (auto j = 0; j < p; ++j) {
-      // column j = 0...p
-      c_sum = C[i * p + j]; // = C[j][i]
-      for (auto k = 0; k < m; ++k) {
-        // k = 0...m
-        auto ik     = i * m + k;
-        auto kj     = k * m + j;
-        auto value  = A[ik] * B[kj];
-        c_sum      += value;
-      }
-      C[i * p + j] = c_sum; // C[j][i] = c_sum
-    }
-  }
+  dash::internal::gemm_local(A, B, C, m, n, k, storage);
 }
 #endif // defined(DASH_ENABLE_MKL) || defined(DASH_ENABLE_BLAS)
 
@@ -268,7 +250,26 @@ void summa(
 
   DASH_LOG_TRACE("dash::summa", "matrix pattern extents valid");
 
-  // Patterns are balanced, all blocks have identical size:
+  // Patterns are balanced, all blocks have identical size. Blocks of A
+  // and B are iterated by the same block index in the inner dimension and
+  // local buffers are sized for blocks of A and B, so all matrices must
+  // consist of square blocks of identical size:
+  for (dim_t d = 0; d < 2; ++d) {
+    if (pattern_a.block(0).extent(d) != pattern_a.block(0).extent(0) ||
+        pattern_b.block(0).extent(d) != pattern_a.block(0).extent(0) ||
+        pattern_c.block(0).extent(d) != pattern_a.block(0).extent(0)) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::summa(): "
+        "expected square blocks of identical size in all matrices, got " <<
+        "A: " << pattern_a.block(0).extent(0) << "x" <<
+                 pattern_a.block(0).extent(1) << " " <<
+        "B: " << pattern_b.block(0).extent(0) << "x" <<
+                 pattern_b.block(0).extent(1) << " " <<
+        "C: " << pattern_c.block(0).extent(0) << "x" <<
+                 pattern_c.block(0).extent(1));
+    }
+  }
   auto block_size_m   = pattern_a.block(0).extent(0);
   auto block_size_n   = pattern_b.block(0).extent(1);
   auto block_size_p   = pattern_b.block(0).extent(0);
@@ -0,0 +1,515 @@
+#ifndef DASH__ALGORITHM__SUMMA25D_H_
+#define DASH__ALGORITHM__SUMMA25D_H_
+
+#include <dash/Exception.h>
+#include <dash/Pattern.h>
+#include <dash/Team.h>
+#include <dash/TeamSpec.h>
+#include <dash/Types.h>
+#include <dash/algorithm/SUMMA.h>
+#include <dash/util/Trace.h>
+#include <dash/util/UnitLocality.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+/**
+ * Fraction of the memory available to a unit that may be allocated for
+ * replicated blocks in \c dash::summa_25d.
+ */
+#define DASH_ALGORITHM_SUMMA_25D_MEM_FRACTION 0.25
+
+namespace dash {
+
+namespace internal {
+
+/**
+ * Arrangement of units in \c dash::summa_25d.
+ *
+ * The team is arranged in a 3-dimensional team spec of extents
+ * \c (layers, grid rows, grid columns). Every layer covers the complete
+ * result matrix in a 2-dimensional grid and multiplies a subrange of the
+ * block columns of A and block rows of B.
+ */
+class Summa25DLayout
+{
+public:
+  typedef dash::default_size_t            size_type;
+  typedef std::array<size_type, 2>        range_type;
+
+public:
+  Summa25DLayout(
+    size_type num_units,
+    size_type num_layers)
+  : _teamspec(make_teamspec(num_units, num_layers))
+  { }
+
+  const dash::TeamSpec<3> & teamspec() const
+  {
+    return _teamspec;
+  }
+
+  /**
+   * Range of blocks \c [first, last) in dimension \c dim of the result
+   * matrix of \c nblocks blocks in total that is computed by the given
+   * unit, or the range of block columns of A and block rows of B
+   * multiplied by the unit's layer for \c dim = 2.
+   */
+  range_type block_range(
+    team_unit_t unit,
+    int         dim,
+    size_type   nblocks) const
+  {
+    auto coords   = _teamspec.coords(unit);
+    // Team spec dimension 0 is the layer:
+    int  ts_dim   = (dim + 1) % 3;
+    auto nparts   = _teamspec.extent(ts_dim);
+    auto part     = coords[ts_dim];
+    return range_type {{ nblocks * part / nparts,
+                         nblocks * (part + 1) / nparts }};
+  }
+
+private:
+  static dash::TeamSpec<3> make_teamspec(
+    size_type num_units,
+    size_type num_layers)
+  {
+    // Balanced 2-dimensional grid in every layer:
+    dash::TeamSpec<2> grid(num_units / num_layers, 1);
+    grid.balance_extents();
+    return dash::TeamSpec<3>(num_layers, grid.extent(0), grid.extent(1));
+  }
+
+private:
+  dash::TeamSpec<3> _teamspec;
+};
+
+/**
+ * Number of elements allocated per unit in \c dash::summa_25d with
+ * the given number of layers.
+ */
+template <typename SizeType>
+SizeType summa_25d_buffer_size(
+  SizeType num_units,
+  SizeType num_layers,
+  SizeType num_blocks_m,
+  SizeType num_blocks_n,
+  SizeType block_size_m,
+  SizeType block_size_n,
+  SizeType block_size_k)
+{
+  Summa25DLayout layout(num_units, num_layers);
+  auto ts     = layout.teamspec();
+  auto rows   = (num_blocks_m + ts.extent(1) - 1) / ts.extent(1);
+  auto cols   = (num_blocks_n + ts.extent(2) - 1) / ts.extent(2);
+  // Partial results of the result blocks and double-buffered blocks of
+  // A and B:
+  return (rows * cols * block_size_m * block_size_n) +
+         (2 * rows * block_size_m * block_size_k) +
+         (2 * cols * block_size_k * block_size_n);
+}
+
+/**
+ * Unit and local offset of the first element of the block at the given
+ * block coordinates in a matrix with blocked pattern layout.
+ */
+template <typename PatternType>
+std::pair<team_unit_t, typename PatternType::index_type>
+summa_25d_block_location(
+  const PatternType                                      & pattern,
+  const std::array<typename PatternType::index_type, 2> & block_coords)
+{
+  auto block = pattern.block(pattern.blockspec().at(block_coords));
+  std::array<typename PatternType::index_type, 2> coords {{
+    block.offset(0), block.offset(1) }};
+  return std::make_pair(pattern.unit_at(coords),
+                        pattern.local_index(coords).index);
+}
+
+/**
+ * Number of layers in \c dash::summa_25d for matrices of element type
+ * \c ValueType with the given patterns.
+ *
+ * \see  dash::summa_25d_num_layers
+ */
+template<
+  typename ValueType,
+  typename PatternTypeA,
+  typename PatternTypeB >
+typename PatternTypeA::size_type summa_25d_num_layers(
+  const PatternTypeA & pattern_a,
+  const PatternTypeB & pattern_b,
+  dash::Team         & team)
+{
+  typedef typename PatternTypeA::size_type extent_t;
+
+  extent_t num_units      = team.size();
+  auto block_a            = pattern_a.block(0);
+  auto block_b            = pattern_b.block(0);
+  extent_t block_size_m   = block_a.extent(0);
+  extent_t block_size_k   = block_a.extent(1);
+  extent_t block_size_n   = block_b.extent(1);
+  extent_t num_blocks_m   = pattern_a.extent(0) / block_size_m;
+  extent_t num_blocks_k   = pattern_a.extent(1) / block_size_k;
+  extent_t num_blocks_n   = pattern_b.extent(1) / block_size_n;
+
+  // Memory per unit in bytes, system memory is reported in MB:
+  dash::util::UnitLocality uloc(team, team.myid());
+  double mem_node   = uloc.hwinfo().system_memory_bytes;
+  auto   node_units = std::max<size_t>(
+                        1, uloc.node_domain().units().size());
+  double mem_avail  = (mem_node * 1024 * 1024 / node_units) *
+                      DASH_ALGORITHM_SUMMA_25D_MEM_FRACTION;
+
+  unsigned long long num_layers = 1;
+  for (extent_t c = 2; c * c * c <= num_units && c <= num_blocks_k; ++c) {
+    if (num_units % c != 0) {
+      continue;
+    }
+    double mem_required = sizeof(ValueType) *
+                          static_cast<double>(
+                            dash::internal::summa_25d_buffer_size(
+                              num_units, c,
+                              num_blocks_m, num_blocks_n,
+                              block_size_m, block_size_n, block_size_k));
+    if (mem_node > 0 && mem_required > mem_avail) {
+      break;
+    }
+    num_layers = c;
+  }
+  DASH_LOG_DEBUG("dash::summa_25d_num_layers", "local:", num_layers,
+                 "memory per unit:", mem_avail);
+  // Available memory may differ between nodes:
+  unsigned long long min_layers;
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&num_layers, &min_layers, 1,
+                   DART_TYPE_ULONGLONG, DART_OP_MIN, team.dart_id()),
+    DART_OK);
+  DASH_LOG_DEBUG("dash::summa_25d_num_layers >", min_layers);
+  return static_cast<extent_t>(min_layers);
+}
+
+} // namespace internal
+
+/**
+ * Number of layers of the replicated matrix blocks in
+ * \c dash::summa_25d, chosen from the memory available to the units.
+ *
+ * The number of layers \c c divides the team size \c P and satisfies
+ * \c c^3 <= P. Every unit holds partial results of \c c times as many
+ * result blocks as in \c dash::summa. The largest number of layers is
+ * chosen for which the blocks allocated per unit do not exceed
+ * \c DASH_ALGORITHM_SUMMA_25D_MEM_FRACTION of the memory available to
+ * a unit.
+ *
+ * Collective operation on the team of matrix \c C.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename MatrixTypeA,
+  typename MatrixTypeB,
+  typename MatrixTypeC
+>
+typename MatrixTypeC::size_type summa_25d_num_layers(
+  const MatrixTypeA & A,
+  const MatrixTypeB & B,
+  const MatrixTypeC & C)
+{
+  return dash::internal::summa_25d_num_layers<
+           typename MatrixTypeC::value_type>(
+             A.pattern(), B.pattern(), C.team());
+}
+
+/**
+ * Multiplies two matrices using the communication-avoiding 2.5D variant
+ * of the SUMMA algorithm.
+ *
+ * The units of the team are arranged in \c num_layers layers of a
+ * 2-dimensional grid (see \c dash::TeamSpec<3>). Every layer computes
+ * partial results of the complete matrix C from a subrange of the block
+ * columns of A and block rows of B. Blocks of A and B are therefore
+ * replicated across layers, and the communication volume of block
+ * transfers is reduced by a factor of \c sqrt(num_layers) compared to
+ * \c dash::summa. Partial results are reduced across layers by atomic
+ * accumulation on the blocks of C.
+ *
+ * Matrices must satisfy the pattern constraints of \c dash::summa.
+ * C is updated as C += A x B, in the element order of the patterns'
+ * storage order.
+ *
+ * Collective operation on the team of matrix \c C.
+ *
+ * \see  dash::summa_25d_num_layers
+ * \see  dash::summa
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename MatrixTypeA,
+  typename MatrixTypeB,
+  typename MatrixTypeC
+>
+void summa_25d(
+  /// Matrix to multiply, extents n x m
+  MatrixTypeA                   & A,
+  /// Matrix to multiply, extents m x p
+  MatrixTypeB                   & B,
+  /// Matrix to contain the multiplication result, extents n x p,
+  /// initialized with zeros
+  MatrixTypeC                   & C,
+  /// Number of layers, must divide the team size
+  typename MatrixTypeC::size_type num_layers)
+{
+  typedef typename MatrixTypeA::value_type value_type;
+  typedef typename MatrixTypeA::index_type index_t;
+  typedef typename MatrixTypeA::size_type  extent_t;
+  typedef std::array<index_t, 2>           coords_t;
+
+  static_assert(
+      std::is_floating_point<value_type>::value,
+      "dash::summa_25d expects matrix element type double or float");
+
+  DASH_LOG_DEBUG("dash::summa_25d()", "layers:", num_layers);
+  if (!dash::check_pattern_constraints<
+         summa_pattern_partitioning_constraints,
+         summa_pattern_mapping_constraints,
+         summa_pattern_layout_constraints
+       >(A.pattern()) ||
+      !dash::check_pattern_constraints<
+         summa_pattern_partitioning_constraints,
+         summa_pattern_mapping_constraints,
+         summa_pattern_layout_constraints
+       >(B.pattern()) ||
+      !dash::check_pattern_constraints<
+         summa_pattern_partitioning_constraints,
+         summa_pattern_mapping_constraints,
+         summa_pattern_layout_constraints
+       >(C.pattern())) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_25d(): "
+      "matrix patterns do not match constraints");
+  }
+
+  dash::Team & team      = C.team();
+  auto         unit_id   = team.myid();
+  extent_t     num_units = team.size();
+  if (num_layers < 1 || num_units % num_layers != 0) {
+    DASH_THROW(
+      dash::exception::InvalidArgument,
+      "dash::summa_25d(): "
+      "number of layers " << num_layers << " does not divide " <<
+      "team size " << num_units);
+  }
+  const dash::MemArrange memory_order = A.pattern().memory_order();
+
+  auto block_a          = A.pattern().block(0);
+  auto block_b          = B.pattern().block(0);
+  extent_t block_size_m = block_a.extent(0);
+  extent_t block_size_k = block_a.extent(1);
+  extent_t block_size_n = block_b.extent(1);
+  extent_t num_blocks_m = A.pattern().extent(0) / block_size_m;
+  extent_t num_blocks_k = A.pattern().extent(1) / block_size_k;
+  extent_t num_blocks_n = B.pattern().extent(1) / block_size_n;
+
+  DASH_ASSERT_EQ(block_b.extent(0), block_size_k,
+                 "dash::summa_25d(): block extents of A and B differ");
+  DASH_ASSERT_EQ(C.pattern().block(0).extent(0), block_size_m,
+                 "dash::summa_25d(): block extents of A and C differ");
+  DASH_ASSERT_EQ(C.pattern().block(0).extent(1), block_size_n,
+                 "dash::summa_25d(): block extents of B and C differ");
+
+  dash::internal::Summa25DLayout layout(num_units, num_layers);
+  auto range_m = layout.block_range(unit_id, 0, num_blocks_m);
+  auto range_n = layout.block_range(unit_id, 1, num_blocks_n);
+  auto range_k = layout.block_range(unit_id, 2, num_blocks_k);
+  extent_t nrows = range_m[1] - range_m[0];
+  extent_t ncols = range_n[1] - range_n[0];
+
+  DASH_LOG_TRACE("dash::summa_25d", "teamspec:", layout.teamspec().extents(),
+                 "blocks m:", range_m, "n:", range_n, "k:", range_k);
+
+  extent_t block_a_size = block_size_m * block_size_k;
+  extent_t block_b_size = block_size_k * block_size_n;
+  extent_t block_c_size = block_size_m * block_size_n;
+
+  // Partial results of the result blocks computed by this unit:
+  std::vector<value_type> c_part(nrows * ncols * block_c_size, 0);
+  // Double-buffered panels of blocks of A and B:
+  std::vector<value_type> a_buf[2];
+  std::vector<value_type> b_buf[2];
+  std::vector<const value_type *> a_ptr[2];
+  std::vector<const value_type *> b_ptr[2];
+  for (int s = 0; s < 2; ++s) {
+    a_buf[s].resize(nrows * block_a_size);
+    b_buf[s].resize(ncols * block_b_size);
+    a_ptr[s].resize(nrows);
+    b_ptr[s].resize(ncols);
+  }
+  std::vector<dart_handle_t> handles;
+
+  dart_gptr_t a_gbegin = static_cast<dart_gptr_t>(
+                          A.begin().globmem().begin());
+  dart_gptr_t b_gbegin = static_cast<dart_gptr_t>(
+                          B.begin().globmem().begin());
+  dart_gptr_t c_gbegin = static_cast<dart_gptr_t>(
+                          C.begin().globmem().begin());
+
+  // Starts the transfer of the block of matrix M at the given block
+  // coordinates to dest, returns a pointer to the block in local memory
+  // if it is local:
+  auto get_block = [&](
+                     const value_type * l_begin,
+                     dart_gptr_t        gbegin,
+                     const auto       & pattern,
+                     const coords_t   & block_coords,
+                     extent_t           block_size,
+                     value_type       * dest) -> const value_type * {
+    auto loc = dash::internal::summa_25d_block_location(
+                 pattern, block_coords);
+    if (loc.first == unit_id) {
+      return l_begin + loc.second;
+    }
+    dart_gptr_t gptr = gbegin;
+    gptr.unitid      = loc.first;
+    gptr.addr_or_offs.offset += loc.second * sizeof(value_type);
+    dash::dart_storage<value_type> ds(block_size);
+    dart_handle_t handle;
+    DASH_ASSERT_RETURNS(
+      dart_get_handle(dest, gptr, ds.nelem, ds.dtype, ds.dtype, &handle),
+      DART_OK);
+    if (handle != DART_HANDLE_NULL) {
+      handles.push_back(handle);
+    }
+    return dest;
+  };
+  // Starts transfers of panels of A and B for block index k to the
+  // buffers in slot s:
+  auto prefetch = [&](extent_t k, int s) {
+    for (extent_t i = 0; i < nrows; ++i) {
+      coords_t coords {{ static_cast<index_t>(range_m[0] + i),
+                         static_cast<index_t>(k) }};
+      a_ptr[s][i] = get_block(A.lbegin(), a_gbegin, A.pattern(), coords,
+                              block_a_size,
+                              a_buf[s].data() + i * block_a_size);
+    }
+    for (extent_t j = 0; j < ncols; ++j) {
+      coords_t coords {{ static_cast<index_t>(k),
+                         static_cast<index_t>(range_n[0] + j) }};
+      b_ptr[s][j] = get_block(B.lbegin(), b_gbegin, B.pattern(), coords,
+                              block_b_size,
+                              b_buf[s].data() + j * block_b_size);
+    }
+  };
+  auto wait = [&]() {
+    if (!handles.empty()) {
+      DASH_ASSERT_RETURNS(
+        dart_waitall(handles.data(), handles.size()),
+        DART_OK);
+      handles.clear();
+    }
+  };
+
+  dash::util::Trace trace("SUMMA25D");
+
+  if (nrows > 0 && ncols > 0 && range_k[0] < range_k[1]) {
+    trace.enter_state("prefetch");
+    prefetch(range_k[0], 0);
+    wait();
+    trace.exit_state("prefetch");
+    int slot = 0;
+    for (extent_t k = range_k[0]; k < range_k[1]; ++k) {
+      // Prefetch blocks for next iteration while multiplying:
+      if (k + 1 < range_k[1]) {
+        prefetch(k + 1, 1 - slot);
+      }
+      trace.enter_state("multiply");
+      for (extent_t i = 0; i < nrows; ++i) {
+        for (extent_t j = 0; j < ncols; ++j) {
+          dash::internal::mmult_local<value_type>(
+            a_ptr[slot][i],
+            b_ptr[slot][j],
+            c_part.data() + (i * ncols + j) * block_c_size,
+            block_size_m,
+            block_size_n,
+            block_size_k,
+            memory_order);
+        }
+      }
+      trace.exit_state("multiply");
+      trace.enter_state("prefetch");
+      wait();
+      trace.exit_state("prefetch");
+      slot = 1 - slot;
+    }
+  }
+
+  // ------------------------------------------------------------------------
+  // Reduce partial results across layers:
+  // ------------------------------------------------------------------------
+  trace.enter_state("reduce");
+  // Blocks of A and B must not be modified by other units before all
+  // transfers of this unit completed:
+  team.barrier();
+  if (range_k[0] < range_k[1]) {
+    dash::dart_storage<value_type> ds_c(block_c_size);
+    for (extent_t i = 0; i < nrows; ++i) {
+      for (extent_t j = 0; j < ncols; ++j) {
+        coords_t coords {{ static_cast<index_t>(range_m[0] + i),
+                           static_cast<index_t>(range_n[0] + j) }};
+        auto loc = dash::internal::summa_25d_block_location(
+                     C.pattern(), coords);
+        dart_gptr_t gptr = c_gbegin;
+        gptr.unitid      = loc.first;
+        gptr.addr_or_offs.offset += loc.second * sizeof(value_type);
+        DASH_ASSERT_RETURNS(
+          dart_accumulate(gptr,
+                          c_part.data() + (i * ncols + j) * block_c_size,
+                          ds_c.nelem, ds_c.dtype, DART_OP_SUM),
+          DART_OK);
+      }
+    }
+    DASH_ASSERT_RETURNS(dart_flush_all(c_gbegin), DART_OK);
+  }
+  team.barrier();
+  trace.exit_state("reduce");
+
+  DASH_LOG_DEBUG("dash::summa_25d >", "finished");
+}
+
+/**
+ * Multiplies two matrices using the communication-avoiding 2.5D variant
+ * of the SUMMA algorithm, with the number of layers chosen from the
+ * memory available to the units.
+ *
+ * Collective operation on the team of matrix \c C.
+ *
+ * \see  dash::summa_25d_num_layers
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  typename MatrixTypeA,
+  typename MatrixTypeB,
+  typename MatrixTypeC
+>
+void summa_25d(
+  /// Matrix to multiply, extents n x m
+  MatrixTypeA & A,
+  /// Matrix to multiply, extents m x p
+  MatrixTypeB & B,
+  /// Matrix to contain the multiplication result, extents n x p,
+  /// initialized with zeros
+  MatrixTypeC & C)
+{
+  dash::summa_25d(A, B, C, dash::summa_25d_num_layers(A, B, C));
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__SUMMA25D_H_
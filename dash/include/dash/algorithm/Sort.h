@@ -16,10 +16,22 @@
 #include <dash/algorithm/LocalRange.h>
 
 #include <dash/internal/Logging.h>
+#include <dash/util/Config.h>
 #include <dash/util/Trace.h>
+#include <dash/util/UnitLocality.h>
 
 namespace dash {
 
+/**
+ * Statistics of the last invocation of \c dash::sort at the calling unit.
+ */
+struct sort_stats_t {
+  /// Peak size in bytes of temporary buffers allocated by the calling unit
+  std::size_t peak_extra_bytes = 0;
+  /// Number of rounds of the exchange of partitions
+  std::size_t exchange_rounds = 0;
+};
+
 #ifdef DOXYGEN
 
 /**
@@ -32,6 +44,15 @@ namespace dash {
  * In terms of data distribution, source and destination ranges passed to
  * \c dash::sort must be global (\c GlobIter<ValueType>).
  *
+ * By default, partitions are exchanged from a copy of the local range and
+ * merged using a temporary buffer, so peak memory usage is about twice the
+ * size of the local range. If the configuration key \c DASH_SORT_INPLACE
+ * is set, partitions are exchanged in place in rounds through a staging
+ * buffer of \c DASH_SORT_STAGING_SIZE bytes (default: 1/8 of the largest
+ * local range) and received elements are sorted in place. This mode
+ * trades a final local sort for a temporary buffer bounded by the staging
+ * size. The configuration must be identical at all units.
+ *
  * The operation is collective among the team of the owning dash container.
  *
  * Example:
@@ -80,6 +101,83 @@ void sort(GlobRandomIt begin, GlobRandomIt end);
 template <class GlobRandomIt, class SortableHash>
 void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
 
+/**
+ * Sorts the elements in the range, defined by \c [begin, end) in ascending
+ * order. The order of equal elements is preserved, i.e. ties are broken by
+ * the unit and the local index of elements before sorting.
+ *
+ * Partitions are always exchanged from a copy of the local range, the
+ * configuration key \c DASH_SORT_INPLACE is ignored.
+ *
+ * \see  dash::sort(GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+void stable_sort(GlobRandomIt begin, GlobRandomIt end);
+
+/**
+ * Sorts the elements in the range, defined by \c [begin, end) in ascending
+ * order of their values of a user-defined hash function. The order of
+ * elements with equal hash values is preserved.
+ *
+ * \see  dash::sort(GlobRandomIt, GlobRandomIt, SortableHash)
+ * \see  dash::stable_sort(GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class SortableHash>
+void stable_sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
+
+/**
+ * Sorts the keys in the range \c [keys_begin, keys_end) in ascending order
+ * and applies the same permutation to the range of values starting at
+ * \c values_begin. The range of values must have the same distribution as
+ * the range of keys. Values are exchanged between units in the same
+ * all-to-all exchange as their keys. The order of equal keys is preserved.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<int64_t>  cell_ids(n);
+ *       dash::Array<particle> particles(n);
+ *       // ...
+ *       dash::sort_by_key(cell_ids.begin(), cell_ids.end(),
+ *                         particles.begin());
+ * \endcode
+ *
+ * \see  dash::stable_sort(GlobRandomIt, GlobRandomIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobKeyIt, class GlobValueIt>
+void sort_by_key(
+    GlobKeyIt keys_begin, GlobKeyIt keys_end, GlobValueIt values_begin);
+
+/**
+ * Sorts the keys in the range \c [keys_begin, keys_end) in ascending order
+ * of their values of a user-defined hash function and applies the same
+ * permutation to the range of values starting at \c values_begin.
+ *
+ * \see  dash::sort_by_key(GlobKeyIt, GlobKeyIt, GlobValueIt)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobKeyIt, class GlobValueIt, class SortableHash>
+void sort_by_key(
+    GlobKeyIt    keys_begin,
+    GlobKeyIt    keys_end,
+    GlobValueIt  values_begin,
+    SortableHash hash);
+
+/**
+ * Statistics of the last invocation of \c dash::sort at the calling unit,
+ * like the peak size of temporary memory.
+ *
+ * \ingroup  DashAlgorithms
+ */
+sort_stats_t const& sort_stats();
+
 #else
 
 #define __DASH_SORT__FINAL_STEP_BY_MERGE (0)
@@ -88,11 +186,37 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
 
 #include <dash/algorithm/internal/Sort-inl.h>
 
-template <class GlobRandomIt, class SortableHash>
-void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
+namespace detail {
+inline sort_stats_t& psort__stats()
+{
+  static sort_stats_t stats;
+  return stats;
+}
+}  // namespace detail
+
+inline sort_stats_t const& sort_stats()
+{
+  return detail::psort__stats();
+}
+
+namespace detail {
+
+/**
+ * Implementation of \c dash::sort, \c dash::stable_sort and
+ * \c dash::sort_by_key. If \c values_begin is not \c nullptr, the range of
+ * values starting at \c *values_begin is permuted like the sorted range.
+ */
+template <class GlobRandomIt, class GlobValueIt, class SortableHash>
+void psort__sort(
+    GlobRandomIt       begin,
+    GlobRandomIt       end,
+    GlobValueIt const* values_begin,
+    SortableHash       sortable_hash,
+    bool               stable)
 {
   using iter_type    = GlobRandomIt;
   using value_type   = typename iter_type::value_type;
+  using vvalue_type  = typename GlobValueIt::value_type;
   using mapped_type =
       typename std::decay<typename dash::functional::closure_traits<
           SortableHash>::result_type>::type;
@@ -105,6 +229,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   dash::util::Trace trace("Sort");
 
+  auto& stats = detail::psort__stats();
+  stats       = sort_stats_t{};
+
   auto const sort_comp = [&sortable_hash](
                              const value_type& a, const value_type& b) {
     return sortable_hash(a) < sortable_hash(b);
@@ -114,10 +241,40 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     DASH_LOG_TRACE("dash::sort", "Sorting on dash::Team::Null()");
     return;
   }
+  // The in-place exchange of partitions does not preserve the order of
+  // equal elements
+  auto const inplace = dash::util::Config::get<bool>("DASH_SORT_INPLACE") &&
+                       !stable && values_begin == nullptr;
+  DASH_LOG_TRACE_VAR("dash::sort", inplace);
+
   if (pattern.team().size() == 1) {
     DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
     trace.enter_state("final_local_sort");
-    std::sort(begin.local(), end.local(), sort_comp);
+    auto* l_first = begin.local();
+    auto* l_last  = end.local();
+    auto const l_nthreads =
+        detail::psort__num_threads(std::distance(l_first, l_last));
+    auto const l_nelem = static_cast<std::size_t>(
+        std::distance(l_first, l_last));
+    if (values_begin != nullptr) {
+      GlobValueIt values_first = *values_begin;
+      detail::psort__local_sort_by_key(
+          l_first, l_last, values_first.local(), sort_comp, l_nthreads);
+      stats.peak_extra_bytes =
+          detail::psort__by_key_extra_bytes<value_type, vvalue_type>(
+              l_nelem);
+    }
+    else if (inplace) {
+      detail::psort__local_sort_inplace(
+          l_first, l_last, sort_comp, l_nthreads);
+    }
+    else {
+      detail::psort__local_sort(
+          l_first, l_last, sort_comp, l_nthreads, stable);
+      stats.peak_extra_bytes =
+          detail::psort__local_sort_extra_bytes<value_type>(
+              l_nelem, l_nthreads, stable);
+    }
     trace.exit_state("final_local_sort");
     return;
   }
@@ -147,9 +304,44 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   auto * lbegin = l_mem_begin + l_range.begin;
   auto * lend   = l_mem_begin + l_range.end;
 
+  // local range of values, distributed like the sorted range
+  vvalue_type* vbegin = nullptr;
+  if (values_begin != nullptr) {
+    GlobValueIt values_first = *values_begin;
+    auto const  v_range      = dash::local_index_range(
+        values_first, values_first + std::distance(begin, end));
+    DASH_ASSERT_EQ(
+        v_range.end - v_range.begin,
+        n_l_elem,
+        "keys and values must have the same distribution");
+    vbegin = dash::local_begin(
+                 static_cast<typename GlobValueIt::pointer>(values_first),
+                 team.myid()) +
+             v_range.begin;
+  }
+
+  // threads used in local phases
+  auto const nthreads = detail::psort__num_threads(n_l_elem);
+  DASH_LOG_TRACE_VAR("dash::sort", nthreads);
+
   // initial local_sort
   trace.enter_state("1:initial_local_sort");
-  std::sort(lbegin, lend, sort_comp);
+  if (vbegin != nullptr) {
+    detail::psort__local_sort_by_key(
+        lbegin, lend, vbegin, sort_comp, nthreads);
+    stats.peak_extra_bytes =
+        detail::psort__by_key_extra_bytes<value_type, vvalue_type>(
+            n_l_elem);
+  }
+  else if (inplace) {
+    detail::psort__local_sort_inplace(lbegin, lend, sort_comp, nthreads);
+  }
+  else {
+    detail::psort__local_sort(lbegin, lend, sort_comp, nthreads, stable);
+    stats.peak_extra_bytes =
+        detail::psort__local_sort_extra_bytes<value_type>(
+            n_l_elem, nthreads, stable);
+  }
   trace.exit_state("1:initial_local_sort");
 
   trace.enter_state("2:init_temporary_global_data");
@@ -167,11 +359,9 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("3:find_global_min_max");
 
-  // Temporary local buffer (sorted);
-  std::vector<value_type> const lcopy(lbegin, lend);
-
-  auto const min_max = detail::find_global_min_max(
-      std::begin(lcopy), std::end(lcopy), team.dart_id(), sortable_hash);
+  // The local range remains unmodified until partitions are exchanged
+  auto const min_max =
+      detail::find_global_min_max(lbegin, lend, team.dart_id(), sortable_hash);
 
   trace.exit_state("3:find_global_min_max");
 
@@ -199,8 +389,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   detail::psort__init_partition_borders(p_unit_info, p_borders);
 
-  DASH_LOG_TRACE_RANGE(
-      "locally sorted array", std::begin(lcopy), std::end(lcopy));
+  DASH_LOG_TRACE_RANGE("locally sorted array", lbegin, lend);
   DASH_LOG_TRACE_RANGE(
       "skipped splitters",
       p_borders.is_skipped.cbegin(),
@@ -260,9 +449,10 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
         splitters,
         valid_partitions,
         p_borders,
-        std::begin(lcopy),
-        std::end(lcopy),
-        sortable_hash);
+        lbegin,
+        lend,
+        sortable_hash,
+        nthreads);
 
     detail::trace_local_histo("local histogram", l_nlt_nle);
 
@@ -298,9 +488,10 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       splitters,
       valid_partitions,
       p_borders,
-      std::begin(lcopy),
-      std::end(lcopy),
-      sortable_hash);
+      lbegin,
+      lend,
+      sortable_hash,
+      nthreads);
   trace.exit_state("6:final_local_histogram");
 
   DASH_LOG_TRACE_RANGE("final splitters", splitters.begin(), splitters.end());
@@ -494,6 +685,21 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.exit_state("15:calc_final_target_displs");
 
+  // Temporary local buffer (sorted), must be created before other units
+  // write to the local range in the exchange of partitions
+  std::vector<value_type>  lcopy;
+  std::vector<vvalue_type> vcopy;
+  if (!inplace) {
+    lcopy.assign(lbegin, lend);
+  }
+  if (vbegin != nullptr) {
+    vcopy.assign(vbegin, vbegin + n_l_elem);
+  }
+  stats.peak_extra_bytes = std::max(
+      stats.peak_extra_bytes,
+      (lcopy.size() * sizeof(value_type) +
+       vcopy.size() * sizeof(vvalue_type)));
+
   trace.enter_state("16:barrier");
   team.barrier();
   trace.exit_state("16:barrier");
@@ -503,11 +709,80 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       &(g_partition_data.local[IDX_TARGET_DISP(nunits)]),
       &(g_partition_data.local[IDX_TARGET_DISP(nunits) + nunits]));
 
+  if (inplace) {
+    trace.enter_state("17:exchange_data_inplace (all-to-all)");
+
+    std::vector<std::size_t> send_counts(nunits * nunits);
+
+    DASH_ASSERT_RETURNS(
+        dart_allgather(
+            std::next(g_partition_data.lbegin(), IDX_SEND_COUNT(nunits)),
+            send_counts.data(),
+            nunits,
+            dash::dart_datatype<size_t>::value,
+            team.dart_id()),
+        DART_OK);
+
+    std::size_t staging_nelem =
+        dash::util::Config::get<std::size_t>("DASH_SORT_STAGING_SIZE_BYTES") /
+        sizeof(value_type);
+    if (staging_nelem == 0) {
+      // fraction of the largest local range
+      for (std::size_t u = 0; u < nunits; ++u) {
+        staging_nelem = std::max(
+            staging_nelem,
+            std::accumulate(
+                std::next(send_counts.begin(), u * nunits),
+                std::next(send_counts.begin(), (u + 1) * nunits),
+                std::size_t{0}));
+      }
+      staging_nelem /= PSORT_STAGING_FRACTION;
+    }
+    staging_nelem = std::max<std::size_t>(staging_nelem, 1);
+    DASH_LOG_TRACE_VAR("dash::sort", staging_nelem);
+
+    auto const unit_begin = [&begin, &pattern, unit_at_begin](
+                                dash::team_unit_t unit) -> iter_type {
+      return (unit == unit_at_begin)
+                 ? begin
+                 : iter_type{&(begin.globmem()),
+                             pattern,
+                             pattern.global_index(unit, {})};
+    };
+
+    stats.exchange_rounds = detail::psort__exchange_inplace(
+        unit_begin, lbegin, send_counts, staging_nelem, team);
+    stats.peak_extra_bytes = std::max(
+        stats.peak_extra_bytes,
+        std::min<std::size_t>(staging_nelem, n_l_elem) * sizeof(value_type) +
+            3 * send_counts.size() * sizeof(std::size_t));
+
+    trace.exit_state("17:exchange_data_inplace (all-to-all)");
+
+    trace.enter_state("19:final_local_sort");
+    detail::psort__local_sort_inplace(lbegin, lend, sort_comp, nthreads);
+    trace.exit_state("19:final_local_sort");
+
+    DASH_LOG_DEBUG(
+        "dash::sort >",
+        "peak extra memory [bytes]:",
+        stats.peak_extra_bytes,
+        "exchange rounds:",
+        stats.exchange_rounds);
+
+    trace.enter_state("20:final_barrier");
+    team.barrier();
+    trace.exit_state("20:final_barrier");
+    return;
+  }
+
   trace.enter_state("17:exchange_data (all-to-all)");
 
   std::vector<dash::Future<iter_type> > async_copies{};
   async_copies.reserve(p_unit_info.valid_remote_partitions.size());
 
+  std::vector<dash::Future<GlobValueIt> > async_value_copies{};
+
   auto const l_partition_data = g_partition_data.local;
 
   auto const get_send_info = [l_partition_data, &l_send_displs, nunits](
@@ -547,6 +822,14 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
         it_copy + target_disp);
 
     async_copies.emplace_back(std::move(fut));
+
+    if (vbegin != nullptr) {
+      // values are written to the same offsets in the range of values
+      async_value_copies.emplace_back(dash::copy_async(
+          vcopy.data() + send_disp,
+          vcopy.data() + send_disp + send_count,
+          *values_begin + ((it_copy - begin) + target_disp)));
+    }
   }
 
   std::tie(send_count, send_disp, target_disp) = get_send_info(myid);
@@ -556,12 +839,26 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
         std::next(std::begin(lcopy), send_disp),
         std::next(std::begin(lcopy), send_disp + send_count),
         std::next(lbegin, target_disp));
+    if (vbegin != nullptr) {
+      std::copy(
+          vcopy.data() + send_disp,
+          vcopy.data() + send_disp + send_count,
+          vbegin + target_disp);
+    }
   }
 
   std::for_each(
       std::begin(async_copies),
       std::end(async_copies),
       [](dash::Future<iter_type>& fut) { fut.wait(); });
+  for (auto& fut : async_value_copies) {
+    fut.wait();
+  }
+
+  // release the local copy before merge buffers are allocated, these have
+  // the same size
+  std::vector<value_type>{}.swap(lcopy);
+  std::vector<vvalue_type>{}.swap(vcopy);
 
   trace.exit_state("17:exchange_data (all-to-all)");
 
@@ -587,7 +884,21 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   trace.exit_state("18:barrier");
 
   trace.enter_state("19:final_local_sort");
-  std::sort(lbegin, lend);
+  if (vbegin != nullptr) {
+    detail::psort__local_sort_by_key(
+        lbegin, lend, vbegin, sort_comp, nthreads);
+    stats.peak_extra_bytes = std::max(
+        stats.peak_extra_bytes,
+        detail::psort__by_key_extra_bytes<value_type, vvalue_type>(
+            n_l_elem));
+  }
+  else {
+    detail::psort__local_sort(lbegin, lend, sort_comp, nthreads, stable);
+    stats.peak_extra_bytes = std::max(
+        stats.peak_extra_bytes,
+        detail::psort__local_sort_extra_bytes<value_type>(
+            n_l_elem, nthreads, stable));
+  }
   trace.exit_state("19:final_local_sort");
 #else
   trace.enter_state("18:calc_recv_count (all-to-all)");
@@ -614,15 +925,10 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("19:merge_local_sequences");
 
-  // merging sorted sequences
-  auto nsequences = nunits;
-  // number of merge steps in the tree
-  auto const depth = static_cast<size_t>(std::ceil(std::log2(nsequences)));
-
   // calculate the prefix sum among all receive counts to find the offsets for
   // merging
   std::vector<size_t> recv_count_psum;
-  recv_count_psum.reserve(nsequences + 1);
+  recv_count_psum.reserve(nunits + 1);
   recv_count_psum.emplace_back(0);
 
   std::partial_sum(
@@ -635,30 +941,23 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       std::begin(recv_count_psum),
       std::end(recv_count_psum));
 
-  for (std::size_t d = 0; d < depth; ++d) {
-    // distance between first and mid iterator while merging
-    auto const step = std::size_t(0x1) << d;
-    // distance between first and last iterator while merging
-    auto const dist = step << 1;
-    // number of merges
-    auto const nmerges = nsequences >> 1;
-
-    // These merges are independent from each other and are candidates for
-    // shared memory parallelism
-    for (std::size_t m = 0; m < nmerges; ++m) {
-      auto first = std::next(lbegin, recv_count_psum[m * dist]);
-      auto mid   = std::next(lbegin, recv_count_psum[m * dist + step]);
-      // sometimes we have a lonely merge in the end, so we have to guarantee
-      // that we do not access out of bounds
-      auto last = std::next(
-          lbegin,
-          recv_count_psum[std::min(
-              m * dist + dist, recv_count_psum.size() - 1)]);
-
-      std::inplace_merge(first, mid, last);
-    }
-
-    nsequences -= nmerges;
+  // merging sorted sequences, stable in the order of source units
+  if (vbegin != nullptr) {
+    detail::psort__merge_sequences_by_key(
+        lbegin, vbegin, recv_count_psum, sort_comp, nthreads);
+    stats.peak_extra_bytes = std::max(
+        stats.peak_extra_bytes,
+        detail::psort__by_key_extra_bytes<value_type, vvalue_type>(
+            n_l_elem));
+  }
+  else {
+    detail::psort__merge_sequences(
+        lbegin, recv_count_psum, sort_comp, nthreads);
+    // the merge buffer, also allocated by std::inplace_merge with a single
+    // thread
+    stats.peak_extra_bytes = std::max(
+        stats.peak_extra_bytes,
+        detail::psort__merge_extra_bytes<value_type>(n_l_elem));
   }
 
   trace.exit_state("19:merge_local_sequences");
@@ -666,12 +965,14 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   DASH_LOG_TRACE_RANGE("finally sorted range", lbegin, lend);
 
+  DASH_LOG_DEBUG(
+      "dash::sort >", "peak extra memory [bytes]:", stats.peak_extra_bytes);
+
   trace.enter_state("20:final_barrier");
   team.barrier();
   trace.exit_state("20:final_barrier");
 }
 
-namespace detail {
 template <typename T>
 struct identity_t : std::unary_function<T, T> {
   constexpr T&& operator()(T&& t) const noexcept
@@ -682,6 +983,18 @@ struct identity_t : std::unary_function<T, T> {
 };
 }  // namespace detail
 
+template <class GlobRandomIt, class SortableHash>
+inline void sort(
+    GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
+{
+  detail::psort__sort(
+      begin,
+      end,
+      static_cast<GlobRandomIt const*>(nullptr),
+      sortable_hash,
+      false);
+}
+
 template <class GlobRandomIt>
 inline void sort(GlobRandomIt begin, GlobRandomIt end)
 {
@@ -691,6 +1004,52 @@ inline void sort(GlobRandomIt begin, GlobRandomIt end)
   dash::sort(begin, end, detail::identity_t<value_t const&>());
 }
 
+template <class GlobRandomIt, class SortableHash>
+inline void stable_sort(
+    GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
+{
+  detail::psort__sort(
+      begin,
+      end,
+      static_cast<GlobRandomIt const*>(nullptr),
+      sortable_hash,
+      true);
+}
+
+template <class GlobRandomIt>
+inline void stable_sort(GlobRandomIt begin, GlobRandomIt end)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  dash::stable_sort(begin, end, detail::identity_t<value_t const&>());
+}
+
+template <class GlobKeyIt, class GlobValueIt, class SortableHash>
+inline void sort_by_key(
+    GlobKeyIt    keys_begin,
+    GlobKeyIt    keys_end,
+    GlobValueIt  values_begin,
+    SortableHash sortable_hash)
+{
+  detail::psort__sort(
+      keys_begin, keys_end, &values_begin, sortable_hash, true);
+}
+
+template <class GlobKeyIt, class GlobValueIt>
+inline void sort_by_key(
+    GlobKeyIt keys_begin, GlobKeyIt keys_end, GlobValueIt values_begin)
+{
+  using key_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobKeyIt>::value_type>::type;
+
+  dash::sort_by_key(
+      keys_begin,
+      keys_end,
+      values_begin,
+      detail::identity_t<key_t const&>());
+}
+
 #endif  // DOXYGEN
 
 }  // namespace dash
@@ -1,6 +1,7 @@
 #ifndef DASH__ALGORITHM__TRANSFORM_H__
 #define DASH__ALGORITHM__TRANSFORM_H__
 
+#include <dash/Execution.h>
 #include <dash/GlobAsyncRef.h>
 #include <dash/GlobRef.h>
 
@@ -13,6 +14,7 @@
 #include <dash/util/Trace.h>
 
 #include <dash/dart/if/dart_communication.h>
+#include <dash/dart/if/dart_globmem.h>
 
 #ifdef DASH_ENABLE_OPENMP
 #include <omp.h>
@@ -115,6 +117,47 @@ GlobOutputIt transform(
   /// Reduce operation
   BinaryOperation binary_op);
 
+/**
+ * Apply a given function to pairs of elements from two global ranges and
+ * store the result in a global output range, with the local elements of
+ * every unit processed as specified by the execution policy.
+ *
+ * If the input- and output ranges are distributed identically, every unit
+ * transforms its local elements in place in local memory. In contrast to
+ * \c dash::transform without execution policy, the update of an element is
+ * then not atomic with respect to concurrent one-sided accesses by other
+ * units. Otherwise, the operation is delegated to \c dash::transform if
+ * the output range is the second input range and the operation provides a
+ * DART operation (see \c DashReduceOperations). In all other cases, every
+ * unit computes the output elements in its local memory from input
+ * elements read by blocking gets, which supports arbitrary functions such
+ * as lambdas.
+ *
+ * \returns  Output iterator to the element past the last element transformed.
+ * \see      dash::execution
+ *
+ * \ingroup  DashAlgorithms
+ */
+template<
+  class ExecutionPolicy,
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class GlobOutputIt,
+  class BinaryOperation >
+GlobOutputIt transform(
+  /// Execution policy for the local elements
+  ExecutionPolicy&& policy,
+  /// Iterator on begin of first global range
+  GlobInputIt1      in_a_first,
+  /// Iterator after last element of first global range
+  GlobInputIt1      in_a_last,
+  /// Iterator on begin of second global range
+  GlobInputIt2      in_b_first,
+  /// Iterator on first element of global output range
+  GlobOutputIt      out_first,
+  /// Reduce operation
+  BinaryOperation   binary_op);
+
 #else
 
 namespace internal {
@@ -477,6 +520,156 @@ GlobOutputIt transform(
           internal::transform_impl_local_input_it>::type());
 }
 
+namespace internal {
+
+/**
+ * Transform of global ranges with arbitrary distribution: every unit
+ * computes the elements of the output range in its local memory, reading
+ * input elements at other units by blocking gets.
+ * Applicable to any binary operation, including functions that do not
+ * map to a DART operation.
+ */
+template <
+    class GlobInputIt1,
+    class GlobInputIt2,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_owner_computes(
+    GlobInputIt1    in_a_first,
+    GlobInputIt1    in_a_last,
+    GlobInputIt2    in_b_first,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op)
+{
+  typedef typename dash::iterator_traits<GlobInputIt1>::value_type
+    value_a_t;
+  typedef typename dash::iterator_traits<GlobInputIt2>::value_type
+    value_b_t;
+
+  DASH_LOG_DEBUG("dash::transform_owner_computes(gaf, gal, gbf, goutf)");
+  auto num_gvalues   = dash::distance(in_a_first, in_a_last);
+  auto out_last      = out_first + num_gvalues;
+  auto l_idx_range   = dash::local_index_range(out_first, out_last);
+  auto l_range       = dash::local_range(out_first, out_last);
+  auto lbegin_out    = l_range.begin;
+  const auto & pattern_out = out_first.pattern();
+  auto out_gbegin    = out_first.pos();
+  for (auto l_idx = l_idx_range.begin; l_idx != l_idx_range.end;
+       ++l_idx, ++lbegin_out) {
+    auto offset = pattern_out.global(l_idx) - out_gbegin;
+    if (offset < 0 || offset >= num_gvalues) {
+      continue;
+    }
+    value_a_t value_a = in_a_first[offset];
+    value_b_t value_b = in_b_first[offset];
+    *lbegin_out = binary_op(value_a, value_b);
+  }
+  return out_last;
+}
+
+/**
+ * Transform of global ranges with different distribution.
+ * Overload for operations providing a DART operation, the second input
+ * range is updated by accumulate operations if it is the output range.
+ */
+template <
+    class GlobInputIt1,
+    class GlobInputIt2,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_distributed(
+    GlobInputIt1    in_a_first,
+    GlobInputIt1    in_a_last,
+    GlobInputIt2    in_b_first,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op,
+    std::true_type  /*has_dart_operation*/)
+{
+  // Global iterators compare equal at the same position in different
+  // ranges, compare the referenced global memory instead:
+  if (DART_GPTR_EQUAL(in_b_first.dart_gptr(), out_first.dart_gptr())) {
+    dash::transform(in_a_first, in_a_last, in_b_first, out_first, binary_op);
+    return out_first + dash::distance(in_a_first, in_a_last);
+  }
+  return transform_owner_computes(
+           in_a_first, in_a_last, in_b_first, out_first, binary_op);
+}
+
+/**
+ * Transform of global ranges with different distribution.
+ * Overload for arbitrary functions.
+ */
+template <
+    class GlobInputIt1,
+    class GlobInputIt2,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_distributed(
+    GlobInputIt1    in_a_first,
+    GlobInputIt1    in_a_last,
+    GlobInputIt2    in_b_first,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op,
+    std::false_type /*has_dart_operation*/)
+{
+  return transform_owner_computes(
+           in_a_first, in_a_last, in_b_first, out_first, binary_op);
+}
+
+} // namespace internal
+
+template <
+    class ExecutionPolicy,
+    class GlobInputIt1,
+    class GlobInputIt2,
+    class GlobOutputIt,
+    class BinaryOperation,
+    typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+GlobOutputIt transform(
+    ExecutionPolicy&& policy,
+    GlobInputIt1      in_a_first,
+    GlobInputIt1      in_a_last,
+    GlobInputIt2      in_b_first,
+    GlobOutputIt      out_first,
+    BinaryOperation   binary_op)
+{
+  static_assert(
+      dash::iterator_traits<GlobInputIt1>::is_global_iterator::value,
+      "in_a_first must be a global iterator");
+  static_assert(
+      dash::iterator_traits<GlobInputIt2>::is_global_iterator::value,
+      "in_b_first must be a global iterator");
+  static_assert(
+      dash::iterator_traits<GlobOutputIt>::is_global_iterator::value,
+      "out_first must be a global iterator");
+
+  DASH_LOG_DEBUG("dash::transform(policy, gaf, gal, gbf, goutf, binop)");
+  if (in_a_first.pattern() != in_b_first.pattern() ||
+      in_a_first.pattern() != out_first.pattern()  ||
+      in_a_first.pos()     != in_b_first.pos()     ||
+      in_a_first.pos()     != out_first.pos()) {
+    return internal::transform_distributed(
+             in_a_first, in_a_last, in_b_first, out_first, binary_op,
+             internal::has_dart_operation<BinaryOperation>());
+  }
+  auto num_gvalues     = dash::distance(in_a_first, in_a_last);
+  // Identical distribution of all ranges, transform local elements:
+  auto local_range_a   = dash::local_range(in_a_first, in_a_last);
+  auto in_b_last       = in_b_first + num_gvalues;
+  auto out_last        = out_first  + num_gvalues;
+  auto local_range_b   = dash::local_range(in_b_first, in_b_last);
+  auto local_range_out = dash::local_range(out_first,  out_last);
+  auto lbegin_a        = local_range_a.begin;
+  auto lbegin_b        = local_range_b.begin;
+  auto lbegin_out      = local_range_out.begin;
+  dash::internal::execution_for(
+    policy, std::distance(local_range_a.begin, local_range_a.end),
+    [lbegin_a, lbegin_b, lbegin_out, &binary_op](size_t i) {
+      lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
+    });
+  return out_last;
+}
+
 /**
  * Specialization of \c dash::transform as non-blocking operation.
  *
@@ -0,0 +1,493 @@
+#ifndef DASH__ALGORITHM__TRANSFORM_REDUCE_H__
+#define DASH__ALGORITHM__TRANSFORM_REDUCE_H__
+
+#include <dash/Execution.h>
+#include <dash/iterator/GlobIter.h>
+#include <dash/iterator/IteratorTraits.h>
+
+#include <dash/algorithm/LocalRange.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Reduce.h>
+
+#include <dash/internal/Config.h>
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * Number of independent partial results in the local pass of
+ * \c dash::transform_reduce.
+ */
+#define TRANSFORM_REDUCE_NLANES 4
+/**
+ * Minimum number of local elements processed by a thread in
+ * \c dash::transform_reduce.
+ */
+#define TRANSFORM_REDUCE_MIN_NELEM_PER_THREAD (1 << 14)
+
+
+namespace dash {
+
+namespace internal {
+
+  /**
+   * Reduces the values \c op(0) ... \c op(nelem-1) using \c reduce_op.
+   *
+   * Independent partial results break the dependency chain of a single
+   * accumulator so the loop can be vectorized without reassociation by
+   * the compiler, which is valid as \c reduce_op is required to be
+   * associative and commutative.
+   */
+  template<typename ValueType, typename ReduceOperation, typename IndexedOp>
+  local_result<ValueType> transform_reduce_serial(
+    size_t          nelem,
+    ReduceOperation reduce_op,
+    IndexedOp       op)
+  {
+    local_result<ValueType> result;
+    if (nelem == 0) {
+      return result;
+    }
+    size_t i = 0;
+    if (nelem >= TRANSFORM_REDUCE_NLANES) {
+      ValueType lanes[TRANSFORM_REDUCE_NLANES];
+      for (size_t l = 0; l < TRANSFORM_REDUCE_NLANES; ++l) {
+        lanes[l] = op(l);
+      }
+      for (i = TRANSFORM_REDUCE_NLANES;
+           i + TRANSFORM_REDUCE_NLANES <= nelem;
+           i += TRANSFORM_REDUCE_NLANES) {
+        for (size_t l = 0; l < TRANSFORM_REDUCE_NLANES; ++l) {
+          lanes[l] = reduce_op(lanes[l], op(i + l));
+        }
+      }
+      result.value = lanes[0];
+      for (size_t l = 1; l < TRANSFORM_REDUCE_NLANES; ++l) {
+        result.value = reduce_op(result.value, lanes[l]);
+      }
+    } else {
+      result.value = op(0);
+      i = 1;
+    }
+    for (; i < nelem; ++i) {
+      result.value = reduce_op(result.value, op(i));
+    }
+    result.valid = true;
+    return result;
+  }
+
+  /**
+   * Reduces the values \c op(0) ... \c op(nelem-1) using \c reduce_op,
+   * with the elements split among the threads available to the unit.
+   */
+  template<typename ValueType, typename ReduceOperation, typename IndexedOp>
+  local_result<ValueType> transform_reduce_local(
+    dash::execution::sequenced_policy,
+    size_t          nelem,
+    ReduceOperation reduce_op,
+    IndexedOp       op)
+  {
+    return transform_reduce_serial<ValueType>(nelem, reduce_op, op);
+  }
+
+  template<
+    typename ValueType,
+    typename ExecutionPolicy,
+    typename ReduceOperation,
+    typename IndexedOp>
+  local_result<ValueType> transform_reduce_local(
+    ExecutionPolicy,
+    size_t          nelem,
+    ReduceOperation reduce_op,
+    IndexedOp       op)
+  {
+#ifdef DASH_ENABLE_OPENMP
+    dash::util::UnitLocality uloc;
+    auto n_threads = std::min<size_t>(
+                       std::max(uloc.num_domain_threads(), 1),
+                       nelem / TRANSFORM_REDUCE_MIN_NELEM_PER_THREAD);
+    DASH_LOG_DEBUG("dash::transform_reduce", "threads:", n_threads);
+    if (n_threads > 1) {
+      std::vector<local_result<ValueType>> t_results(n_threads);
+      #pragma omp parallel num_threads(n_threads)
+      {
+        // Chunks are sized by the number of threads actually granted,
+        // which may be less than requested:
+        size_t t_num   = omp_get_num_threads();
+        size_t t_id    = omp_get_thread_num();
+        size_t t_begin = nelem * t_id / t_num;
+        size_t t_end   = nelem * (t_id + 1) / t_num;
+        t_results[t_id] = transform_reduce_serial<ValueType>(
+                            t_end - t_begin,
+                            reduce_op,
+                            [&op, t_begin](size_t i) {
+                              return op(t_begin + i);
+                            });
+      }
+      local_result<ValueType> result;
+      for (const auto & t_result : t_results) {
+        if (!t_result.valid) {
+          continue;
+        }
+        result.value = result.valid
+                       ? reduce_op(result.value, t_result.value)
+                       : t_result.value;
+        result.valid = true;
+      }
+      return result;
+    }
+#endif // DASH_ENABLE_OPENMP
+    return transform_reduce_serial<ValueType>(nelem, reduce_op, op);
+  }
+
+  /**
+   * Identity element of the predefined DART reduction \c op for
+   * \c ValueType.
+   *
+   * \returns  \c false if no identity element is known for the reduction.
+   */
+  template<typename ValueType>
+  bool dart_reduce_identity(
+    dart_operation_t   op,
+    ValueType        & identity,
+    std::true_type     /* arithmetic value type */)
+  {
+    typedef std::numeric_limits<ValueType> limits;
+    switch (op) {
+      case DART_OP_SUM:
+      case DART_OP_BOR:
+      case DART_OP_BXOR:
+        identity = ValueType(0);
+        return true;
+      case DART_OP_PROD:
+        identity = ValueType(1);
+        return true;
+      case DART_OP_MIN:
+        identity = limits::has_infinity ? limits::infinity() : limits::max();
+        return true;
+      case DART_OP_MAX:
+        identity = limits::has_infinity ? -limits::infinity()
+                                        : limits::lowest();
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  template<typename ValueType>
+  bool dart_reduce_identity(
+    dart_operation_t,
+    ValueType        &,
+    std::false_type  /* arithmetic value type */)
+  {
+    return false;
+  }
+
+  /**
+   * Combines the local results of \c dash::transform_reduce of all units
+   * in \c team.
+   *
+   * For predefined reductions, units without local elements contribute the
+   * identity element so all units use the predefined DART reduction.
+   * The choice only depends on the reduction and the value type, so it is
+   * identical on all units.
+   */
+  template<typename ValueType, typename ReduceOperation>
+  local_result<ValueType> transform_reduce_results(
+    local_result<ValueType>   l_result,
+    ReduceOperation           reduce_op,
+    dash::Team              & team)
+  {
+    ValueType identity;
+    bool non_empty = dart_reduce_identity(
+                       dart_reduce_operation<ReduceOperation>::value,
+                       identity,
+                       std::is_arithmetic<ValueType>());
+    if (non_empty && !l_result.valid) {
+      l_result.value = identity;
+      l_result.valid = true;
+    }
+    return reduce_local_results(l_result, reduce_op, non_empty, team);
+  }
+
+} // namespace internal
+
+/**
+ * Accumulate the results of \c unary_op applied to the values in the global
+ * range [\ref in_first, \ref in_last) using the binary reduce function
+ * \c reduce_op, which must be commutative and associative.
+ *
+ * Equivalent to \c dash::transform into a temporary range followed by
+ * \c dash::reduce, but fused into a single pass over the local elements and
+ * a single collective reduction without allocating a temporary.
+ *
+ * The result type is the type of \c init.
+ *
+ * Local elements of every unit are processed as specified by the execution
+ * policy.
+ *
+ * Collective operation.
+ *
+ * \param policy    Execution policy for the local elements, see
+ *                  \ref dash::execution.
+ * \param in_first  Global iterator describing the beginning of the range to
+ *                  reduce.
+ * \param in_last   Global iterator describing the end of the range to reduce.
+ * \param init      The initial element to use in the accumulation.
+ * \param reduce_op The associative, commutative binary operation to apply
+ *                  to the transformed values.
+ * \param unary_op  The transformation applied to every element.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt,
+  class ValueType,
+  class ReduceOperation,
+  class UnaryOperation,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+ValueType
+transform_reduce(
+  ExecutionPolicy&& policy,
+  GlobInputIt       in_first,
+  GlobInputIt       in_last,
+  ValueType         init,
+  ReduceOperation   reduce_op,
+  UnaryOperation    unary_op)
+{
+  auto & team    = in_first.team();
+  auto l_range   = dash::local_range(in_first, in_last);
+  auto l_first   = l_range.begin;
+  size_t l_nelem = std::distance(l_range.begin, l_range.end);
+
+  auto l_result = dash::internal::transform_reduce_local<ValueType>(
+                    policy,
+                    l_nelem,
+                    reduce_op,
+                    [l_first, &unary_op](size_t i) {
+                      return unary_op(l_first[i]);
+                    });
+  auto g_result = dash::internal::transform_reduce_results(
+                    l_result, reduce_op, team);
+  return reduce_op(init, g_result.value);
+}
+
+/**
+ * Accumulate the results of \c binary_op applied to pairs of values in the
+ * global ranges [\ref in_first_a, \ref in_last_a) and
+ * [\ref in_first_b, \ref in_first_b + (in_last_a - in_first_a)) using the
+ * binary reduce function \c reduce_op, which must be commutative and
+ * associative.
+ *
+ * Both ranges must be distributed identically among the units, e.g. as
+ * the same range in containers with equal patterns.
+ *
+ * Local elements of every unit are processed as specified by the execution
+ * policy.
+ *
+ * Collective operation.
+ *
+ * \param policy     Execution policy for the local elements, see
+ *                   \ref dash::execution.
+ * \param in_first_a Global iterator describing the beginning of the first
+ *                   range.
+ * \param in_last_a  Global iterator describing the end of the first range.
+ * \param in_first_b Global iterator describing the beginning of the second
+ *                   range.
+ * \param init       The initial element to use in the accumulation.
+ * \param reduce_op  The associative, commutative binary operation to apply
+ *                   to the transformed values.
+ * \param binary_op  The transformation applied to every pair of elements.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class ExecutionPolicy,
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class ReduceOperation,
+  class BinaryOperation,
+  typename = internal::enable_if_execution_policy<ExecutionPolicy> >
+ValueType
+transform_reduce(
+  ExecutionPolicy&& policy,
+  GlobInputIt1      in_first_a,
+  GlobInputIt1      in_last_a,
+  GlobInputIt2      in_first_b,
+  ValueType         init,
+  ReduceOperation   reduce_op,
+  BinaryOperation   binary_op)
+{
+  auto & team    = in_first_a.team();
+  auto l_range_a = dash::local_range(in_first_a, in_last_a);
+  auto l_range_b = dash::local_range(
+                     in_first_b,
+                     in_first_b + dash::distance(in_first_a, in_last_a));
+  auto l_first_a = l_range_a.begin;
+  auto l_first_b = l_range_b.begin;
+  size_t l_nelem = std::distance(l_range_a.begin, l_range_a.end);
+
+  DASH_ASSERT_EQ(
+    l_nelem, std::distance(l_range_b.begin, l_range_b.end),
+    "dash::transform_reduce: ranges are not distributed identically");
+
+  auto l_result = dash::internal::transform_reduce_local<ValueType>(
+                    policy,
+                    l_nelem,
+                    reduce_op,
+                    [l_first_a, l_first_b, &binary_op](size_t i) {
+                      return binary_op(l_first_a[i], l_first_b[i]);
+                    });
+  auto g_result = dash::internal::transform_reduce_results(
+                    l_result, reduce_op, team);
+  return reduce_op(init, g_result.value);
+}
+
+/**
+ * Accumulate the results of \c unary_op applied to the values in the global
+ * range [\ref in_first, \ref in_last) using the binary reduce function
+ * \c reduce_op, with the local elements of every unit processed in a single
+ * vectorizable pass in the calling thread.
+ *
+ * Pass \c dash::execution::par to split the local elements among the threads
+ * available to the unit.
+ *
+ * \see dash::transform_reduce(ExecutionPolicy&&, GlobInputIt, GlobInputIt,
+ *                             ValueType, ReduceOperation, UnaryOperation)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class ValueType,
+  class ReduceOperation,
+  class UnaryOperation,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+ValueType
+transform_reduce(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  ValueType       init,
+  ReduceOperation reduce_op,
+  UnaryOperation  unary_op)
+{
+  return dash::transform_reduce(
+           dash::execution::seq,
+           in_first, in_last, init, reduce_op, unary_op);
+}
+
+/**
+ * Accumulate the results of \c binary_op applied to pairs of values in the
+ * global ranges [\ref in_first_a, \ref in_last_a) and
+ * [\ref in_first_b, \ref in_first_b + (in_last_a - in_first_a)) using the
+ * binary reduce function \c reduce_op, with the local elements of every
+ * unit processed in a single vectorizable pass in the calling thread.
+ *
+ * \see dash::transform_reduce(ExecutionPolicy&&, GlobInputIt1, GlobInputIt1,
+ *                             GlobInputIt2, ValueType, ReduceOperation,
+ *                             BinaryOperation)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class ReduceOperation,
+  class BinaryOperation,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt1>::value
+                      >::type>
+ValueType
+transform_reduce(
+  GlobInputIt1    in_first_a,
+  GlobInputIt1    in_last_a,
+  GlobInputIt2    in_first_b,
+  ValueType       init,
+  ReduceOperation reduce_op,
+  BinaryOperation binary_op)
+{
+  return dash::transform_reduce(
+           dash::execution::seq,
+           in_first_a, in_last_a, in_first_b, init, reduce_op, binary_op);
+}
+
+/**
+ * Computes the inner product of the global ranges
+ * [\ref in_first_a, \ref in_last_a) and
+ * [\ref in_first_b, \ref in_first_b + (in_last_a - in_first_a)),
+ * using \c op_sum to accumulate the results of \c op_prod applied to pairs
+ * of elements.
+ *
+ * Both ranges must be distributed identically among the units.
+ *
+ * \see dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType,
+  class SumOperation,
+  class ProductOperation>
+ValueType
+inner_product(
+  GlobInputIt1     in_first_a,
+  GlobInputIt1     in_last_a,
+  GlobInputIt2     in_first_b,
+  ValueType        init,
+  SumOperation     op_sum,
+  ProductOperation op_prod)
+{
+  return dash::transform_reduce(
+           in_first_a, in_last_a, in_first_b, init, op_sum, op_prod);
+}
+
+/**
+ * Computes the inner product, i.e. the sum of products, of the global ranges
+ * [\ref in_first_a, \ref in_last_a) and
+ * [\ref in_first_b, \ref in_first_b + (in_last_a - in_first_a)).
+ *
+ * Both ranges must be distributed identically among the units.
+ *
+ * Example:
+ *
+ * \code
+ *   double dot = dash::inner_product(x.begin(), x.end(), y.begin(), 0.0);
+ * \endcode
+ *
+ * \see dash::transform_reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt1,
+  class GlobInputIt2,
+  class ValueType>
+ValueType
+inner_product(
+  GlobInputIt1 in_first_a,
+  GlobInputIt1 in_last_a,
+  GlobInputIt2 in_first_b,
+  ValueType    init)
+{
+  return dash::transform_reduce(
+           in_first_a, in_last_a, in_first_b, init,
+           dash::plus<ValueType>(), dash::multiply<ValueType>());
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__TRANSFORM_REDUCE_H__
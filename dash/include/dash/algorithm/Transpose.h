@@ -0,0 +1,98 @@
+#ifndef DASH__ALGORITHM__TRANSPOSE_H__INCLUDED
+#define DASH__ALGORITHM__TRANSPOSE_H__INCLUDED
+
+#include <dash/algorithm/Redistribute.h>
+
+#include <dash/Types.h>
+
+#include <dash/internal/Logging.h>
+
+#include <type_traits>
+
+namespace dash {
+
+/**
+ * Transposes the two-dimensional matrix \c src into matrix \c dst, i.e.
+ * \c dst(j,i) = \c src(i,j).
+ *
+ * The extents of \c dst must be the transposed extents of \c src, the
+ * distributions of both matrices are arbitrary row-major block patterns
+ * like \c dash::BlockPattern or \c dash::TilePattern, for square and
+ * non-square unit grids.
+ *
+ * Every unit transposes the intersections of its local blocks with the
+ * blocks of the destination in cache-sized tiles and writes them to their
+ * owners in a single exchange pass, comparable to an all-to-all. To
+ * transpose matrices with the same patterns repeatedly, compute a
+ * \c dash::RedistributeSchedule with \c RedistributeMapping::TRANSPOSE
+ * once and execute it for every transpose.
+ *
+ * Collective operation on the team of the source matrix.
+ *
+ * \throws dash::exception::InvalidArgument  if the extents of \c dst are
+ *                                           not the transposed extents of
+ *                                           \c src
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class SrcMatrixT, class DstMatrixT>
+void transpose(
+  const SrcMatrixT & src,
+  DstMatrixT       & dst)
+{
+  typedef typename DstMatrixT::value_type value_t;
+  static_assert(
+    std::is_same<
+      typename std::remove_cv<typename SrcMatrixT::value_type>::type,
+      value_t>::value,
+    "dash::transpose: value types of matrices differ");
+
+  static_assert(
+    SrcMatrixT::ndim() == 2 && DstMatrixT::ndim() == 2,
+    "dash::transpose: only two-dimensional matrices are supported");
+
+  DASH_LOG_DEBUG("dash::transpose()");
+
+  RedistributeSchedule<
+    typename SrcMatrixT::pattern_type,
+    typename DstMatrixT::pattern_type>
+  schedule(src.pattern(), dst.pattern(), RedistributeMapping::TRANSPOSE);
+  schedule.execute(src, dst);
+  DASH_LOG_DEBUG("dash::transpose >");
+}
+
+/**
+ * Transposes the square two-dimensional matrix \c matrix in place.
+ *
+ * The local blocks are transposed into a buffer before they are written
+ * to their owners, so the local memory required is the local size of the
+ * matrix.
+ *
+ * Collective operation on the team of the matrix.
+ *
+ * \throws dash::exception::InvalidArgument  if the matrix is not square
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class MatrixT>
+void transpose(
+  MatrixT & matrix)
+{
+  static_assert(
+    MatrixT::ndim() == 2,
+    "dash::transpose: only two-dimensional matrices are supported");
+
+  DASH_LOG_DEBUG("dash::transpose(in-place)");
+
+  RedistributeSchedule<
+    typename MatrixT::pattern_type,
+    typename MatrixT::pattern_type>
+  schedule(matrix.pattern(), matrix.pattern(),
+           RedistributeMapping::TRANSPOSE);
+  schedule.execute(matrix, matrix);
+  DASH_LOG_DEBUG("dash::transpose(in-place) >");
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__TRANSPOSE_H__INCLUDED
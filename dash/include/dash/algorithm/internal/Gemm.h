@@ -0,0 +1,340 @@
+#ifndef DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
+
+#include <dash/Execution.h>
+#include <dash/Types.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace dash {
+namespace internal {
+
+/**
+ * Register and cache block extents of the GEMM implementation for element
+ * type \c ValueType.
+ */
+template <typename ValueType>
+struct gemm_blocking
+{
+  /// Width of vector registers used in the micro-kernel, in bytes.
+#if defined(__AVX512F__)
+  static constexpr int vec_bytes = 64;
+#elif defined(__AVX__)
+  static constexpr int vec_bytes = 32;
+#else
+  static constexpr int vec_bytes = 16;
+#endif
+  /// Number of rows of C updated by a single invocation of the
+  /// micro-kernel. Every row is held in two vector registers, so the
+  /// accumulator block occupies 12 of the 16 vector registers available
+  /// in SSE and AVX.
+  static constexpr int mr = 6;
+  /// Number of elements in a vector register.
+  static constexpr int vl = vec_bytes / sizeof(ValueType);
+  /// Number of columns of C updated by a single invocation of the
+  /// micro-kernel.
+  static constexpr int nr = 2 * vl;
+  /// Number of rows of a packed block of A, chosen such that the packed
+  /// block (\c mc x \c kc) fits into the L2 cache. Multiple of \c mr.
+  static constexpr int mc = 120;
+  /// Number of columns of a packed block of A and rows of a packed panel
+  /// of B, chosen such that a micro-panel of B (\c kc rows of two vector
+  /// registers) fits into the L1 cache.
+  static constexpr int kc = 256;
+  /// Number of columns of a packed panel of B, chosen such that the panel
+  /// (\c kc x \c nc) fits into the L3 cache.
+  static constexpr int nc = 2048;
+};
+
+template <typename ValueType>
+constexpr int gemm_blocking<ValueType>::vec_bytes;
+template <typename ValueType>
+constexpr int gemm_blocking<ValueType>::mr;
+template <typename ValueType>
+constexpr int gemm_blocking<ValueType>::vl;
+template <typename ValueType>
+constexpr int gemm_blocking<ValueType>::nr;
+template <typename ValueType>
+constexpr int gemm_blocking<ValueType>::mc;
+template <typename ValueType>
+constexpr int gemm_blocking<ValueType>::kc;
+template <typename ValueType>
+constexpr int gemm_blocking<ValueType>::nc;
+
+/**
+ * Packs the \c mc x \c kc block of row-major matrix \c A at offset
+ * \c (ic, pc) into micro-panels of \c gemm_blocking::mr rows, stored column by
+ * column. Rows exceeding \c mc are padded with zeros.
+ */
+template <typename ValueType>
+void gemm_pack_a(
+  const ValueType * A,
+  long long         lda,
+  long long         mc,
+  long long         kc,
+  ValueType       * A_packed)
+{
+  constexpr int mr = gemm_blocking<ValueType>::mr;
+  for (long long ir = 0; ir < mc; ir += mr) {
+    long long mr_eff = std::min<long long>(mr, mc - ir);
+    const ValueType * a_panel = A + ir * lda;
+    for (long long p = 0; p < kc; ++p) {
+      for (int i = 0; i < mr_eff; ++i) {
+        A_packed[i] = a_panel[i * lda + p];
+      }
+      for (int i = mr_eff; i < mr; ++i) {
+        A_packed[i] = 0;
+      }
+      A_packed += mr;
+    }
+  }
+}
+
+/**
+ * Packs the \c kc x \c nc panel of row-major matrix \c B into
+ * micro-panels of \c gemm_blocking::nr columns, stored row by row. Columns
+ * exceeding \c nc are padded with zeros.
+ */
+template <typename ValueType>
+void gemm_pack_b(
+  const ValueType * B,
+  long long         ldb,
+  long long         kc,
+  long long         nc,
+  ValueType       * B_packed)
+{
+  constexpr int nr = gemm_blocking<ValueType>::nr;
+  for (long long jr = 0; jr < nc; jr += nr) {
+    long long nr_eff = std::min<long long>(nr, nc - jr);
+    const ValueType * b_panel = B + jr;
+    for (long long p = 0; p < kc; ++p) {
+      for (int j = 0; j < nr_eff; ++j) {
+        B_packed[j] = b_panel[p * ldb + j];
+      }
+      for (int j = nr_eff; j < nr; ++j) {
+        B_packed[j] = 0;
+      }
+      B_packed += nr;
+    }
+  }
+}
+
+/**
+ * Micro-kernel of the GEMM implementation, updates the
+ * \c mr_eff x \c nr_eff block of C with the product of packed
+ * micro-panels of A and B.
+ *
+ * The accumulator block of \c gemm_blocking::mr rows of two vector registers each
+ * is held in registers. Compilers not supporting GNU vector extensions
+ * vectorize the loop over its columns.
+ */
+template <typename ValueType>
+inline void gemm_micro_kernel(
+  long long                    kc,
+  const ValueType * __restrict a,
+  const ValueType * __restrict b,
+  ValueType       * __restrict C,
+  long long                    ldc,
+  long long                    mr_eff,
+  long long                    nr_eff)
+{
+  constexpr int mr = gemm_blocking<ValueType>::mr;
+  constexpr int nr = gemm_blocking<ValueType>::nr;
+
+  ValueType acc[mr][nr];
+#if defined(__GNUC__)
+  typedef ValueType vec_t __attribute__((vector_size(gemm_blocking<ValueType>::vec_bytes)));
+  constexpr int vl = gemm_blocking<ValueType>::vl;
+  constexpr int nv = nr / vl;
+
+  vec_t v_acc[mr][nv] = { };
+  for (long long p = 0; p < kc; ++p) {
+    vec_t v_b[nv];
+    for (int v = 0; v < nv; ++v) {
+      std::memcpy(&v_b[v], b + v * vl, sizeof(vec_t));
+    }
+    for (int i = 0; i < mr; ++i) {
+      // Broadcast of a[i], subtracting zero preserves signed zeros:
+      const vec_t v_a = a[i] - vec_t{ };
+      for (int v = 0; v < nv; ++v) {
+        v_acc[i][v] += v_a * v_b[v];
+      }
+    }
+    a += mr;
+    b += nr;
+  }
+  std::memcpy(acc, v_acc, sizeof(acc));
+#else
+  for (int i = 0; i < mr; ++i) {
+    for (int j = 0; j < nr; ++j) {
+      acc[i][j] = 0;
+    }
+  }
+  for (long long p = 0; p < kc; ++p) {
+    for (int i = 0; i < mr; ++i) {
+      const ValueType a_ip = a[i];
+      for (int j = 0; j < nr; ++j) {
+        acc[i][j] += a_ip * b[j];
+      }
+    }
+    a += mr;
+    b += nr;
+  }
+#endif
+  if (mr_eff == mr && nr_eff == nr) {
+    for (int i = 0; i < mr; ++i) {
+      for (int j = 0; j < nr; ++j) {
+        C[i * ldc + j] += acc[i][j];
+      }
+    }
+  } else {
+    // Partial block at the lower or right boundary of C:
+    for (long long i = 0; i < mr_eff; ++i) {
+      for (long long j = 0; j < nr_eff; ++j) {
+        C[i * ldc + j] += acc[i][j];
+      }
+    }
+  }
+}
+
+/**
+ * Updates the \c mc x \c nc block of row-major matrix C with the product
+ * of packed blocks of A and B.
+ */
+template <typename ValueType>
+void gemm_macro_kernel(
+  const ValueType * A_packed,
+  const ValueType * B_packed,
+  ValueType       * C,
+  long long         ldc,
+  long long         mc,
+  long long         nc,
+  long long         kc)
+{
+  constexpr int mr = gemm_blocking<ValueType>::mr;
+  constexpr int nr = gemm_blocking<ValueType>::nr;
+  for (long long jr = 0; jr < nc; jr += nr) {
+    long long nr_eff = std::min<long long>(nr, nc - jr);
+    for (long long ir = 0; ir < mc; ir += mr) {
+      long long mr_eff = std::min<long long>(mr, mc - ir);
+      gemm_micro_kernel(
+        kc,
+        A_packed + ir * kc,
+        B_packed + jr * kc,
+        C + ir * ldc + jr,
+        ldc,
+        mr_eff,
+        nr_eff);
+    }
+  }
+}
+
+/**
+ * Cache- and register-blocked multiplication \c C += A x B of row-major
+ * matrices, with A of extents m x k, B of extents k x n and C of extents
+ * m x n.
+ *
+ * Blocks of A and panels of B are packed into contiguous buffers sized
+ * for the L2 and L3 cache, respectively. With OpenMP support enabled,
+ * the blocks of A are distributed among the threads available to the
+ * unit.
+ */
+template <typename ValueType>
+void gemm_row_major(
+  const ValueType * A,
+  const ValueType * B,
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k)
+{
+  constexpr int mr = gemm_blocking<ValueType>::mr;
+  constexpr int nr = gemm_blocking<ValueType>::nr;
+  constexpr int mc_max = gemm_blocking<ValueType>::mc;
+  constexpr int kc_max = gemm_blocking<ValueType>::kc;
+  constexpr int nc_max = gemm_blocking<ValueType>::nc;
+
+  if (m <= 0 || n <= 0 || k <= 0) {
+    return;
+  }
+
+  const long long lda = k;
+  const long long ldb = n;
+  const long long ldc = n;
+
+  const long long nc_buf = (std::min<long long>(n, nc_max) + nr - 1)
+                           / nr * nr;
+  const long long kc_buf = std::min<long long>(k, kc_max);
+  const long long mc_buf = (std::min<long long>(m, mc_max) + mr - 1)
+                           / mr * mr;
+  const long long num_blocks_m = (m + mc_max - 1) / mc_max;
+
+  const int n_threads = static_cast<int>(std::min<long long>(
+                          num_blocks_m,
+                          dash::internal::execution_num_threads(
+                            dash::execution::par, m * n)));
+
+  std::unique_ptr<ValueType[]> B_packed(new ValueType[kc_buf * nc_buf]);
+  std::unique_ptr<ValueType[]> A_packed(
+                                 new ValueType[n_threads * mc_buf * kc_buf]);
+
+  for (long long jc = 0; jc < n; jc += nc_max) {
+    long long nc = std::min<long long>(nc_max, n - jc);
+    for (long long pc = 0; pc < k; pc += kc_max) {
+      long long kc = std::min<long long>(kc_max, k - pc);
+      gemm_pack_b(B + pc * ldb + jc, ldb, kc, nc, B_packed.get());
+#ifdef DASH_ENABLE_OPENMP
+      #pragma omp parallel for num_threads(n_threads) schedule(static)
+#endif
+      for (long long bm = 0; bm < num_blocks_m; ++bm) {
+        int t_id = 0;
+#ifdef DASH_ENABLE_OPENMP
+        t_id = omp_get_thread_num();
+#endif
+        long long   ic       = bm * mc_max;
+        long long   mc       = std::min<long long>(mc_max, m - ic);
+        ValueType * A_thread = A_packed.get() + t_id * mc_buf * kc_buf;
+        gemm_pack_a(A + ic * lda + pc, lda, mc, kc, A_thread);
+        gemm_macro_kernel(
+          A_thread, B_packed.get(), C + ic * ldc + jc, ldc, mc, nc, kc);
+      }
+    }
+  }
+}
+
+/**
+ * Built-in multiplication \c C += A x B of matrices in the given storage
+ * order, with A of extents m x k, B of extents k x n and C of extents
+ * m x n. Used for local multiplication of matrix blocks if no BLAS
+ * implementation is available.
+ */
+template <typename ValueType>
+void gemm_local(
+  const ValueType * A,
+  const ValueType * B,
+  ValueType       * C,
+  long long         m,
+  long long         n,
+  long long         k,
+  MemArrange        storage)
+{
+  if (storage == dash::ROW_MAJOR) {
+    gemm_row_major(A, B, C, m, n, k);
+  } else {
+    // Column-major matrices are the row-major transposes, and
+    // C^T += B^T x A^T:
+    gemm_row_major(B, A, C, n, m, k);
+  }
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__ALGORITHM__INTERNAL__GEMM_H__INCLUDED
@@ -10,6 +10,13 @@
 
 #define NLT_NLE_BLOCK 2
 
+// Minimum number of elements processed by a thread in local phases
+#define PSORT_MIN_NELEM_PER_THREAD (1 << 14)
+
+// Default size of the staging buffer of the in-place exchange relative to
+// the largest local range
+#define PSORT_STAGING_FRACTION 8
+
 #include <algorithm>
 #include <cstddef>
 #include <limits>
@@ -114,7 +121,8 @@ inline const std::vector<std::size_t> psort__local_histogram(
     PartitionBorder<MappedType> const& p_borders,
     Iter                               data_lbegin,
     Iter                               data_lend,
-    SortableHash                       sortable_hash)
+    SortableHash                       sortable_hash,
+    int                                nthreads = 1)
 {
   DASH_LOG_TRACE("< psort__local_histogram");
 
@@ -133,7 +141,14 @@ inline const std::vector<std::size_t> psort__local_histogram(
   using reference = typename std::iterator_traits<Iter>::reference;
 
   if (n_l_elem > 0) {
-    for (auto const& idx : valid_partitions) {
+    auto const nvalid = static_cast<std::ptrdiff_t>(valid_partitions.size());
+    dash__unused(nthreads);
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                             if(nthreads > 1)
+#endif
+    for (std::ptrdiff_t v = 0; v < nvalid; ++v) {
+      auto const idx = valid_partitions[v];
       // search lower bound of partition value
       auto lb_it = std::lower_bound(
           data_lbegin,
@@ -621,6 +636,539 @@ inline void psort__init_partition_borders(
   DASH_LOG_TRACE("psort__init_partition_borders >");
 }
 
+/**
+ * Number of threads to use in local phases of \c dash::sort, limited by
+ * the threads available to the calling unit (see
+ * \c dash::util::UnitLocality::num_domain_threads) and the number of
+ * local elements.
+ */
+inline int psort__num_threads(std::size_t n_l_elem)
+{
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  auto const max_threads = std::max<std::size_t>(
+      1, n_l_elem / PSORT_MIN_NELEM_PER_THREAD);
+  return static_cast<int>(std::min<std::size_t>(
+      std::max(uloc.num_domain_threads(), 1), max_threads));
+#else
+  dash__unused(n_l_elem);
+  return 1;
+#endif
+}
+
+/**
+ * Number of elements of the sorted range \c [a, a + na) among the first
+ * \c d elements of the stable merge of \c [a, a + na) and
+ * \c [b, b + nb), found by binary search on the cross diagonal \c d of
+ * the merge matrix (merge path).
+ */
+template <typename ValueType, class Compare>
+inline std::size_t psort__merge_path(
+    ValueType const* a,
+    std::size_t      na,
+    ValueType const* b,
+    std::size_t      nb,
+    std::size_t      d,
+    Compare          comp)
+{
+  std::size_t lo = (d > nb) ? d - nb : 0;
+  std::size_t hi = std::min(d, na);
+  while (lo < hi) {
+    auto const i = lo + (hi - lo) / 2;
+    if (comp(b[d - i - 1], a[i])) {
+      hi = i;
+    }
+    else {
+      lo = i + 1;
+    }
+  }
+  return lo;
+}
+
+/**
+ * Merges the sorted ranges \c [first1, last1) and \c [first2, last2) to
+ * \c out using \c nthreads threads. Every thread merges a partition of
+ * the output range of equal size, the corresponding input partitions are
+ * determined by \c psort__merge_path.
+ */
+template <typename ValueType, class Compare>
+inline void psort__parallel_merge(
+    ValueType const* first1,
+    ValueType const* last1,
+    ValueType const* first2,
+    ValueType const* last2,
+    ValueType*       out,
+    Compare          comp,
+    int              nthreads)
+{
+  std::size_t const n1 = std::distance(first1, last1);
+  std::size_t const n2 = std::distance(first2, last2);
+  std::size_t const n  = n1 + n2;
+
+  auto const max_threads =
+      static_cast<int>(std::max<std::size_t>(
+          1, n / PSORT_MIN_NELEM_PER_THREAD));
+  nthreads = std::min(nthreads, max_threads);
+
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+  if (nthreads < 2) {
+    std::merge(first1, last1, first2, last2, out, comp);
+    return;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads) schedule(static)
+  for (int t = 0; t < nthreads; ++t) {
+    auto const d_begin = n * t / nthreads;
+    auto const d_end   = n * (t + 1) / nthreads;
+    auto const i_begin =
+        psort__merge_path(first1, n1, first2, n2, d_begin, comp);
+    auto const i_end =
+        psort__merge_path(first1, n1, first2, n2, d_end, comp);
+    std::merge(
+        first1 + i_begin,
+        first1 + i_end,
+        first2 + (d_begin - i_begin),
+        first2 + (d_end - i_end),
+        out + d_begin,
+        comp);
+  }
+#endif
+}
+
+/**
+ * Merges the consecutive sorted sequences in \c first with boundaries at
+ * the given offsets, where \c offsets[0] is 0 and \c offsets.back() is
+ * the total number of elements.
+ *
+ * Sequences are merged pairwise in a binary tree. With a single thread,
+ * merges are in-place. Otherwise, merge levels alternate between the range
+ * and a temporary buffer of equal size and every merge uses all threads.
+ */
+template <typename ValueType, class Compare>
+inline void psort__merge_sequences(
+    ValueType*                      first,
+    std::vector<std::size_t> const& offsets,
+    Compare                         comp,
+    int                             nthreads)
+{
+  DASH_LOG_TRACE("< psort__merge_sequences", "threads:", nthreads);
+
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+
+  std::vector<std::size_t> bounds(offsets);
+  if (bounds.size() < 3) {
+    return;
+  }
+
+  if (nthreads < 2) {
+    while (bounds.size() > 2) {
+      std::vector<std::size_t> next_bounds{0};
+      for (std::size_t s = 0; s + 1 < bounds.size(); s += 2) {
+        auto const mid  = bounds[s + 1];
+        auto const last = (s + 2 < bounds.size()) ? bounds[s + 2] : mid;
+        std::inplace_merge(
+            first + bounds[s], first + mid, first + last, comp);
+        next_bounds.push_back(last);
+      }
+      bounds.swap(next_bounds);
+    }
+    return;
+  }
+
+  std::vector<ValueType> buffer(bounds.back());
+  ValueType* src = first;
+  ValueType* dst = buffer.data();
+  while (bounds.size() > 2) {
+    std::vector<std::size_t> next_bounds{0};
+    for (std::size_t s = 0; s + 1 < bounds.size(); s += 2) {
+      auto const mid  = bounds[s + 1];
+      auto const last = (s + 2 < bounds.size()) ? bounds[s + 2] : mid;
+      psort__parallel_merge<ValueType>(
+          src + bounds[s],
+          src + mid,
+          src + mid,
+          src + last,
+          dst + bounds[s],
+          comp,
+          nthreads);
+      next_bounds.push_back(last);
+    }
+    bounds.swap(next_bounds);
+    std::swap(src, dst);
+  }
+  if (src != first) {
+    std::copy(src, src + bounds.back(), first);
+  }
+
+  DASH_LOG_TRACE("psort__merge_sequences >");
+}
+
+/**
+ * Upper bound of the temporary memory in bytes allocated by
+ * \c psort__merge_sequences for \c n elements. With a single thread,
+ * \c std::inplace_merge allocates a buffer internally that may be as
+ * large as the merged range, which is the size of the buffer of the
+ * threaded merge.
+ */
+template <typename ValueType>
+inline std::size_t psort__merge_extra_bytes(std::size_t n)
+{
+  return n * sizeof(ValueType);
+}
+
+/**
+ * Upper bound of the temporary memory in bytes allocated by
+ * \c psort__local_sort for \c n elements: the buffer of the final merge
+ * if partitions are sorted by multiple threads, or the buffer of
+ * \c std::stable_sort.
+ */
+template <typename ValueType>
+inline std::size_t psort__local_sort_extra_bytes(
+    std::size_t n, int nthreads, bool stable)
+{
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+  return (nthreads > 1 || stable) ? psort__merge_extra_bytes<ValueType>(n)
+                                  : 0;
+}
+
+/**
+ * Upper bound of the temporary memory in bytes allocated by
+ * \c psort__local_sort_by_key and \c psort__merge_sequences_by_key for
+ * \c n keys: the permutation and either the buffer of sorting or merging
+ * the permutation or the buffer of permuting keys and values.
+ */
+template <typename KeyType, typename ValueType>
+inline std::size_t psort__by_key_extra_bytes(std::size_t n)
+{
+  return n * sizeof(std::size_t) +
+         n * std::max({sizeof(std::size_t), sizeof(KeyType),
+                       sizeof(ValueType)});
+}
+
+/**
+ * Sorts the local range \c [first, last) using \c nthreads threads.
+ * Partitions of equal size are sorted by individual threads and merged by
+ * \c psort__merge_sequences. If \c stable is set, the order of equal
+ * elements is preserved.
+ */
+template <typename ValueType, class Compare>
+inline void psort__local_sort(
+    ValueType* first,
+    ValueType* last,
+    Compare    comp,
+    int        nthreads,
+    bool       stable = false)
+{
+  std::size_t const n = std::distance(first, last);
+
+  auto const max_threads = static_cast<int>(
+      std::max<std::size_t>(1, n / PSORT_MIN_NELEM_PER_THREAD));
+  nthreads = std::min(nthreads, max_threads);
+
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+  if (nthreads < 2) {
+    if (stable) {
+      std::stable_sort(first, last, comp);
+    }
+    else {
+      std::sort(first, last, comp);
+    }
+    return;
+  }
+
+  std::vector<std::size_t> offsets(nthreads + 1);
+  for (int t = 0; t <= nthreads; ++t) {
+    offsets[t] = n * t / nthreads;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads) schedule(static)
+  for (int t = 0; t < nthreads; ++t) {
+    if (stable) {
+      std::stable_sort(first + offsets[t], first + offsets[t + 1], comp);
+    }
+    else {
+      std::sort(first + offsets[t], first + offsets[t + 1], comp);
+    }
+  }
+#endif
+
+  // merging is stable
+  psort__merge_sequences(first, offsets, comp, nthreads);
+}
+
+/**
+ * Replaces every element \c i of the range starting at \c first by the
+ * element at index \c perm[i].
+ */
+template <typename ValueType>
+inline void psort__permute(
+    ValueType* first, std::vector<std::size_t> const& perm, int nthreads)
+{
+  std::vector<ValueType> const buffer(first, first + perm.size());
+
+  auto const n = static_cast<std::ptrdiff_t>(perm.size());
+  dash__unused(nthreads);
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                           if(nthreads > 1)
+#endif
+  for (std::ptrdiff_t i = 0; i < n; ++i) {
+    first[i] = buffer[perm[i]];
+  }
+}
+
+/**
+ * Stable sort of the local range of keys \c [first, last) using
+ * \c nthreads threads. The range of values starting at \c values is
+ * permuted like the keys.
+ */
+template <typename KeyType, typename ValueType, class Compare>
+inline void psort__local_sort_by_key(
+    KeyType*   first,
+    KeyType*   last,
+    ValueType* values,
+    Compare    comp,
+    int        nthreads)
+{
+  std::vector<std::size_t> perm(std::distance(first, last));
+  std::iota(perm.begin(), perm.end(), 0);
+
+  psort__local_sort(
+      perm.data(),
+      perm.data() + perm.size(),
+      [first, &comp](std::size_t a, std::size_t b) {
+        return comp(first[a], first[b]);
+      },
+      nthreads,
+      true);
+
+  psort__permute(first, perm, nthreads);
+  psort__permute(values, perm, nthreads);
+}
+
+/**
+ * Merges the consecutive sorted sequences of keys in \c first with
+ * boundaries at the given offsets like \c psort__merge_sequences. The
+ * range of values starting at \c values is permuted like the keys.
+ */
+template <typename KeyType, typename ValueType, class Compare>
+inline void psort__merge_sequences_by_key(
+    KeyType*                        first,
+    ValueType*                      values,
+    std::vector<std::size_t> const& offsets,
+    Compare                         comp,
+    int                             nthreads)
+{
+  std::vector<std::size_t> perm(offsets.back());
+  std::iota(perm.begin(), perm.end(), 0);
+
+  psort__merge_sequences(
+      perm.data(),
+      offsets,
+      [first, &comp](std::size_t a, std::size_t b) {
+        return comp(first[a], first[b]);
+      },
+      nthreads);
+
+  psort__permute(first, perm, nthreads);
+  psort__permute(values, perm, nthreads);
+}
+
+/**
+ * Sorts the local range \c [first, last) in place using \c nthreads
+ * threads. The range is split into equally sized partitions by recursive
+ * bisection with \c std::nth_element, partitions are then sorted by
+ * individual threads. In contrast to \c psort__local_sort, no temporary
+ * buffer is allocated.
+ */
+template <typename ValueType, class Compare>
+inline void psort__local_sort_inplace(
+    ValueType* first, ValueType* last, Compare comp, int nthreads)
+{
+  std::size_t const n = std::distance(first, last);
+
+  auto const max_threads = static_cast<int>(
+      std::max<std::size_t>(1, n / PSORT_MIN_NELEM_PER_THREAD));
+  nthreads = std::min(nthreads, max_threads);
+
+#ifndef DASH_ENABLE_OPENMP
+  nthreads = 1;
+#endif
+  if (nthreads < 2) {
+    std::sort(first, last, comp);
+    return;
+  }
+
+  std::vector<std::size_t> offsets(nthreads + 1);
+  for (int t = 0; t <= nthreads; ++t) {
+    offsets[t] = n * t / nthreads;
+  }
+
+  // partition by recursive bisection of the ranges of threads
+  std::vector<std::pair<int, int> > ranges{{0, nthreads}};
+  while (!ranges.empty()) {
+    auto const r = ranges.back();
+    ranges.pop_back();
+    if (r.second - r.first < 2) {
+      continue;
+    }
+    auto const mid = (r.first + r.second) / 2;
+    std::nth_element(
+        first + offsets[r.first],
+        first + offsets[mid],
+        first + offsets[r.second],
+        comp);
+    ranges.emplace_back(r.first, mid);
+    ranges.emplace_back(mid, r.second);
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads) schedule(static)
+  for (int t = 0; t < nthreads; ++t) {
+    std::sort(first + offsets[t], first + offsets[t + 1], comp);
+  }
+#endif
+}
+
+/**
+ * Exchanges partitions between units without a copy of the local range.
+ *
+ * \c send_counts is the row-major matrix of the number of elements every
+ * unit sends to every other unit, partitions are stored consecutively in
+ * the local ranges of units in the order of their target units.
+ *
+ * The exchange proceeds in rounds. In every round, units read partitions
+ * of remote units into a local staging buffer of at most \c staging_nelem
+ * elements. After all units completed reading, staged elements are moved
+ * to the slots in the local range of partitions that have been read by
+ * their target units. The number of elements read in a round is limited
+ * by the free capacity of the staging buffer which all units derive
+ * from the same matrix of send counts, so no further synchronization is
+ * required. Partitions that remain at their unit are not moved.
+ *
+ * Elements in the local range are unordered after the exchange.
+ *
+ * \return  The number of rounds.
+ */
+template <typename ValueType, class UnitBeginFn>
+inline std::size_t psort__exchange_inplace(
+    /// returns a global iterator to the first local element of a unit
+    UnitBeginFn                     unit_begin,
+    ValueType*                      lbegin,
+    std::vector<std::size_t> const& send_counts,
+    std::size_t                     staging_nelem,
+    dash::Team&                     team)
+{
+  DASH_LOG_TRACE("< psort__exchange_inplace", "staging:", staging_nelem);
+
+  std::size_t const nunits = team.size();
+  std::size_t const myid   = team.myid();
+
+  std::vector<std::size_t> send_displs(nunits * nunits, 0);
+  // number of elements read from every partition
+  std::vector<std::size_t> nread(nunits * nunits, 0);
+  // number of elements read from and received by every unit
+  std::vector<std::size_t> nfreed(nunits, 0);
+  std::vector<std::size_t> nrecv(nunits, 0);
+  std::vector<std::size_t> budget(nunits, 0);
+  // number of slots of local partitions filled with received elements
+  std::vector<std::size_t> nfilled(nunits, 0);
+
+  std::size_t nremaining = 0;
+  std::size_t nincoming  = 0;
+  for (std::size_t src = 0; src < nunits; ++src) {
+    for (std::size_t dst = 0; dst < nunits; ++dst) {
+      auto const idx = src * nunits + dst;
+      if (dst > 0) {
+        send_displs[idx] = send_displs[idx - 1] + send_counts[idx - 1];
+      }
+      if (src != dst) {
+        nremaining += send_counts[idx];
+        nincoming  += (dst == myid) ? send_counts[idx] : 0;
+      }
+    }
+  }
+
+  std::vector<ValueType> staging(std::min(staging_nelem, nincoming));
+  std::size_t            nstaged = 0;
+  std::size_t            nrounds = 0;
+
+  std::vector<dash::Future<ValueType*> > copies;
+
+  while (nremaining > 0) {
+    ++nrounds;
+    for (std::size_t u = 0; u < nunits; ++u) {
+      budget[u] =
+          staging_nelem - ((nrecv[u] > nfreed[u]) ? nrecv[u] - nfreed[u] : 0);
+    }
+    for (std::size_t dst = 0; dst < nunits; ++dst) {
+      for (std::size_t s = 1; s < nunits && budget[dst] > 0; ++s) {
+        auto const src = (dst + s) % nunits;
+        auto const idx = src * nunits + dst;
+        auto const nelem =
+            std::min(send_counts[idx] - nread[idx], budget[dst]);
+        if (nelem == 0) {
+          continue;
+        }
+        if (dst == myid) {
+          auto const src_first =
+              unit_begin(static_cast<dash::team_unit_t>(src)) +
+              (send_displs[idx] + nread[idx]);
+          copies.emplace_back(dash::copy_async(
+              src_first, src_first + nelem, staging.data() + nstaged));
+          nstaged += nelem;
+        }
+        nread[idx] += nelem;
+        nrecv[dst] += nelem;
+        nfreed[src] += nelem;
+        budget[dst] -= nelem;
+        nremaining -= nelem;
+      }
+    }
+    for (auto& fut : copies) {
+      fut.wait();
+    }
+    copies.clear();
+
+    // all units completed reading in this round
+    team.barrier();
+
+    std::size_t nplaced = 0;
+    for (std::size_t dst = 0; dst < nunits && nplaced < nstaged; ++dst) {
+      auto const idx = myid * nunits + dst;
+      if (dst == myid || nfilled[dst] == nread[idx]) {
+        continue;
+      }
+      auto const nelem = std::min(nread[idx] - nfilled[dst], nstaged - nplaced);
+      std::copy(
+          staging.begin() + nplaced,
+          staging.begin() + nplaced + nelem,
+          lbegin + send_displs[idx] + nfilled[dst]);
+      nfilled[dst] += nelem;
+      nplaced += nelem;
+    }
+    std::move(
+        staging.begin() + nplaced, staging.begin() + nstaged, staging.begin());
+    nstaged -= nplaced;
+  }
+
+  DASH_ASSERT_EQ(nstaged, 0, "all received elements must be placed");
+
+  DASH_LOG_TRACE("psort__exchange_inplace >", "rounds:", nrounds);
+
+  return nrounds;
+}
+
 template <class Iter, class SortableHash>
 inline auto find_global_min_max(
     Iter lbegin, Iter lend, dart_team_t teamid, SortableHash sortable_hash)
@@ -0,0 +1,549 @@
+#ifndef DASH__HALO__GHOSTEXCHANGE_H__
+#define DASH__HALO__GHOSTEXCHANGE_H__
+
+#include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/Onesided.h>
+
+#include <dash/halo/Halo.h>
+#include <dash/halo/Types.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace dash {
+
+namespace halo {
+
+/**
+ * Ghost element exchange for containers like \ref Array and \ref Matrix,
+ * including uneven distributions like \ref CSRPattern and patterns mapping
+ * multiple blocks to every unit like \ref SFCTilePattern, which are not
+ * supported by \ref HaloMatrixWrapper.
+ *
+ * A unit declares the global indices of all elements it needs to read (its
+ * ghost elements). On construction a communication schedule is built: the
+ * ghost indices are grouped by their owning unit and consecutive elements
+ * are merged into segments that are fetched with a single non-blocking get.
+ * The schedule is reused by every \ref update.
+ *
+ * The ghost values are stored in a separate buffer in the order of the given
+ * ghost indices (\ref ghosts). For 1D domain decompositions the constructor
+ * taking a halo width creates the ghost indices
+ * [lbegin - width, lbegin) followed by [lend, lend + width).
+ * The constructor taking a \ref HaloSpec creates the ghost indices of the
+ * halo regions of every local block, for nearest-neighbour stencils on
+ * multi-dimensional containers.
+ *
+ * Like the \ref HaloMatrixWrapper, updates synchronize neighbours only, so
+ * no global barrier is needed: owners signal their readers that their
+ * elements are ready to be read, and readers signal their owners once the
+ * elements have been fetched. Signals are counted, so an owner may signal
+ * again before a reader consumed the previous signal. \ref wait returns
+ * after all ghost elements of the unit have been fetched and all readers
+ * have fetched the elements of the unit, which may then be modified.
+ * This also holds for asymmetric ghost lists, where a unit reads from
+ * units that do not read from it. All units of the team have to call
+ * \ref update or \ref update_async and \ref wait equally often.
+ *
+ * The construction is collective for all units of the array's team.
+ *
+ * Example for a 1D Jacobi step reading from array \c src:
+ *
+ *     GhostExchange<Array_t> ghosts(src, 1);
+ *     ghosts.update_async();
+ *     // ... update inner elements
+ *     ghosts.wait();
+ *     auto left  = ghosts.ghosts()[0];
+ *     auto right = ghosts.ghosts()[1];
+ *
+ * Example for a 2D 5-point stencil on a matrix with tiles along a Hilbert
+ * curve:
+ *
+ *     using StencilP_t = StencilPoint<2>;
+ *     StencilSpec<StencilP_t, 4> stencil_spec(
+ *       StencilP_t(-1, 0), StencilP_t(1, 0),
+ *       StencilP_t(0, -1), StencilP_t(0, 1));
+ *     GhostExchange<Matrix_t> ghosts(matrix, HaloSpec<2>(stencil_spec));
+ *     ghosts.update();
+ *     // value above the local element at global coordinates (i, j):
+ *     auto up = *ghosts.ghost_at({{ i - 1, j }});
+ */
+template <typename ArrayT>
+class GhostExchange {
+private:
+  using Self_t  = GhostExchange<ArrayT>;
+  using signal_t         = int;
+  using SignalBuffer_t   = dash::Array<dash::Atomic<signal_t>>;
+  using SignalRef_t      = dash::GlobRef<dash::Atomic<signal_t>>;
+
+  /*
+   * Contiguous elements of one owner that are fetched with a single get
+   */
+  struct Segment {
+    dart_gptr_t gptr;
+    size_t      ghost_pos;
+    size_t      num_elems;
+  };
+
+  /*
+   * All segments of one owner, the local slot counting its ready signals
+   * and the slot at the owner counting the completed reads of this unit
+   */
+  struct OwnerSchedule {
+    team_unit_t          unit;
+    dart_gptr_t          ready_gptr;
+    dart_gptr_t          done_gptr;
+    std::vector<Segment> segments;
+  };
+
+public:
+  using Array_t    = ArrayT;
+  using Element_t  = typename ArrayT::value_type;
+  using Pattern_t  = typename ArrayT::pattern_type;
+  using index_type = typename ArrayT::index_type;
+  using size_type  = typename ArrayT::size_type;
+
+  static constexpr dim_t NumDimensions = Pattern_t::ndim();
+
+  using Coords_t        = std::array<index_type, NumDimensions>;
+  using HaloSpec_t      = HaloSpec<NumDimensions>;
+  using GlobBndSpec_t   = GlobalBoundarySpec<NumDimensions>;
+
+public:
+  /**
+   * Constructor for an explicit list of global ghost indices. Duplicate
+   * indices are allowed, indices of local elements are fetched as well.
+   */
+  GhostExchange(ArrayT& array, const std::vector<index_type>& ghost_indices)
+  : _array(array),
+    _ghost_indices(ghost_indices),
+    _ghosts(ghost_indices.size()),
+    _ready_buffer(array.team().size() * array.team().size(), array.team()),
+    _done_buffer(array.team().size() * array.team().size(), array.team()) {
+    init_schedule();
+  }
+
+  /**
+   * Constructor for a 1D domain decomposition with \c halo_width ghost
+   * elements on both sides of the local block. With \ref BoundaryProp::NONE
+   * ghost elements beyond the global borders are omitted, with
+   * \ref BoundaryProp::CYCLIC the array is treated as periodic.
+   */
+  GhostExchange(ArrayT& array, size_type halo_width,
+                BoundaryProp boundary_prop = BoundaryProp::NONE)
+  : _array(array),
+    _ghost_indices(halo_indices(array, halo_width, boundary_prop)),
+    _ghosts(_ghost_indices.size()),
+    _ready_buffer(array.team().size() * array.team().size(), array.team()),
+    _done_buffer(array.team().size() * array.team().size(), array.team()) {
+    init_schedule();
+  }
+
+  /**
+   * Constructor for the halo regions of all local blocks specified by
+   * \c halo_spec. Ghost elements are ordered by local block, region index
+   * and by coordinates within the region in row-major order. Elements
+   * beyond the global borders are omitted for \ref BoundaryProp::NONE and
+   * wrapped around for \ref BoundaryProp::CYCLIC.
+   */
+  GhostExchange(ArrayT& array, const HaloSpec_t& halo_spec,
+                const GlobBndSpec_t& bnd_spec = GlobBndSpec_t())
+  : _array(array),
+    _ghost_indices(halo_region_indices(array, halo_spec, bnd_spec)),
+    _ghosts(_ghost_indices.size()),
+    _ready_buffer(array.team().size() * array.team().size(), array.team()),
+    _done_buffer(array.team().size() * array.team().size(), array.team()) {
+    init_schedule();
+  }
+
+  GhostExchange(const Self_t& other) = delete;
+  Self_t& operator=(const Self_t& other) = delete;
+
+  /**
+   * Fetches all ghost elements and blocks until they are available.
+   */
+  void update() {
+    update_async();
+    wait();
+  }
+
+  /**
+   * Initiates an asynchronous update of all ghost elements. \ref wait has to
+   * be called before the ghost elements are read.
+   */
+  void update_async() {
+    prepare_update();
+    for(auto& owner : _schedule) {
+      wait_signal(owner);
+      for(const auto& segment : owner.segments) {
+        dart_handle_t handle;
+        dash::internal::get_handle(segment.gptr,
+                                   _ghosts.data() + segment.ghost_pos,
+                                   segment.num_elems, &handle);
+        _get_handles.push_back(handle);
+      }
+    }
+  }
+
+  /**
+   * Waits until all ghost elements of an asynchronous update are available
+   * and all readers have fetched the local elements of this unit.
+   */
+  void wait() {
+    dart_waitall_local(_get_handles.data(), _get_handles.size());
+    _get_handles.clear();
+    signal_done();
+    wait_readers();
+  }
+
+  /**
+   * Returns the ghost values in the order of \ref ghost_indices.
+   */
+  const std::vector<Element_t>& ghosts() const { return _ghosts; }
+
+  /**
+   * Returns the global indices of all ghost elements.
+   */
+  const std::vector<index_type>& ghost_indices() const {
+    return _ghost_indices;
+  }
+
+  /**
+   * Returns a pointer to the ghost value for a given global index or
+   * nullptr if the index is no ghost index of this unit.
+   */
+  const Element_t* ghost_at(index_type global_index) const {
+    auto it = std::lower_bound(
+      _ghost_lookup.begin(), _ghost_lookup.end(),
+      std::make_pair(global_index, size_t(0)));
+    if(it == _ghost_lookup.end() || it->first != global_index) {
+      return nullptr;
+    }
+
+    return _ghosts.data() + it->second;
+  }
+
+  /**
+   * Returns a pointer to the ghost value for given global coordinates or
+   * nullptr if the coordinates are no ghost element of this unit.
+   */
+  const Element_t* ghost_at(const Coords_t& global_coords) const {
+    return ghost_at(_array.pattern().global_at(global_coords));
+  }
+
+  /**
+   * Returns the number of segments fetched by an update, i.e. the number of
+   * non-blocking gets.
+   */
+  size_type num_segments() const {
+    size_type num = 0;
+    for(const auto& owner : _schedule) {
+      num += owner.segments.size();
+    }
+
+    return num;
+  }
+
+  /**
+   * Returns the number of units the ghost elements are fetched from.
+   */
+  size_type num_owners() const { return _schedule.size(); }
+
+  /**
+   * Returns the container the ghost elements are fetched from.
+   */
+  ArrayT& array() { return _array; }
+
+  /**
+   * Returns the container the ghost elements are fetched from.
+   */
+  const ArrayT& array() const { return _array; }
+
+private:
+  static std::vector<index_type> halo_indices(const ArrayT& array,
+                                              size_type halo_width,
+                                              BoundaryProp boundary_prop) {
+    static_assert(NumDimensions == 1,
+                  "Halo width constructor requires a one-dimensional "
+                  "container, use a HaloSpec otherwise");
+    DASH_ASSERT_MSG(boundary_prop != BoundaryProp::CUSTOM,
+                    "Custom boundaries are not supported for ghost elements");
+
+    std::vector<index_type> indices;
+    const auto& pattern = array.pattern();
+    const index_type size   = pattern.size();
+    const index_type lsize  = pattern.local_size();
+    if(lsize == 0 || size == 0) {
+      return indices;
+    }
+
+    const index_type lbegin = pattern.global(0);
+    const index_type lend   = lbegin + lsize;
+    const index_type width  = halo_width;
+
+    indices.reserve(2 * halo_width);
+    auto add_index = [&](index_type index) {
+      if(index >= 0 && index < size) {
+        indices.push_back(index);
+      } else if(boundary_prop == BoundaryProp::CYCLIC) {
+        indices.push_back(((index % size) + size) % size);
+      }
+    };
+    for(index_type i = lbegin - width; i < lbegin; ++i) {
+      add_index(i);
+    }
+    for(index_type i = lend; i < lend + width; ++i) {
+      add_index(i);
+    }
+
+    return indices;
+  }
+
+  static std::vector<index_type> halo_region_indices(
+    const ArrayT& array, const HaloSpec_t& halo_spec,
+    const GlobBndSpec_t& bnd_spec) {
+    std::vector<index_type> indices;
+    const auto& pattern = array.pattern();
+    const auto  nblocks = pattern.local_blockspec().size();
+    for(size_type lb = 0; lb < nblocks; ++lb) {
+      const auto block = pattern.local_block(static_cast<index_type>(lb));
+      if(block.size() == 0) {
+        continue;
+      }
+      for(const auto& spec : halo_spec.specs()) {
+        const index_type halo_extent = spec.extent();
+        if(halo_extent == 0) {
+          continue;
+        }
+        // region relative to the block: 0 before, 1 within, 2 after
+        Coords_t reg_begin;
+        Coords_t reg_end;
+        for(dim_t d = 0; d < NumDimensions; ++d) {
+          const index_type offset = block.offset(d);
+          const index_type extent = block.extent(d);
+          if(spec[d] < 1) {
+            reg_begin[d] = offset - halo_extent;
+            reg_end[d]   = offset;
+          } else if(spec[d] == 1) {
+            reg_begin[d] = offset;
+            reg_end[d]   = offset + extent;
+          } else {
+            reg_begin[d] = offset + extent;
+            reg_end[d]   = offset + extent + halo_extent;
+          }
+        }
+        add_region_indices(pattern, bnd_spec, reg_begin, reg_end, indices);
+      }
+    }
+
+    return indices;
+  }
+
+  static void add_region_indices(const Pattern_t& pattern,
+                                 const GlobBndSpec_t& bnd_spec,
+                                 const Coords_t& reg_begin,
+                                 const Coords_t& reg_end,
+                                 std::vector<index_type>& indices) {
+    auto coords = reg_begin;
+    while(true) {
+      Coords_t g_coords;
+      bool     valid = true;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        const index_type extent = pattern.extent(d);
+        g_coords[d] = coords[d];
+        if(coords[d] >= 0 && coords[d] < extent) {
+          continue;
+        }
+        DASH_ASSERT_MSG(bnd_spec[d] != BoundaryProp::CUSTOM,
+                        "Custom boundaries are not supported for ghost "
+                        "elements");
+        if(bnd_spec[d] == BoundaryProp::NONE) {
+          valid = false;
+          break;
+        }
+        g_coords[d] = ((coords[d] % extent) + extent) % extent;
+      }
+      if(valid) {
+        indices.push_back(pattern.global_at(g_coords));
+      }
+
+      // next coordinates in row-major order
+      dim_t d = NumDimensions - 1;
+      while(d >= 0 && ++coords[d] == reg_end[d]) {
+        coords[d] = reg_begin[d];
+        --d;
+      }
+      if(d < 0) {
+        break;
+      }
+    }
+  }
+
+  void init_schedule() {
+    auto&       team    = _array.team();
+    const auto& pattern = _array.pattern();
+    const auto  nunits  = team.size();
+    const auto  myid    = team.myid().id;
+
+    _ghost_lookup.reserve(_ghost_indices.size());
+    for(size_t pos = 0; pos < _ghost_indices.size(); ++pos) {
+      _ghost_lookup.emplace_back(_ghost_indices[pos], pos);
+    }
+    std::sort(_ghost_lookup.begin(), _ghost_lookup.end());
+
+    // (owner, local index, ghost position) sorted by owner and ghost position
+    struct GhostInfo {
+      team_unit_t unit;
+      index_type  local_index;
+      size_t      ghost_pos;
+    };
+    std::vector<GhostInfo> infos;
+    infos.reserve(_ghost_indices.size());
+    for(size_t pos = 0; pos < _ghost_indices.size(); ++pos) {
+      DASH_ASSERT_RANGE(0, _ghost_indices[pos],
+                        static_cast<index_type>(pattern.size()) - 1,
+                        "Ghost index out of range");
+      auto local_pos = pattern.local(_ghost_indices[pos]);
+      infos.push_back({ local_pos.unit, local_pos.index, pos });
+    }
+    std::stable_sort(infos.begin(), infos.end(),
+                     [](const GhostInfo& lhs, const GhostInfo& rhs) {
+                       return lhs.unit < rhs.unit;
+                     });
+
+    auto ready_begin  = _ready_buffer.begin();
+    auto done_begin   = _done_buffer.begin();
+    auto array_begin  = _array.begin();
+    for(size_t i = 0; i < infos.size(); ++i) {
+      const auto& info = infos[i];
+      if(_schedule.empty() || _schedule.back().unit != info.unit) {
+        OwnerSchedule owner;
+        owner.unit        = info.unit;
+        owner.ready_gptr =
+          (ready_begin + (myid * nunits + info.unit.id)).dart_gptr();
+        owner.done_gptr  =
+          (done_begin + (info.unit.id * nunits + myid)).dart_gptr();
+        _schedule.push_back(std::move(owner));
+      }
+
+      auto& segments = _schedule.back().segments;
+      if(i > 0 && infos[i - 1].unit == info.unit &&
+         infos[i - 1].local_index + 1 == info.local_index &&
+         infos[i - 1].ghost_pos + 1 == info.ghost_pos) {
+        ++segments.back().num_elems;
+        continue;
+      }
+
+      auto gptr = (array_begin + _ghost_indices[info.ghost_pos]).dart_gptr();
+      segments.push_back(Segment{ gptr, info.ghost_pos, 1 });
+    }
+
+    init_signals();
+  }
+
+  /*
+   * Every unit has to know which units read its elements to signal them
+   * that the elements are ready. The readers register at their owners once.
+   */
+  void init_signals() {
+    auto&      team   = _array.team();
+    const auto nunits = team.size();
+    const auto myid   = team.myid().id;
+
+    const dash::Atomic<signal_t> zero(0);
+    std::fill(_ready_buffer.lbegin(), _ready_buffer.lend(), zero);
+    std::fill(_done_buffer.lbegin(), _done_buffer.lend(), zero);
+
+    SignalBuffer_t readers(nunits * nunits, team);
+    std::fill(readers.lbegin(), readers.lend(), zero);
+    readers.barrier();
+
+    for(const auto& owner : _schedule) {
+      if(owner.unit.id == myid) {
+        continue;
+      }
+      SignalRef_t(
+        (readers.begin() + (owner.unit.id * nunits + myid)).dart_gptr())
+        .add(1);
+    }
+    readers.barrier();
+
+    auto ready_begin = _ready_buffer.begin();
+    auto done_begin  = _done_buffer.begin();
+    for(size_t unit = 0; unit < nunits; ++unit) {
+      if(SignalRef_t(
+           (readers.begin() + (myid * nunits + unit)).dart_gptr()).get()
+         > 0) {
+        _reader_ready_gptrs.push_back(
+          (ready_begin + (unit * nunits + myid)).dart_gptr());
+        _reader_done_gptrs.push_back(
+          (done_begin + (myid * nunits + unit)).dart_gptr());
+      }
+    }
+
+    // no unit may signal before all signal buffers are initialized
+    readers.barrier();
+  }
+
+  // signals all readers that the local elements are ready to be read
+  void prepare_update() {
+    for(const auto& gptr : _reader_ready_gptrs) {
+      SignalRef_t(gptr).add(1);
+    }
+  }
+
+  // waits for and consumes one ready signal of the owner
+  void wait_signal(const OwnerSchedule& owner) {
+    if(owner.unit == _array.team().myid()) {
+      return;
+    }
+
+    consume_signal(owner.ready_gptr);
+  }
+
+  // signals all owners that their elements have been fetched
+  void signal_done() {
+    const auto myid = _array.team().myid();
+    for(const auto& owner : _schedule) {
+      if(owner.unit != myid) {
+        SignalRef_t(owner.done_gptr).add(1);
+      }
+    }
+  }
+
+  // waits until all readers have fetched the local elements
+  void wait_readers() {
+    for(const auto& gptr : _reader_done_gptrs) {
+      consume_signal(gptr);
+    }
+  }
+
+  static void consume_signal(dart_gptr_t gptr) {
+    SignalRef_t signal(gptr);
+    while(signal.get() == 0) { }
+    signal.sub(1);
+  }
+
+private:
+  ArrayT&                                     _array;
+  std::vector<index_type>                     _ghost_indices;
+  std::vector<Element_t>                      _ghosts;
+  std::vector<std::pair<index_type, size_t>>  _ghost_lookup;
+  std::vector<OwnerSchedule>                  _schedule;
+  // ready signals, slots of all owners at every reader
+  SignalBuffer_t                              _ready_buffer;
+  // completed reads, slots of all readers at every owner
+  SignalBuffer_t                              _done_buffer;
+  std::vector<dart_gptr_t>                    _reader_ready_gptrs;
+  std::vector<dart_gptr_t>                    _reader_done_gptrs;
+  std::vector<dart_handle_t>                  _get_handles;
+};  // class GhostExchange
+
+}  // namespace halo
+
+}  // namespace dash
+
+#endif  // DASH__HALO__GHOSTEXCHANGE_H__
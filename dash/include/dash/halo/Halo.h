@@ -2,7 +2,7 @@
 #define DASH__HALO__HALO_H__
 
 #include <dash/internal/Logging.h>
-
+#include <dash/pattern/PatternProperties.h>
 
 #include <dash/halo/Types.h>
 #include <dash/halo/Region.h>
@@ -112,7 +112,9 @@ public:
     }
   }
 
-  HaloSpec(const Self_t& other) { _specs = other._specs; }
+  HaloSpec(const Self_t& other)
+  : _specs(other._specs), _halo_extents_max(other._halo_extents_max),
+    _num_regions(other._num_regions) {}
 
   static constexpr dim_t ndim() { return NumDimensions; }
 
@@ -255,6 +257,39 @@ std::ostream& operator<<(std::ostream& os, const HaloSpec<NumDimensions>& hs) {
   return os;
 }
 
+/**
+ * Returns a \ref HaloSpec with halo regions wide enough to apply the given
+ * \ref StencilSpec \c num_steps times after a single halo update
+ * (temporal blocking, see \ref TemporalStencilOperator).
+ *
+ * The halo width of every side is \c num_steps times the stencil radius of
+ * this side. Corner and edge regions cover the complete box spanned by the
+ * adjacent sides, as the dependencies of repeated stencil applications
+ * spread diagonally.
+ */
+template <typename StencilSpecT>
+HaloSpec<StencilSpecT::StencilPoint_t::ndim()> temporal_halo_spec(
+  const StencilSpecT& stencil_spec, int num_steps) {
+  using StencilPoint_t = typename StencilSpecT::StencilPoint_t;
+
+  static constexpr auto NumDimensions = StencilPoint_t::ndim();
+  static constexpr std::size_t NumCorners = 1 << NumDimensions;
+
+  DASH_ASSERT_MSG(num_steps > 0, "Number of steps must be greater than 0");
+
+  auto minmax = stencil_spec.minmax_distances();
+  std::array<StencilPoint_t, NumCorners> corners;
+  for(std::size_t c = 0; c < NumCorners; ++c) {
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      auto dist = ((c >> d) & 1) ? minmax[d].second : minmax[d].first;
+      corners[c][d] = static_cast<spoint_value_t>(num_steps * dist);
+    }
+  }
+
+  return HaloSpec<NumDimensions>(
+    StencilSpec<StencilPoint_t, NumCorners>(corners));
+}
+
 template<typename ViewSpecT>
 class BoundaryRegionCheck {
   static constexpr auto NumDimensions = ViewSpecT::ndim();
@@ -403,8 +438,10 @@ public:
 
     for(dim_t d = 0; d < NumDimensions; ++d) {
 
+      // regions partition the boundary ring, whose width is the maximal
+      // distance independent of the region extent
       if(coords[d] < 1) {
-        extents[d] = (region.extent() == 0) ? _max_dist[d].first : region.extent();
+        extents[d] = _max_dist[d].first;
         continue;
       }
 
@@ -423,7 +460,7 @@ public:
       }
 
       offsets[d] = extents[d] - _max_dist[d].second;
-      extents[d] = (region.extent() == 0) ? _max_dist[d].second : region.extent();
+      extents[d] = _max_dist[d].second;
     }
 
     region_data.valid = true;
@@ -467,7 +504,7 @@ public:
          continue;
       }
 
-      offsets[d] = extents[d] - _max_dist[d].second;
+      offsets[d] += extents[d] - region.extent();
       extents[d] = region.extent();
     }
 
@@ -822,9 +859,17 @@ std::ostream& operator<<(
 /**
  * Takes the local part of the NArray and builds halo and
  * boundary regions.
+ *
+ * Halo regions of patterns mapping multiple blocks to every unit are
+ * exchanged by \ref GhostExchange.
  */
 template <typename ElementT, typename PatternT, typename GlobMemT>
 class HaloBlock {
+  static_assert(!pattern_mapping_traits<PatternT>::type::multiple,
+                "HaloBlock requires patterns mapping a single rectangular "
+                "block to every unit, use GhostExchange for patterns "
+                "mapping multiple blocks");
+
 private:
   static constexpr auto NumDimensions = PatternT::ndim();
   static constexpr auto RegionsMax = NumRegionsMax<NumDimensions>;
@@ -0,0 +1,425 @@
+#ifndef DASH__HALO_HALOMATRIXGROUP_H
+#define DASH__HALO_HALOMATRIXGROUP_H
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/Pattern.h>
+#include <dash/halo/CoordinateAccess.h>
+#include <dash/halo/HaloMemory.h>
+#include <dash/halo/StencilOperator.h>
+#include <dash/halo/Types.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace dash {
+
+namespace halo {
+
+/**
+ * Halo environment for multiple matrices (fields) with identical pattern
+ * and stencil, e.g. the fields of a CFD simulation.
+ *
+ * In contrast to one \ref HaloMatrixWrapper per field, the boundary
+ * elements of all fields sent to the same neighbor are packed into one
+ * contiguous segment of a shared pack buffer. Every halo region is thus
+ * updated with a single request and a single signal per update,
+ * independent of the number of fields. Received elements are unpacked into
+ * the \ref HaloMemory of each field.
+ *
+ * Example:
+ *
+ * \code
+ *   HaloMatrixGroup<Matrix_t> halo_group(stencil_spec, m_u, m_v, m_p);
+ *   auto op_u = halo_group.stencil_operator(0, stencil_spec);
+ *   halo_group.update_async();
+ *   // ... inner updates of all fields
+ *   halo_group.wait();
+ *   // ... boundary updates of all fields
+ * \endcode
+ */
+template <typename MatrixT, SignalReady SigReady = SignalReady::OFF>
+class HaloMatrixGroup {
+private:
+  using Pattern_t       = typename MatrixT::pattern_type;
+  using pattern_index_t = typename Pattern_t::index_type;
+  using pattern_size_t  = typename Pattern_t::size_type;
+
+  static constexpr auto NumDimensions = Pattern_t::ndim();
+  static constexpr auto RegionsMax    = NumRegionsMax<NumDimensions>;
+
+  using GlobMem_t = typename MatrixT::GlobMem_t;
+
+public:
+  using Element_t = typename MatrixT::value_type;
+
+  using ViewSpec_t      = ViewSpec<NumDimensions, pattern_index_t>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<NumDimensions>;
+  using HaloBlock_t     = HaloBlock<Element_t, Pattern_t, GlobMem_t>;
+  using HaloMemory_t    = HaloMemory<HaloBlock_t>;
+  using region_index_t  = internal::region_index_t;
+
+private:
+  using HaloSpec_t    = HaloSpec<NumDimensions>;
+  using SignalEnv_t   = SignalEnv<HaloBlock_t>;
+  using PackEnv_t     = PackEnv<HaloBlock_t>;
+  using PackMData_t   = typename PackEnv_t::PackMData_t;
+  using HaloBuffer_t  = dash::Array<Element_t>;
+  using RecvBuffer_t  = std::vector<Element_t>;
+  using SlotOffs_t    = std::array<pattern_size_t, RegionsMax>;
+
+  struct Field {
+    Field(MatrixT& mat, const ViewSpec_t& view_global,
+          const HaloSpec_t& halo_spec, const GlobBoundSpec_t& glob_bnd_spec)
+    : matrix(mat),
+      halo_block(mat.begin().globmem(), mat.pattern(), view_global,
+                 halo_spec, glob_bnd_spec),
+      halo_memory(halo_block) {
+    }
+
+    MatrixT&                            matrix;
+    const HaloBlock_t                   halo_block;
+    HaloMemory_t                        halo_memory;
+    std::array<PackMData_t, RegionsMax> pack_md{};
+  };
+
+  using Fields_t = std::vector<std::unique_ptr<Field>>;
+
+  struct UpdateData {
+    dart_gptr_t   gptr{DART_GPTR_NULL};
+    // number of halo elements of the region per field
+    size_t        region_size{0};
+    Element_t*    recv_pos{nullptr};
+    dart_handle_t handle{DART_HANDLE_NULL};
+    bool          pending{false};
+  };
+
+public:
+  /**
+   * Constructor that takes the matrices of all fields, a
+   * \ref GlobalBoundarySpec and a stencil specification (\ref StencilSpec).
+   * All matrices have to use the same pattern.
+   */
+  template <typename StencilPointT, std::size_t NumStencilPoints>
+  HaloMatrixGroup(
+    const std::vector<MatrixT*>&                         matrices,
+    const GlobBoundSpec_t&                               glob_bnd_spec,
+    const StencilSpec<StencilPointT, NumStencilPoints>& stencil_spec)
+  : _glob_bnd_spec(glob_bnd_spec),
+    _halo_spec(stencil_spec),
+    _view_global(matrices.front()->local.offsets(),
+                 matrices.front()->local.extents()),
+    _fields(make_fields(matrices)),
+    _signal_env(_fields.front()->halo_block, matrices.front()->team()) {
+    init_pack_data(matrices.front()->team());
+    init_update_data();
+  }
+
+  /**
+   * Constructor that takes a \ref GlobalBoundarySpec, a stencil
+   * specification (\ref StencilSpec) and the matrices of all fields.
+   */
+  template <typename StencilSpecT, typename... MatrixRestT>
+  HaloMatrixGroup(const GlobBoundSpec_t& glob_bnd_spec,
+                  const StencilSpecT&    stencil_spec,
+                  MatrixT&               matrix_first,
+                  MatrixRestT&...        matrix_rest)
+  : HaloMatrixGroup(std::vector<MatrixT*>{ &matrix_first, &matrix_rest... },
+                    glob_bnd_spec, stencil_spec) {
+  }
+
+  /**
+   * Constructor that takes a stencil specification (\ref StencilSpec) and
+   * the matrices of all fields.
+   * The \ref GlobalBoundarySpec is set to default.
+   */
+  template <typename StencilSpecT, typename... MatrixRestT>
+  HaloMatrixGroup(const StencilSpecT& stencil_spec,
+                  MatrixT&            matrix_first,
+                  MatrixRestT&...     matrix_rest)
+  : HaloMatrixGroup(std::vector<MatrixT*>{ &matrix_first, &matrix_rest... },
+                    GlobBoundSpec_t(), stencil_spec) {
+  }
+
+  HaloMatrixGroup() = delete;
+
+  HaloMatrixGroup(const HaloMatrixGroup& other) = delete;
+
+  HaloMatrixGroup& operator=(const HaloMatrixGroup& other) = delete;
+
+  /**
+   * Number of fields in the group
+   */
+  size_t num_fields() const { return _fields.size(); }
+
+  /**
+   * Returns the matrix of the given field
+   */
+  MatrixT& matrix(size_t field) { return _fields[field]->matrix; }
+
+  /**
+   * Returns the matrix of the given field
+   */
+  const MatrixT& matrix(size_t field) const { return _fields[field]->matrix; }
+
+  /**
+   * Returns the \ref HaloBlock of the given field
+   */
+  const HaloBlock_t& halo_block(size_t field) const {
+    return _fields[field]->halo_block;
+  }
+
+  /**
+   * Returns the halo memory management object \ref HaloMemory of the given
+   * field
+   */
+  HaloMemory_t& halo_memory(size_t field) {
+    return _fields[field]->halo_memory;
+  }
+
+  /**
+   * Returns the halo memory management object \ref HaloMemory of the given
+   * field
+   */
+  const HaloMemory_t& halo_memory(size_t field) const {
+    return _fields[field]->halo_memory;
+  }
+
+  /**
+   * Returns the local \ref ViewSpec
+   */
+  const ViewSpec_t& view_local() const {
+    return _fields.front()->halo_block.view_local();
+  }
+
+  /**
+   * Initiates a blocking halo region update for all halo elements of all
+   * fields.
+   */
+  void update() {
+    update_async();
+    wait();
+  }
+
+  /**
+   * Initiates an asychronous halo region update for all halo elements of
+   * all fields.
+   */
+  void update_async() {
+    prepare_update();
+    for(auto& data : _region_data) {
+      _signal_env.wait_signal(data.first);
+      auto& update_data = data.second;
+      if(update_data.region_size == 0) {
+        continue;
+      }
+      dash::internal::get_handle(update_data.gptr, update_data.recv_pos,
+                                 update_data.region_size * _fields.size(),
+                                 &update_data.handle);
+      update_data.pending = true;
+    }
+  }
+
+  /**
+   * Waits until all halo updates are finished and unpacks the halo elements
+   * into the halo memory of all fields. Only useful for asynchronous halo
+   * updates.
+   */
+  void wait() {
+    for(auto& data : _region_data) {
+      auto& update_data = data.second;
+      if(update_data.pending) {
+        dart_wait_local(&update_data.handle);
+        unpack(data.first, update_data);
+        update_data.pending = false;
+      }
+      if(SigReady == SignalReady::ON) {
+        _signal_env.put_ready_signal_async(data.first);
+      }
+    }
+    if(SigReady == SignalReady::ON) {
+      _signal_env.wait_put_ready_signals();
+    }
+  }
+
+  /**
+   * Creates \ref StencilOperator for the given field and \ref StencilSpec.
+   * Asserts whether the StencilSpec fits in the provided halo regions.
+   */
+  template <typename StencilSpecT>
+  StencilOperator<HaloBlock_t, StencilSpecT> stencil_operator(
+    size_t field, const StencilSpecT& stencil_spec) {
+    for(const auto& stencil : stencil_spec.specs()) {
+      DASH_ASSERT_MSG(
+        stencil.max()
+          <= _halo_spec.extent(RegionSpec<NumDimensions>::index(stencil)),
+        "Stencil point extent higher than halo region extent.");
+    }
+
+    auto& fld = *_fields[field];
+    return StencilOperator<HaloBlock_t, StencilSpecT>(
+      &fld.halo_block, fld.matrix.lbegin(), &fld.halo_memory, stencil_spec);
+  }
+
+  /**
+   * Creates \ref CoordinateAccess for the given field.
+   */
+  CoordinateAccess<HaloBlock_t> coordinate_access(size_t field) {
+    auto& fld = *_fields[field];
+    return CoordinateAccess<HaloBlock_t>(
+      &fld.halo_block, fld.matrix.lbegin(), &fld.halo_memory);
+  }
+
+private:
+  Fields_t make_fields(const std::vector<MatrixT*>& matrices) const {
+    DASH_ASSERT_MSG(!matrices.empty(), "HaloMatrixGroup without fields");
+
+    Fields_t fields;
+    fields.reserve(matrices.size());
+    for(auto* matrix : matrices) {
+      DASH_ASSERT_MSG(matrix->pattern() == matrices.front()->pattern(),
+                      "Fields of a HaloMatrixGroup differ in pattern");
+      fields.emplace_back(
+        new Field(*matrix, _view_global, _halo_spec, _glob_bnd_spec));
+    }
+
+    return fields;
+  }
+
+  /**
+   * The pack buffer consists of one segment per region, sized for the
+   * largest local block. Boundary elements of all fields sent for the same
+   * region are stored consecutively in its segment.
+   */
+  void init_pack_data(dash::Team& team) {
+    const auto& halo_block  = _fields.front()->halo_block;
+    const auto& env_info_md = halo_block.block_env();
+    const auto  num_fields  = _fields.size();
+
+    team_unit_t rank_0(0);
+    auto max_local_extents = halo_block.pattern().local_extents(rank_0);
+
+    pattern_size_t num_pack_elems = 0;
+    for(region_index_t r = 0; r < RegionsMax; ++r) {
+      const auto& region_spec = _halo_spec.spec(r);
+      if(region_spec.extent() == 0) {
+        continue;
+      }
+
+      pattern_size_t reg_size = 1;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        if(region_spec[d] != 1) {
+          reg_size *= region_spec.extent();
+        } else {
+          reg_size *= max_local_extents[d];
+        }
+      }
+      _slot_offs[r]   = num_pack_elems;
+      num_pack_elems += reg_size * num_fields;
+    }
+    _pack_buffer.allocate(num_pack_elems * team.size(), team);
+
+    for(region_index_t r = 0; r < RegionsMax; ++r) {
+      if(env_info_md.info(r).neighbor_id_to < 0) {
+        continue;
+      }
+
+      auto* buffer_pos = _pack_buffer.lbegin() + _slot_offs[r];
+      for(auto& field : _fields) {
+        auto& pack_md = field->pack_md[r];
+        PackEnv_t::init_pack_positions(
+          field->halo_block, field->matrix.lbegin(), r, pack_md);
+        pack_md.needs_packing = true;
+        pack_md.buffer_pos    = buffer_pos;
+        buffer_pos += pack_md.block_pos.size() * pack_md.block_len;
+      }
+    }
+  }
+
+  void init_update_data() {
+    const auto& halo_block = _fields.front()->halo_block;
+    const auto  num_fields = _fields.size();
+
+    size_t recv_size = 0;
+    for(const auto& region : halo_block.halo_regions()) {
+      if(!region.is_custom_region()) {
+        recv_size += region.size() * num_fields;
+      }
+    }
+    _recv_buffer.resize(recv_size);
+
+    auto* recv_pos = _recv_buffer.data();
+    for(const auto& region : halo_block.halo_regions()) {
+      size_t region_size = region.size();
+      if(region_size == 0) {
+        continue;
+      }
+
+      UpdateData data;
+      // Custom halo regions are not updated, but their signals are
+      // consumed.
+      if(!region.is_custom_region()) {
+        data.gptr        = _pack_buffer.begin().dart_gptr();
+        data.gptr.unitid = region.begin().dart_gptr().unitid;
+        data.gptr.addr_or_offs.offset =
+          _slot_offs[region.index()] * sizeof(Element_t);
+        data.region_size = region_size;
+        data.recv_pos    = recv_pos;
+        recv_pos        += region_size * num_fields;
+      }
+      _region_data.insert(std::make_pair(region.index(), data));
+    }
+  }
+
+  // prepares the halo elements of all fields for update -> packing and
+  // sending signals to all relevant neighbors
+  void prepare_update() {
+    for(region_index_t r = 0; r < RegionsMax; ++r) {
+      if(SigReady == SignalReady::ON) {
+        _signal_env.ready_to_update(r);
+      }
+      for(auto& field : _fields) {
+        const auto& pack_md = field->pack_md[r];
+        if(!pack_md.needs_packing) {
+          continue;
+        }
+        auto* buffer_pos = pack_md.buffer_pos;
+        for(auto* pos : pack_md.block_pos) {
+          buffer_pos = std::copy(pos, pos + pack_md.block_len, buffer_pos);
+        }
+      }
+      _signal_env.put_signal_async(r);
+    }
+    _signal_env.wait_put_signals();
+  }
+
+  void unpack(region_index_t region_index, const UpdateData& data) {
+    const Element_t* recv_pos = data.recv_pos;
+    for(auto& field : _fields) {
+      std::copy(recv_pos, recv_pos + data.region_size,
+                field->halo_memory.first_element_at(region_index));
+      recv_pos += data.region_size;
+    }
+  }
+
+private:
+  const GlobBoundSpec_t                 _glob_bnd_spec;
+  const HaloSpec_t                      _halo_spec;
+  const ViewSpec_t                      _view_global;
+  Fields_t                              _fields;
+  SignalEnv_t                           _signal_env;
+  HaloBuffer_t                          _pack_buffer;
+  SlotOffs_t                            _slot_offs{};
+  RecvBuffer_t                          _recv_buffer;
+  std::map<region_index_t, UpdateData>  _region_data;
+};
+
+}  // namespace halo
+
+}  // namespace dash
+
+#endif  // DASH__HALO_HALOMATRIXGROUP_H
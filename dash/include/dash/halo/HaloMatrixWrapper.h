@@ -28,6 +28,10 @@ namespace halo {
  * and extends these by boundary and halo regions. The HaloMatrixWrapper also
  * provides a function to create a \ref StencilOperator.
  *
+ * With \c SharedHalos::ON, halo elements of neighbors in the same shared
+ * memory domain are read in place instead of being copied, see
+ * \ref HaloUpdateEnv.
+ *
  * Example for an outer block boundary iteration space (halo regions):
  *
  *            .--halo region 0   .-- halo region 1
@@ -49,7 +53,8 @@ namespace halo {
  *     halo region 3             '- halo region 7
  */
 
-template <typename MatrixT, SignalReady SigReady = SignalReady::OFF>
+template <typename MatrixT, SignalReady SigReady = SignalReady::OFF,
+          SharedHalos ShHalos = SharedHalos::OFF>
 class HaloMatrixWrapper {
 private:
   using Pattern_t       = typename MatrixT::pattern_type;
@@ -63,9 +68,10 @@ public:
 
   using ViewSpec_t      = ViewSpec<NumDimensions, pattern_index_t>;
   using GlobBoundSpec_t = GlobalBoundarySpec<NumDimensions>;
+  using HaloSpec_t      = HaloSpec<NumDimensions>;
   using HaloBlock_t     = HaloBlock<Element_t, Pattern_t, GlobMem_t>;
   using HaloMemory_t    = HaloMemory<HaloBlock_t>;
-  using HaloUpdateEnv_t = HaloUpdateEnv<HaloBlock_t, SigReady>;
+  using HaloUpdateEnv_t = HaloUpdateEnv<HaloBlock_t, SigReady, ShHalos>;
   using ElementCoords_t = std::array<pattern_index_t, NumDimensions>;
   using region_index_t  = internal::region_index_t;
   using stencil_dist_t  = internal::spoint_value_t;
@@ -75,7 +81,6 @@ private:
 
   using pattern_size_t        = typename Pattern_t::size_type;
   using signed_pattern_size_t = typename std::make_signed<pattern_size_t>::type;
-  using HaloSpec_t            = HaloSpec<NumDimensions>;
   using Region_t              = Region<Element_t, Pattern_t, typename MatrixT::GlobMem_t>;
 
 public:
@@ -97,6 +102,22 @@ public:
     _halo_env(_haloblock, matrix.lbegin(), matrix.team(), matrix.pattern().teamspec()) {
   }
 
+  /**
+   * Constructor that takes \ref Matrix, a \ref GlobalBoundarySpec and a
+   * \ref HaloSpec, e.g. a halo specification for temporal blocking created
+   * by \ref temporal_halo_spec.
+   */
+  HaloMatrixWrapper(MatrixT& matrix, const GlobBoundSpec_t& glob_bnd_spec,
+                    const HaloSpec_t& halo_spec)
+  : _matrix(matrix), _glob_bnd_spec(glob_bnd_spec),
+    _halo_spec(halo_spec),
+    _view_global(matrix.local.offsets(), matrix.local.extents()),
+    _haloblock(matrix.begin().globmem(), matrix.pattern(), _view_global,
+               _halo_spec, glob_bnd_spec),
+    _view_local(_haloblock.view_local()),
+    _halo_env(_haloblock, matrix.lbegin(), matrix.team(), matrix.pattern().teamspec()) {
+  }
+
   /**
    * Constructor that takes \ref Matrix and a stencil point distance
    * to create a \ref HaloMatrixWrapper with a full stencil with the
@@ -317,6 +338,20 @@ public:
       &_haloblock, _matrix.lbegin(), &_halo_env.halo_memory(), stencil_spec);
   }
 
+  /**
+   * Creates a \ref TemporalStencilOperator for a given \ref StencilSpec that
+   * applies the stencil \c num_steps times per halo update.
+   * Asserts whether the halo regions are wide enough for all steps, see
+   * \ref temporal_halo_spec.
+   */
+  template <typename StencilSpecT>
+  TemporalStencilOperator<HaloBlock_t, StencilSpecT> temporal_stencil_operator(
+    const StencilSpecT& stencil_spec, int num_steps) {
+    return TemporalStencilOperator<HaloBlock_t, StencilSpecT>(
+      &_haloblock, _matrix.lbegin(), &_halo_env.halo_memory(), stencil_spec,
+      num_steps);
+  }
+
   CoordinateAccess<HaloBlock_t> coordinate_access() {
     return CoordinateAccess<HaloBlock_t>(&_haloblock, _matrix.lbegin(),&_halo_env.halo_memory());
   }
@@ -15,6 +15,11 @@ using namespace internal;
 /**
  * Mangages the memory for all halo regions provided by the given
  * \ref HaloBlock
+ *
+ * Halo regions are stored consecutively in a local buffer. Alternatively,
+ * a halo region can be mapped to the memory of the neighbor unit owning
+ * its elements if that memory is directly accessible, see
+ * \c HaloMemory::share_region.
  */
 template <typename HaloBlockT>
 class HaloMemory {
@@ -34,9 +39,10 @@ public:
     std::array<typename Pattern_t::index_type, NumDimensions>;
   using HaloBuffer_t   = std::vector<Element_t>;
   using pattern_size_t = typename Pattern_t::size_type;
+  using Strides_t      = std::array<pattern_size_t, NumDimensions>;
 
-  using iterator       = typename HaloBuffer_t::iterator;
-  using const_iterator = const iterator;
+  using iterator       = Element_t*;
+  using const_iterator = const Element_t*;
 
   using MemRange_t = std::pair<iterator, iterator>;
 
@@ -46,14 +52,40 @@ public:
    */
   HaloMemory(const HaloBlockT& haloblock) : _haloblock(haloblock) {
     _halobuffer.resize(haloblock.halo_size());
-    auto it = _halobuffer.begin();
-    std::fill(_halo_offsets.begin(), _halo_offsets.end(), _halobuffer.end());
+    auto it = _halobuffer.data();
+    std::fill(_halo_offsets.begin(), _halo_offsets.end(), end());
     for(const auto& region : haloblock.halo_regions()) {
       _halo_offsets[region.index()] = it;
+      _strides[region.index()]      = strides(region.view().extents());
       it += region.size();
     }
   }
 
+  /**
+   * Maps the halo region with the given index to the memory of the unit
+   * owning its elements. Halo elements are then accessed in place, with
+   * strides given by the extents of the owner's local block.
+   *
+   * \param index          halo region index
+   * \param region_begin   address of the first element of the halo region
+   * \param block_extents  extents of the local block containing the
+   *                       halo region
+   */
+  template <typename ExtentsT>
+  void share_region(region_index_t   index,
+                    Element_t*       region_begin,
+                    const ExtentsT&  block_extents) {
+    _halo_offsets[index] = region_begin;
+    _strides[index]      = strides(block_extents);
+    _shared[index]       = true;
+  }
+
+  /**
+   * Returns true if the elements of the halo region with the given index
+   * are accessed in the memory of the unit owning them.
+   */
+  bool is_shared(region_index_t index) const { return _shared[index]; }
+
   /**
    * Iterator to the first halo element for the given region index
    * \param index halo region index
@@ -66,13 +98,15 @@ public:
 
   /**
    * Returns the range of all halo elements for the given region index.
+   * Elements of shared halo regions are not contiguous and have to be
+   * accessed with \c HaloMemory::offset.
    * \param index halo region index
    * \return Pair of iterator. First points ot the beginning and second to the
    *         end.
    */
   MemRange_t range_at(region_index_t index) {
     auto it = _halo_offsets[index];
-    if(it == _halobuffer.end())
+    if(it == end())
       return std::make_pair(it, it);
 
     auto* region = _haloblock.halo_region(index);
@@ -87,22 +121,24 @@ public:
   /**
    * Returns an iterator to the first halo element
    */
-  iterator begin() { return _halobuffer.begin(); }
+  iterator begin() { return _halobuffer.data(); }
 
   /**
    * Returns a const iterator to the first halo element
    */
-  const_iterator begin() const { return _halobuffer.begin(); }
+  const_iterator begin() const { return _halobuffer.data(); }
 
   /**
    * Returns an iterator to the end of the halo elements
    */
-  iterator end() { return _halobuffer.end(); }
+  iterator end() { return _halobuffer.data() + _halobuffer.size(); }
 
   /**
    * Returns a const iterator to the end of the halo elements
    */
-  const_iterator end() const { return _halobuffer.end(); }
+  const_iterator end() const {
+    return _halobuffer.data() + _halobuffer.size();
+  }
 
   /**
    * Container storing all halo elements
@@ -157,28 +193,37 @@ public:
    */
   pattern_size_t offset(const region_index_t   region_index,
                         const ElementCoords_t& coords) const {
-    const auto& extents =
-      _haloblock.halo_region(region_index)->view().extents();
+    const auto& strides = _strides[region_index];
     pattern_size_t off = 0;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      off += coords[d] * strides[d];
+
+    return off;
+  }
+
+private:
+  template <typename ExtentsT>
+  static Strides_t strides(const ExtentsT& extents) {
+    Strides_t strides;
     if(MemoryArrange == ROW_MAJOR) {
-      off = coords[0];
-      for(dim_t d = 1; d < NumDimensions; ++d)
-        off = off * extents[d] + coords[d];
+      strides[NumDimensions - 1] = 1;
+      for(dim_t d = NumDimensions - 1; d > 0; --d)
+        strides[d - 1] = strides[d] * extents[d];
     } else {
-      off = coords[NumDimensions - 1];
-      for(dim_t d = NumDimensions - 1; d > 0;) {
-        --d;
-        off = off * extents[d] + coords[d];
-      }
+      strides[0] = 1;
+      for(dim_t d = 1; d < NumDimensions; ++d)
+        strides[d] = strides[d - 1] * extents[d - 1];
     }
 
-    return off;
+    return strides;
   }
 
 private:
-  const HaloBlockT&              _haloblock;
-  HaloBuffer_t                   _halobuffer;
-  std::array<iterator, RegionsMax> _halo_offsets{};
+  const HaloBlockT&                  _haloblock;
+  HaloBuffer_t                       _halobuffer;
+  std::array<iterator, RegionsMax>   _halo_offsets{};
+  std::array<Strides_t, RegionsMax>  _strides{};
+  std::array<bool, RegionsMax>       _shared{};
 };  // class HaloMemory
 
 template<typename HaloBlockT>
@@ -390,15 +435,16 @@ class PackEnv {
   static constexpr auto ContiguousDim    =
     MemoryArrange == ROW_MAJOR ? 1 : NumDimensions;
 
+public:
+  using Team_t      = dash::Team;
+  using PackMData_t = PackMetaData<Element_t, upattern_size_t>;
+
+private:
   using HaloBuffer_t  = dash::Array<Element_t>;
   using HaloPosAll_t  = std::array<dart_gptr_t, RegionsMax>;
-  using PackMData_t   = PackMetaData<Element_t, upattern_size_t>;
   using PackMDataAll_t = std::array<PackMData_t, RegionsMax>;
   using PackOffs_t = std::array<pattern_size_t, RegionsMax>;
 
-public:
-  using Team_t = dash::Team;
-
 public:
   PackEnv(const HaloBlockT& halo_block, Element_t* local_memory, Team_t& team)
   : _local_memory(local_memory),
@@ -412,6 +458,24 @@ public:
     _pack_md_all[region].pack_func();
   }
 
+  /**
+   * Disables packing of the boundary elements for the given halo region,
+   * e.g. if the receiving neighbor accesses them in place.
+   */
+  void disable_packing(region_index_t region) {
+    auto& pack_md = _pack_md_all[region];
+    pack_md.needs_packing = false;
+    pack_md.pack_func     = [](){};
+  }
+
+  /**
+   * Returns true if the boundary elements for the given halo region are
+   * packed into the buffer before an update.
+   */
+  bool needs_packing(region_index_t region) const {
+    return _pack_md_all[region].needs_packing;
+  }
+
   dart_gptr_t halo_gptr(region_index_t region_index) {
     return _get_halos[region_index];
   }
@@ -420,6 +484,51 @@ public:
     return _get_halos[region_index];
   }
 
+  /**
+   * Sets length and local positions of the contiguous blocks of boundary
+   * elements that are sent to the neighbor in the direction opposite to the
+   * given halo region.
+   */
+  static void init_pack_positions(const HaloBlockT& halo_block,
+                                  Element_t*        local_memory,
+                                  region_index_t    region_index,
+                                  PackMData_t&      pack_md) {
+    using ViewSpec_t     = typename Pattern_t::viewspec_type;
+
+    const auto& env_md   = halo_block.block_env().info(region_index);
+    const auto& reg_spec = halo_block.halo_spec().spec(region_index);
+    auto region          = halo_block.halo_region(region_index);
+
+    const auto& view_glob = halo_block.view();
+    auto reg_offsets = view_glob.offsets();
+
+    const auto& region_extents = env_md.halo_reg_data.view.extents();
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(reg_spec[d] == 1) {
+        continue;
+      }
+
+      if(reg_spec[d] == 0) {
+        reg_offsets[d] += view_glob.extent(d) - region_extents[d];
+      } else {
+        reg_offsets[d] = view_glob.offset(d);
+      }
+    }
+    ViewSpec_t view_pack(reg_offsets, region_extents);
+    pattern_size_t num_elems_block = region_extents[FastestDim];
+    pattern_size_t num_blocks      = view_pack.size() / num_elems_block;
+
+    pack_md.block_len = num_elems_block;
+    pack_md.block_pos.resize(num_blocks);
+
+    auto it_region = region->begin();
+    decltype(it_region) it_pack_data(&(it_region.globmem()), it_region.pattern(), view_pack);
+    for(auto& pos : pack_md.block_pos) {
+      pos = local_memory + it_pack_data.lpos().index;
+      it_pack_data += num_elems_block;
+    }
+  }
+
 private:
   auto info_pack_buffer(const HaloBlockT& halo_block) {
     const auto& halo_spec = halo_block.halo_spec();
@@ -454,8 +563,6 @@ private:
 
 
   void init_block_data(const HaloBlockT& halo_block, const PackOffs_t& packed_offs) {
-    using ViewSpec_t     = typename Pattern_t::viewspec_type;
-
     const auto& env_info_md = halo_block.block_env();
     for(auto r = 0; r < RegionsMax; ++r) {
       const auto& env_md = env_info_md.info(r);
@@ -489,35 +596,8 @@ private:
 
       pack_md.needs_packing = true;
       pack_md.buffer_pos = _pack_buffer.lbegin() + packed_offs[r];
+      init_pack_positions(halo_block, _local_memory, r, pack_md);
 
-      const auto& view_glob = halo_block.view();
-      auto reg_offsets = view_glob.offsets();
-
-      const auto& region_extents = env_md.halo_reg_data.view.extents();
-      for(dim_t d = 0; d < NumDimensions; ++d) {
-        if(reg_spec[d] == 1) {
-          continue;
-        }
-
-        if(reg_spec[d] == 0) {
-          reg_offsets[d] += view_glob.extent(d) - region_extents[d];
-        } else {
-          reg_offsets[d] = view_glob.offset(d);
-        }
-      }
-      ViewSpec_t view_pack(reg_offsets, region_extents);
-      pattern_size_t num_elems_block = region_extents[FastestDim];
-      pattern_size_t num_blocks      = view_pack.size() / num_elems_block;
-
-      pack_md.block_len = num_elems_block;
-      pack_md.block_pos.resize(num_blocks);
-
-      auto it_region = region->begin();
-      decltype(it_region) it_pack_data(&(it_region.globmem()), it_region.pattern(), view_pack);
-      for(auto& pos : pack_md.block_pos) {
-        pos = _local_memory + it_pack_data.lpos().index;
-        it_pack_data += num_elems_block;
-      }
       auto pack = &pack_md;
       pack_md.pack_func = [pack](){
         auto buffer_offset = pack->buffer_pos;
@@ -536,7 +616,18 @@ private:
   PackMDataAll_t _pack_md_all;
 };
 
-template <typename HaloBlockT, SignalReady SigReady>
+/**
+ * Manages the update of all halo regions of a \ref HaloBlock.
+ *
+ * With \c SharedHalos::ON, halo regions owned by units in the same shared
+ * memory domain are not copied. The \ref HaloMemory maps them to the
+ * owner's memory instead, and an update only waits for the owner's signal
+ * that its boundary elements are up to date. The owner must not modify
+ * these elements while they are read, which holds for the common scheme of
+ * alternating between two matrices in consecutive steps.
+ */
+template <typename HaloBlockT, SignalReady SigReady,
+          SharedHalos ShHalos = SharedHalos::OFF>
 class HaloUpdateEnv {
   struct UpdateData {
     std::function<void(dart_handle_t&)> get_halos;
@@ -568,6 +659,9 @@ public:
     _halo_memory(halo_block),
     _signal_env(halo_block, team),
     _pack_env(_halo_block, local_memory, team) {
+    if(ShHalos == SharedHalos::ON) {
+      init_shared_packing();
+    }
     init_update_data();
   }
 
@@ -676,6 +770,15 @@ public:
    */
   const HaloMemory_t& halo_memory() const { return _halo_memory; }
 
+  /**
+   * Returns true if the boundary elements sent to the neighbor of the given
+   * halo region are packed before an update, i.e. they are neither
+   * contiguous nor accessed in place by the neighbor.
+   */
+  bool needs_packing(region_index_t index) const {
+    return _pack_env.needs_packing(index);
+  }
+
   /**
    * Returns the halo environment information object \ref BlockEnvironment
    */
@@ -687,6 +790,32 @@ public:
   const BlockEnv_t& block_env() const { return _halo_block.block_env() ; }
 
 private:
+  /**
+   * Returns the address of the given global memory element if it is
+   * directly accessible in a shared memory window, and nullptr otherwise.
+   */
+  static Element_t* shared_addr(const dart_gptr_t& gptr) {
+    void* addr = nullptr;
+    DASH_ASSERT_RETURNS(dart_gptr_getaddr_shared(gptr, &addr), DART_OK);
+    return static_cast<Element_t*>(addr);
+  }
+
+  // neighbors accessing the boundary elements in place need no packing
+  void init_shared_packing() {
+    const auto& env_info_md = _halo_block.block_env();
+    auto gptr = static_cast<dart_gptr_t>(_halo_block.globmem().begin());
+    for(region_index_t r = 0; r < RegionsMax; ++r) {
+      auto neighbor = env_info_md.info(r).neighbor_id_to;
+      if(neighbor < 0) {
+        continue;
+      }
+      gptr.unitid = neighbor;
+      if(shared_addr(gptr) != nullptr) {
+        _pack_env.disable_packing(r);
+      }
+    }
+  }
+
   void init_update_data() {
     for(const auto& region : _halo_block.halo_regions()) {
       size_t region_size  = region.size();
@@ -694,8 +823,18 @@ private:
         continue;
       }
 
-      auto gptr = _pack_env.halo_gptr(region.index());
-      if(region.is_custom_region()) {
+      auto* shared_pos = (ShHalos == SharedHalos::ON && !region.is_custom_region())
+                         ? shared_addr(region.begin().dart_gptr())
+                         : nullptr;
+      if(shared_pos != nullptr) {
+        team_unit_t neighbor(region.begin().dart_gptr().unitid);
+        _halo_memory.share_region(
+          region.index(), shared_pos,
+          _halo_block.pattern().local_extents(neighbor));
+        _region_data.insert(std::make_pair(
+            region.index(), UpdateData{ [](dart_handle_t& handle) {},
+                                  DART_HANDLE_NULL }));
+      } else if(region.is_custom_region()) {
         _region_data.insert(std::make_pair(
             region.index(), UpdateData{ [](dart_handle_t& handle) {},
                                   DART_HANDLE_NULL }));
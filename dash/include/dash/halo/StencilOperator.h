@@ -41,6 +41,9 @@ public:
   using const_iterator  = const iterator;
 
   using StencilOffsets_t = typename StencilOperatorT::StencilOffsets_t;
+  using index_t          = typename StencilOperatorT::index_t;
+  using Coefficient_t    = typename StencilOperatorT::StencilSpec_t
+                             ::StencilPoint_t::coefficient_t;
 
 public:
   StencilOperatorInner(StencilOperatorT* stencil_op)
@@ -350,7 +353,159 @@ public:
     }
   }
 
+  /**
+   * Updates all inner elements row by row using a user-defined row
+   * operation. In contrast to \ref update the operation is called once per
+   * contiguous row (fastest dimension) of the inner view with the signature:
+   *
+   *     op(const Element_t* center, Element_t* center_dst, index_t num_elems,
+   *        const StencilOffsets_t& stencil_offsets)
+   *
+   * All centers and stencil points of a row are located at
+   * center[0..num_elems) + stencil_offsets[i]. As the loop over the row is
+   * part of the operation and the number of stencil points is known at
+   * compile time, the compiler is able to vectorize it.
+   *
+   * \param begin_dst Pointer to the beginning of the destination memory
+   * \param row_op User-defined operation for updating a row of elements
+   */
+  template <typename RowOp>
+  void update_rows(Element_t* begin_dst, RowOp row_op) {
+    const auto& view = this->view();
+    Coords_t begin_coords;
+    Coords_t end_coords;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      begin_coords[d] = view.offset(d);
+      end_coords[d]   = view.offset(d) + view.extent(d);
+    }
+
+    for_each_row(begin_coords, end_coords, begin_dst, row_op);
+  }
+
+  /**
+   * Updates all inner elements row by row like \ref update_rows, but
+   * processes the inner view tile by tile to keep the stencil points of
+   * consecutive rows in cache. Tiles at the end of the inner view are
+   * truncated.
+   *
+   * \param begin_dst Pointer to the beginning of the destination memory
+   * \param tile_extents Extents of a tile, 0 uses the whole inner extent
+   * \param row_op User-defined operation for updating a row of elements
+   */
+  template <typename RowOp>
+  void update_rows_tiled(Element_t* begin_dst, const Coords_t& tile_extents,
+                         RowOp row_op) {
+    const auto& view = this->view();
+    if(view.size() == 0)
+      return;
+
+    Coords_t view_begin;
+    Coords_t view_end;
+    Coords_t tile_ext;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      view_begin[d] = view.offset(d);
+      view_end[d]   = view.offset(d) + view.extent(d);
+      tile_ext[d]   = (tile_extents[d] > 0) ? tile_extents[d] : view.extent(d);
+    }
+
+    auto tile_begin = view_begin;
+    while(true) {
+      Coords_t tile_end;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        tile_end[d] = std::min(tile_begin[d] + tile_ext[d], view_end[d]);
+      }
+      for_each_row(tile_begin, tile_end, begin_dst, row_op);
+
+      dim_t d = NumDimensions;
+      while(d > 0) {
+        --d;
+        tile_begin[d] += tile_ext[d];
+        if(tile_begin[d] < view_end[d])
+          break;
+        tile_begin[d] = view_begin[d];
+        if(d == 0)
+          return;
+      }
+    }
+  }
+
+  /**
+   * Updates all inner elements with the weighted sum of the center and
+   * all stencil points, using the coefficients of the \ref StencilPoint
+   * instances:
+   *
+   *     dst = coefficient_center * center + sum(coefficient_i * point_i)
+   *
+   * The sum is computed row by row (see \ref update_rows) with a
+   * vectorizable loop.
+   *
+   * \param begin_dst Pointer to the beginning of the destination memory
+   * \param coefficient_center coefficient for the center
+   * \param tile_extents Extents of a tile, see \ref update_rows_tiled
+   */
+  void update_weighted(Element_t* begin_dst, Coefficient_t coefficient_center,
+                       const Coords_t& tile_extents = Coords_t{}) {
+    std::array<Coefficient_t, NumStencilPoints> coefficients;
+    for(auto i = 0; i < NumStencilPoints; ++i) {
+      coefficients[i] = _stencil_op->_stencil_spec[i].coefficient();
+    }
+
+    update_rows_tiled(begin_dst, tile_extents,
+      [&coefficients, coefficient_center](
+          const Element_t* center, Element_t* center_dst, index_t num_elems,
+          const StencilOffsets_t& stencil_offsets) {
+        for(index_t j = 0; j < num_elems; ++j) {
+          Coefficient_t value = coefficient_center * center[j];
+          for(auto i = 0; i < NumStencilPoints; ++i) {
+            value += coefficients[i] * center[j + stencil_offsets[i]];
+          }
+          center_dst[j] = static_cast<Element_t>(value);
+        }
+      });
+  }
+
 private:
+  /*
+   * Calls the row operation for every contiguous row of the box with the
+   * given begin (inclusive) and end (exclusive) coordinates.
+   */
+  template <typename RowOp>
+  void for_each_row(const Coords_t& begin_coords, const Coords_t& end_coords,
+                    Element_t* begin_dst, RowOp& row_op) {
+    static constexpr dim_t FastDim =
+      (StencilOperatorT::memory_order() == ROW_MAJOR) ? NumDimensions - 1 : 0;
+
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(end_coords[d] <= begin_coords[d])
+        return;
+    }
+
+    const auto  offsets   = _stencil_op->set_dimension_offsets();
+    const auto& stencil_offsets = _stencil_op->_stencil_offsets;
+    const auto* center    = _stencil_op->_local_memory;
+    const auto  num_elems = end_coords[FastDim] - begin_coords[FastDim];
+
+    auto coords = begin_coords;
+    while(true) {
+      index_t offset = 0;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        offset += offsets[d] * coords[d];
+      }
+      row_op(center + offset, begin_dst + offset, num_elems, stencil_offsets);
+
+      dim_t i = 1;
+      for(; i < NumDimensions; ++i) {
+        dim_t d = (StencilOperatorT::memory_order() == ROW_MAJOR)
+                    ? NumDimensions - 1 - i : i;
+        if(++coords[d] < end_coords[d])
+          break;
+        coords[d] = begin_coords[d];
+      }
+      if(i == NumDimensions)
+        return;
+    }
+  }
+
   template <dim_t dim, typename Op>
   struct Loop {
     template <typename OffsetT>
@@ -894,6 +1049,432 @@ private:
   iterator_bnd   _bend;
 };
 
+/**
+ * The TemporalStencilOperator applies a stencil operation multiple times
+ * (sub-steps) per halo update (temporal blocking). It requires halo regions
+ * that are wide enough for all sub-steps, see \ref temporal_halo_spec.
+ *
+ * For every update the local block and its halo elements are copied into a
+ * padded buffer. Each sub-step updates the local block and the part of the
+ * halo ring that is still valid, i.e. the ring shrinks by the stencil radius
+ * per sub-step. The redundant updates of halo elements replace the halo
+ * exchanges between the sub-steps.
+ *
+ * Halo elements of custom global boundaries (\ref BoundaryProp::CUSTOM) are
+ * kept fixed. As they are also read by the redundant updates, custom halo
+ * values have to be periodic in cyclic dimensions. Elements at a global
+ * boundary without halo regions (\ref BoundaryProp::NONE) are left
+ * unchanged, as by the \ref StencilOperator.
+ *
+ * Example for two sub-steps of a stencil with radius 1 (halo width 2):
+ *
+ *           .-----------------------------.
+ *           |  .-----------------------.  |
+ *           |  |  .-----------------.  |  |
+ *           |  |  |                 |  |  |
+ *           |  |  |   local block   |  |  |
+ *           |  |  |                 |  |  |
+ *           |  |  '-----------------'  |  |
+ *           |  '-----------------------'- : -- updated in sub-step 1
+ *           '-----------------------------'-- halo elements
+ *
+ * Sub-step 2 updates the local block only.
+ */
+template <typename HaloBlockT, typename StencilSpecT>
+class TemporalStencilOperator {
+private:
+  using Pattern_t = typename HaloBlockT::Pattern_t;
+
+  static constexpr auto NumStencilPoints = StencilSpecT::num_stencil_points();
+  static constexpr auto NumDimensions    = Pattern_t::ndim();
+  static constexpr auto MemoryArrange    = Pattern_t::memory_order();
+  static constexpr auto RegionsMax       = NumRegionsMax<NumDimensions>;
+  static constexpr dim_t FastDim =
+    (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+
+public:
+  using Element_t        = typename HaloBlockT::Element_t;
+  using index_t          = typename std::make_signed<typename Pattern_t::index_type>::type;
+  using StencilOffsets_t = std::array<index_t, NumStencilPoints>;
+  using HaloBlock_t      = HaloBlockT;
+  using HaloMemory_t     = HaloMemory<HaloBlock_t>;
+  using ViewSpec_t       = typename HaloBlockT::ViewSpec_t;
+  using Coords_t         = std::array<index_t, NumDimensions>;
+  using StencilSpec_t    = StencilSpecT;
+
+private:
+  using DimOffsets_t  = std::array<index_t, NumDimensions>;
+  using DimFlags_t    = std::array<bool, NumDimensions>;
+  using RegionCoords_t = RegionCoords<NumDimensions>;
+
+public:
+  /**
+   * Constructor that takes a \ref HaloBlock, a \ref HaloMemory,
+   * a \ref StencilSpec and the number of sub-steps per halo update.
+   */
+  TemporalStencilOperator(
+      const HaloBlockT*   haloblock,
+      Element_t*          local_memory,
+      HaloMemory_t*       halomemory,
+      const StencilSpecT& stencil_spec,
+      int                 num_steps)
+    : _halo_block(haloblock)
+    , _local_memory(local_memory)
+    , _halo_memory(halomemory)
+    , _stencil_spec(stencil_spec)
+    , _num_steps(num_steps)
+    , _view_local(&haloblock->view_local())
+    , _view_inner_with_boundaries(
+        StencilSpecificViews<HaloBlock_t, StencilSpecT>(
+          *haloblock, stencil_spec, _view_local).inner_with_boundaries()) {
+    DASH_ASSERT_MSG(num_steps > 0, "Number of steps must be greater than 0");
+
+    const auto& halo_spec = _halo_block->halo_spec();
+    auto minmax = _stencil_spec.minmax_distances();
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      _radius_pre[d]  = -minmax[d].first;
+      _radius_post[d] = minmax[d].second;
+
+      auto* region_pre  = _halo_block->halo_region(
+                            RegionCoords_t::index(d, RegionPos::PRE));
+      auto* region_post = _halo_block->halo_region(
+                            RegionCoords_t::index(d, RegionPos::POST));
+      bool halo_pre  = region_pre != nullptr && region_pre->size() > 0;
+      bool halo_post = region_post != nullptr && region_post->size() > 0;
+      _pad_pre[d]  = halo_pre ? num_steps * _radius_pre[d] : 0;
+      _pad_post[d] = halo_post ? num_steps * _radius_post[d] : 0;
+      _extend_pre[d]  = halo_pre && !region_pre->is_custom_region();
+      _extend_post[d] = halo_post && !region_post->is_custom_region();
+      _extents_pad[d] = _view_local->extent(d) + _pad_pre[d] + _pad_post[d];
+    }
+
+    // every halo region within the padding has to cover it completely
+    for(region_index_t r = 0; r < RegionsMax; ++r) {
+      RegionCoords_t reg_coords(r);
+      index_t required = 0;
+      bool    padded   = true;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        if(reg_coords[d] == 1)
+          continue;
+        auto pad = (reg_coords[d] == 0) ? _pad_pre[d] : _pad_post[d];
+        padded   = padded && pad > 0;
+        required = std::max(required, pad);
+      }
+      DASH_ASSERT_MSG(
+        !padded || required <= static_cast<index_t>(halo_spec.extent(r)),
+        "Halo region extent too small for the number of steps");
+    }
+
+    _dim_offsets_local = dimension_offsets(_view_local->extents());
+    _dim_offsets       = dimension_offsets(_extents_pad);
+    for(auto i = 0u; i < NumStencilPoints; ++i) {
+      index_t offset = 0;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        offset += _stencil_spec[i][d] * _dim_offsets[d];
+      _stencil_offsets[i] = offset;
+    }
+
+    std::size_t size_pad = 1;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      size_pad *= _extents_pad[d];
+    _buffer_src.resize(size_pad);
+    _buffer_dst.resize(size_pad);
+  }
+
+  static constexpr decltype(auto) ndim() { return NumDimensions; }
+
+  static constexpr decltype(auto) memory_order() { return MemoryArrange; }
+
+  static constexpr decltype(auto) num_stencil_points() { return NumStencilPoints; }
+
+  /**
+   * Returns the number of sub-steps per update
+   */
+  int num_steps() const { return _num_steps; }
+
+  /**
+   * Returns the \ref HaloBlock
+   */
+  const HaloBlock_t& halo_block() { return *_halo_block; }
+
+  /**
+   * Returns the stencil specification \ref StencilSpec
+   */
+  const StencilSpecT& stencil_spec() const { return _stencil_spec; }
+
+  /**
+   * Returns the local \ref SpecView
+   */
+  const ViewSpec_t& view_local() const { return *_view_local; }
+
+  /**
+   * Returns the offsets for each stencil point within the padded buffer.
+   */
+  const StencilOffsets_t& stencil_offsets() const { return _stencil_offsets; }
+
+  /**
+   * Applies a user-defined stencil operation \ref num_steps times to all
+   * local elements. The halo elements have to be updated before.
+   *
+   * The operation is called with the same arguments as for
+   * \ref StencilOperatorInner::update: pointers to the center element and
+   * the destination element, the offset of the center element and the
+   * stencil point offsets. All of them refer to the padded buffer.
+   *
+   * \param begin_dst Pointer to the beginning of the destination memory,
+   *                  may be the local memory of the source matrix if all
+   *                  units finished their halo update before
+   * \param operation User-defined operation for updating an element
+   */
+  template <typename Op>
+  void update(Element_t* begin_dst, Op operation) {
+    copy_to_buffer();
+
+    // Elements outside of the region of the first sub-step are never
+    // updated, only this ring has to be valid in both buffers:
+    Coords_t begin_coords;
+    Coords_t end_coords;
+    step_region(0, begin_coords, end_coords);
+    Coords_t pad_begin;
+    Coords_t pad_end;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      pad_begin[d] = -_pad_pre[d];
+      pad_end[d]   = _view_local->extent(d) + _pad_post[d];
+    }
+    for_each_row_outside(pad_begin, pad_end, begin_coords, end_coords,
+      [&](const Coords_t& coords, index_t length) {
+        auto offset = offset_pad(coords);
+        std::copy_n(_buffer_src.data() + offset, length,
+                    _buffer_dst.data() + offset);
+      });
+
+    for(int step = 0; step < _num_steps; ++step) {
+      step_region(step, begin_coords, end_coords);
+
+      auto* src = _buffer_src.data();
+      auto* dst = _buffer_dst.data();
+      for_each_row(begin_coords, end_coords,
+        [&](const Coords_t& coords, index_t length) {
+          index_t offset     = offset_pad(coords);
+          auto*   center     = src + offset;
+          auto*   center_dst = dst + offset;
+          for(index_t i = 0; i < length;
+              ++i, ++center, ++center_dst, ++offset) {
+            operation(center, center_dst, offset, _stencil_offsets);
+          }
+        });
+      std::swap(_buffer_src, _buffer_dst);
+    }
+
+    // Only the region of the last sub-step differs from the local memory:
+    const auto& offsets_view = _view_inner_with_boundaries.offsets();
+    const auto& extents_view = _view_inner_with_boundaries.extents();
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      begin_coords[d] = offsets_view[d];
+      end_coords[d]   = offsets_view[d] + extents_view[d];
+    }
+    for_each_row(begin_coords, end_coords,
+      [&](const Coords_t& coords, index_t length) {
+        std::copy_n(_buffer_src.data() + offset_pad(coords), length,
+                    begin_dst + offset_local(coords));
+      });
+    if(begin_dst != _local_memory) {
+      Coords_t local_begin{};
+      Coords_t local_end;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        local_end[d] = _view_local->extent(d);
+      for_each_row_outside(local_begin, local_end, begin_coords, end_coords,
+        [&](const Coords_t& coords, index_t length) {
+          auto offset = offset_local(coords);
+          std::copy_n(_local_memory + offset, length, begin_dst + offset);
+        });
+    }
+  }
+
+private:
+  /*
+   * Copies the local block and all halo elements within the padding into
+   * the padded buffer.
+   */
+  void copy_to_buffer() {
+    Coords_t begin_coords{};
+    Coords_t end_coords;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      end_coords[d] = _view_local->extent(d);
+    for_each_row(begin_coords, end_coords,
+      [&](const Coords_t& coords, index_t length) {
+        std::copy_n(_local_memory + offset_local(coords), length,
+                    _buffer_src.data() + offset_pad(coords));
+      });
+
+    for(const auto& region : _halo_block->halo_regions()) {
+      if(region.size() == 0)
+        continue;
+
+      auto index = region.index();
+      RegionCoords_t reg_coords(index);
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        if(reg_coords[d] == 0) {
+          begin_coords[d] = -_pad_pre[d];
+          end_coords[d]   = 0;
+        } else if(reg_coords[d] == 1) {
+          begin_coords[d] = 0;
+          end_coords[d]   = _view_local->extent(d);
+        } else {
+          begin_coords[d] = _view_local->extent(d);
+          end_coords[d]   = _view_local->extent(d) + _pad_post[d];
+        }
+      }
+
+      auto halomem_pos = _halo_memory->first_element_at(index);
+      for_each_row(begin_coords, end_coords,
+        [&](const Coords_t& coords, index_t length) {
+          auto coords_mem = coords;
+          auto valid = _halo_memory->to_halo_mem_coords_check(index,
+                                                               coords_mem);
+          DASH_ASSERT_MSG(valid, "Padding exceeds halo region");
+          // halo memory rows are contiguous in the fastest dimension
+          std::copy_n(halomem_pos + _halo_memory->offset(index, coords_mem),
+                      length, _buffer_src.data() + offset_pad(coords));
+        });
+    }
+  }
+
+  /*
+   * Sets the box of elements updated in the given sub-step: the inner
+   * elements with boundaries, extended into the halo by the radius of the
+   * remaining sub-steps.
+   */
+  void step_region(int step, Coords_t& begin_coords,
+                   Coords_t& end_coords) const {
+    const auto& offsets_view = _view_inner_with_boundaries.offsets();
+    const auto& extents_view = _view_inner_with_boundaries.extents();
+    index_t ring = _num_steps - 1 - step;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      begin_coords[d] = offsets_view[d];
+      end_coords[d]   = offsets_view[d] + extents_view[d];
+      if(_extend_pre[d])
+        begin_coords[d] -= ring * _radius_pre[d];
+      if(_extend_post[d])
+        end_coords[d] += ring * _radius_post[d];
+    }
+  }
+
+  /*
+   * Calls the given function for every contiguous row of the box with
+   * the given begin (inclusive) and end (exclusive) coordinates.
+   */
+  template <typename RowFunc>
+  void for_each_row(const Coords_t& begin_coords, const Coords_t& end_coords,
+                    RowFunc row_func) const {
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(end_coords[d] <= begin_coords[d])
+        return;
+    }
+
+    auto coords = begin_coords;
+    auto length = end_coords[FastDim] - begin_coords[FastDim];
+    while(true) {
+      row_func(coords, length);
+
+      dim_t i = 1;
+      for(; i < NumDimensions; ++i) {
+        dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+        if(++coords[d] < end_coords[d])
+          break;
+        coords[d] = begin_coords[d];
+      }
+      if(i == NumDimensions)
+        return;
+    }
+  }
+
+  /*
+   * Calls the given function for every contiguous row segment of the box
+   * [outer_begin, outer_end) outside of the box [inner_begin, inner_end),
+   * which has to be contained in the outer box.
+   */
+  template <typename RowFunc>
+  void for_each_row_outside(
+      const Coords_t& outer_begin, const Coords_t& outer_end,
+      const Coords_t& inner_begin, const Coords_t& inner_end,
+      RowFunc row_func) const {
+    for_each_row(outer_begin, outer_end,
+      [&](const Coords_t& coords, index_t length) {
+        bool inside = inner_begin[FastDim] < inner_end[FastDim];
+        for(dim_t d = 0; d < NumDimensions && inside; ++d) {
+          if(d != FastDim)
+            inside = coords[d] >= inner_begin[d] && coords[d] < inner_end[d];
+        }
+        if(!inside) {
+          row_func(coords, length);
+          return;
+        }
+        auto segment = coords;
+        if(inner_begin[FastDim] > outer_begin[FastDim])
+          row_func(segment, inner_begin[FastDim] - outer_begin[FastDim]);
+        segment[FastDim] = inner_end[FastDim];
+        if(outer_end[FastDim] > inner_end[FastDim])
+          row_func(segment, outer_end[FastDim] - inner_end[FastDim]);
+      });
+  }
+
+  index_t offset_pad(const Coords_t& coords) const {
+    index_t offset = 0;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      offset += (coords[d] + _pad_pre[d]) * _dim_offsets[d];
+
+    return offset;
+  }
+
+  index_t offset_local(const Coords_t& coords) const {
+    index_t offset = 0;
+    for(dim_t d = 0; d < NumDimensions; ++d)
+      offset += coords[d] * _dim_offsets_local[d];
+
+    return offset;
+  }
+
+  template <typename ExtentsT>
+  static DimOffsets_t dimension_offsets(const ExtentsT& extents) {
+    DimOffsets_t dim_offs;
+    if(MemoryArrange == ROW_MAJOR) {
+      dim_offs[NumDimensions - 1] = 1;
+      for(auto d = NumDimensions - 1; d > 0;) {
+        --d;
+        dim_offs[d] = dim_offs[d + 1] * extents[d + 1];
+      }
+    } else {
+      dim_offs[0] = 1;
+      for(auto d = 1; d < NumDimensions; ++d)
+        dim_offs[d] = dim_offs[d - 1] * extents[d - 1];
+    }
+
+    return dim_offs;
+  }
+
+private:
+  const HaloBlock_t*     _halo_block;
+  Element_t*             _local_memory;
+  HaloMemory_t*          _halo_memory;
+  const StencilSpecT     _stencil_spec;
+  int                    _num_steps;
+  const ViewSpec_t*      _view_local;
+  ViewSpec_t             _view_inner_with_boundaries;
+  DimOffsets_t           _radius_pre{};
+  DimOffsets_t           _radius_post{};
+  DimOffsets_t           _pad_pre{};
+  DimOffsets_t           _pad_post{};
+  DimFlags_t             _extend_pre{};
+  DimFlags_t             _extend_post{};
+  DimOffsets_t           _extents_pad{};
+  DimOffsets_t           _dim_offsets_local{};
+  DimOffsets_t           _dim_offsets{};
+  StencilOffsets_t       _stencil_offsets{};
+  std::vector<Element_t> _buffer_src;
+  std::vector<Element_t> _buffer_dst;
+};
+
 }  // namespace halo
 
 }  // namespace dash
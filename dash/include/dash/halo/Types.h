@@ -117,6 +117,26 @@ inline std::ostream& operator<<(std::ostream& os, const SignalReady& pos) {
   return os;
 }
 
+/**
+ * Switch to access halo elements of units in the same shared memory domain
+ * in place instead of copying them into the local halo memory
+ */
+enum class SharedHalos : bool {
+  /// Halo elements of node-local neighbors are read from their memory
+  ON,
+  /// All halo elements are copied into the local halo memory
+  OFF
+};
+
+inline std::ostream& operator<<(std::ostream& os, const SharedHalos& shared) {
+  if(shared == SharedHalos::ON)
+    os << "ON";
+  else
+    os << "OFF";
+
+  return os;
+}
+
 namespace internal {
 
 template<typename ViewSpecT>
@@ -112,10 +112,10 @@ private:
     const dim_t fast_dim = (pattern.memory_order() == dash::ROW_MAJOR) ? ndim - 1 : 0;
 
 
-    auto lpos = m_pos.lpos();
-    auto prev_lpos = lpos;
+    auto lpos = cur_first.lpos();
 
     do {
+      auto block_lpos = cur_last.lpos();
 
       /* Determine coords and offset in first block */
       auto global_coords = pattern.coords(cur_last.gpos());
@@ -142,17 +142,18 @@ private:
       }
 
       cur_last      += num_copy_block_elem;
-      auto next_lpos = cur_last.lpos();
-
       num_copy_elem += num_copy_block_elem;
-      // check whether the contiguous range is over at the end of the block
-      if (cur_last == m_end ||
-          next_lpos.unit != lpos.unit ||
-          next_lpos.index != (prev_lpos.index + 1)) {
+      if (cur_last == m_end) {
+        break;
+      }
+      // check whether the contiguous range is over at the end of the block,
+      // i.e. the next element is not stored after the last element of the
+      // block at the same unit
+      auto next_lpos = cur_last.lpos();
+      if (next_lpos.unit != lpos.unit ||
+          next_lpos.index != block_lpos.index + num_copy_block_elem) {
         break;
       }
-
-      prev_lpos = next_lpos;
 
     } while (1);
     DASH_LOG_TRACE("next_range<GlobIter>", "cur_first", cur_first,
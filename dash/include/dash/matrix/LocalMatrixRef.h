@@ -188,6 +188,45 @@ public:
     index_type block_lindex
   );
 
+  /**
+   * Number of blocks in local memory.
+   *
+   * Like \c block_lbegin, only defined on the unit's local matrix
+   * (\c matrix.local), not on sub-references.
+   */
+  inline size_type num_blocks() const;
+
+  /**
+   * Pointer to the first element of the local block at given local block
+   * offset.
+   *
+   * Only available for patterns with blocked memory layout like
+   * \c dash::TilePattern: the elements of a block are contiguous in local
+   * memory and linearized in the pattern's memory order, so kernels can
+   * operate on cache-resident blocks in the range
+   * <tt>[block_lbegin(b), block_lend(b))</tt> without packing them.
+   * The extents of the block are those of \c block(b).
+   *
+   * The local memory layout is defined by the pattern, there is no
+   * separate layout option of the matrix: \c dash::TilePattern stores
+   * local blocks in tile order, \c dash::SFCTilePattern in the order of
+   * its space-filling curve.
+   * Block offsets refer to all blocks of the unit, so these accessors are
+   * only defined on the unit's local matrix (\c matrix.local) and not on
+   * sub-references, which would have to apply their view offsets.
+   */
+  inline local_pointer       block_lbegin(index_type block_lindex);
+  inline const_local_pointer block_lbegin(index_type block_lindex) const;
+
+  /**
+   * Pointer past the last element of the local block at given local block
+   * offset.
+   *
+   * \see  block_lbegin
+   */
+  inline local_pointer       block_lend(index_type block_lindex);
+  inline const_local_pointer block_lend(index_type block_lindex) const;
+
   inline operator LocalMatrixRef<T, NumDimensions, CUR-1, PatternT, LocalMemT> && () &&;
 
   // SHOULD avoid cast from MatrixRef to LocalMatrixRef.
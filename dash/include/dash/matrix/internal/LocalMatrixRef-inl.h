@@ -129,6 +129,65 @@ LocalMatrixRef<T, NumDim, CUR, PatternT, GlobMemT>
   return view;
 }
 
+template<typename T, dim_t NumDim, dim_t CUR, class PatternT, typename GlobMemT>
+inline typename LocalMatrixRef<T, NumDim, CUR, PatternT, GlobMemT>::size_type
+LocalMatrixRef<T, NumDim, CUR, PatternT, GlobMemT>
+::num_blocks() const
+{
+  static_assert(
+    CUR == NumDim,
+    "LocalMatrixRef.num_blocks is only defined on the unit's local matrix");
+  return _refview._mat->_pattern.local_blockspec().size();
+}
+
+template<typename T, dim_t NumDim, dim_t CUR, class PatternT, typename GlobMemT>
+inline T *
+LocalMatrixRef<T, NumDim, CUR, PatternT, GlobMemT>
+::block_lbegin(
+  index_type block_lindex)
+{
+  static_assert(
+    CUR == NumDim,
+    "LocalMatrixRef.block_lbegin is only defined on the unit's local matrix");
+  static_assert(
+    dash::pattern_layout_traits<PatternT>::type::blocked,
+    "LocalMatrixRef.block_lbegin requires a pattern with blocked layout");
+  DASH_ASSERT_RANGE(
+    0, block_lindex, static_cast<index_type>(num_blocks()) - 1,
+    "LocalMatrixRef.block_lbegin: local block index out of range");
+  const auto& pattern = _refview._mat->_pattern;
+  auto l_block_l_view = pattern.local_block_local(block_lindex);
+  return _refview._mat->lbegin() + pattern.local_at(l_block_l_view.offsets());
+}
+
+template<typename T, dim_t NumDim, dim_t CUR, class PatternT, typename GlobMemT>
+inline const T *
+LocalMatrixRef<T, NumDim, CUR, PatternT, GlobMemT>
+::block_lbegin(
+  index_type block_lindex) const
+{
+  return const_cast<self_t *>(this)->block_lbegin(block_lindex);
+}
+
+template<typename T, dim_t NumDim, dim_t CUR, class PatternT, typename GlobMemT>
+inline T *
+LocalMatrixRef<T, NumDim, CUR, PatternT, GlobMemT>
+::block_lend(
+  index_type block_lindex)
+{
+  return block_lbegin(block_lindex) +
+         _refview._mat->_pattern.local_block_local(block_lindex).size();
+}
+
+template<typename T, dim_t NumDim, dim_t CUR, class PatternT, typename GlobMemT>
+inline const T *
+LocalMatrixRef<T, NumDim, CUR, PatternT, GlobMemT>
+::block_lend(
+  index_type block_lindex) const
+{
+  return const_cast<self_t *>(this)->block_lend(block_lindex);
+}
+
 template<typename T, dim_t NumDim, dim_t CUR, class PatternT, typename GlobMemT>
 inline LocalMatrixRef<T, NumDim, CUR, PatternT, GlobMemT>
 ::operator LocalMatrixRef<T, NumDim, CUR-1, PatternT, GlobMemT> && () &&
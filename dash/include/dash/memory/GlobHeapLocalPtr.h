@@ -207,7 +207,9 @@ public:
       // element is in bucket currently referenced by this iterator:
       return _bucket_it->lptr[_bucket_phase + offset];
     } else {
-      // find bucket containing element at given offset:
+      // find bucket containing element at given offset, relative to the
+      // beginning of the current bucket:
+      offset += _bucket_phase;
       for (auto b_it = _bucket_it; b_it != _bucket_last; ++b_it) {
         if (offset >= b_it->size) {
           offset -= b_it->size;
@@ -393,7 +395,9 @@ private:
       // element is in bucket currently referenced by this iterator:
       _bucket_phase += offset;
     } else {
-      // find bucket containing element at given offset:
+      // find bucket containing element at given offset, relative to the
+      // beginning of the current bucket:
+      offset += _bucket_phase;
       for (; _bucket_it != _bucket_last; ++_bucket_it) {
         if (offset >= _bucket_it->size) {
           offset -= _bucket_it->size;
@@ -424,24 +428,18 @@ private:
       // element is in bucket currently referenced by this iterator:
       _bucket_phase -= offset;
     } else {
+      // offset relative to the end of the preceding bucket:
       offset -= _bucket_phase;
       // find bucket containing element at given offset:
-      for (; _bucket_it != _bucket_first; --_bucket_it) {
-        if (offset >= _bucket_it->size) {
-          offset -= _bucket_it->size;
-        } else if (offset < _bucket_it->size) {
+      while (_bucket_it != _bucket_first) {
+        --_bucket_it;
+        if (offset <= _bucket_it->size) {
           _bucket_phase = _bucket_it->size - offset;
           break;
         }
+        offset -= _bucket_it->size;
       }
     }
-    if (_bucket_it == _bucket_first) {
-      _bucket_phase = _bucket_it->size - offset;
-    }
-    if (false) {
-      DASH_THROW(dash::exception::OutOfRange,
-                 "offset " << offset << " is out of range");
-    }
   }
 
 private:
@@ -284,6 +284,14 @@ private:
   /// For example, if unit 2 allocated buckets with sizes 1,3,5, the
   /// list at _bucket_cumul_sizes[2] has values 1,4,9.
   bucket_cumul_sizes_map     _bucket_cumul_sizes;
+  /// Cumulative local sizes of all units (i.e. postfix sum), used to
+  /// resolve the unit of a global index by binary search.
+  /// For example, if units 0,1,2 have local sizes 3,0,5, the values in
+  /// _unit_cumul_sizes are 3,3,8.
+  std::vector<size_type>     _unit_cumul_sizes;
+  /// Global pointers of local buckets in bucket index order, allows to
+  /// resolve a bucket's gptr in constant time.
+  std::vector<dart_gptr_t>   _bucket_gptrs;
   /// Mapping unit id to number of buckets marked for attach in the unit's
   /// memory space.
   local_sizes_map            _num_attach_buckets;
@@ -354,6 +362,7 @@ public:
     _attach_buckets_first(_buckets.end()),
     _local_sizes(team.size(), team),
     _bucket_cumul_sizes(team.size()),
+    _unit_cumul_sizes(team.size(), 0),
     _num_attach_buckets(team.size(), team),
     _num_detach_buckets(team.size(), team),
     _remote_size(0)
@@ -520,6 +529,7 @@ public:
     // Update local iteration space:
     update_lbegin();
     update_lend();
+    update_index_tables();
     DASH_ASSERT_EQ(_local_sizes.local[0], _lend - _lbegin,
                    "local size differs from local iteration space size");
     DASH_LOG_TRACE("GlobHeapMem.grow",
@@ -705,6 +715,7 @@ public:
     // Update local iterators as bucket iterators might have changed:
     update_lbegin();
     update_lend();
+    update_index_tables();
 
     DASH_LOG_TRACE("GlobHeapMem.shrink",
                    "cumulative bucket sizes:",  _bucket_cumul_sizes[_myid]);
@@ -758,6 +769,8 @@ public:
     update_lbegin();
     DASH_LOG_TRACE("GlobHeapMem.commit", "updating _lend");
     update_lend();
+    DASH_LOG_TRACE("GlobHeapMem.commit", "updating index tables");
+    update_index_tables();
     DASH_LOG_DEBUG("GlobHeapMem.commit >", "finished");
   }
 
@@ -993,6 +1006,36 @@ private:
     _lend = unit_lend;
   }
 
+  /**
+   * Rebuild the tables used by \c GlobHeapPtr to resolve global indices
+   * in logarithmic time: cumulative local sizes of all units and global
+   * pointers of local buckets in bucket index order.
+   *
+   * Local operation, called whenever bucket sizes or the set of buckets
+   * change.
+   *
+   * \complexity  O(u + b) for u units and b local buckets.
+   */
+  void update_index_tables()
+  {
+    DASH_LOG_TRACE("GlobHeapMem.update_index_tables()");
+    _unit_cumul_sizes.resize(_nunits);
+    size_type cumul_size = 0;
+    for (size_type u = 0; u < _nunits; ++u) {
+      const auto & u_bucket_cumul_sizes = _bucket_cumul_sizes[u];
+      if (!u_bucket_cumul_sizes.empty()) {
+        cumul_size += u_bucket_cumul_sizes.back();
+      }
+      _unit_cumul_sizes[u] = cumul_size;
+    }
+    _bucket_gptrs.clear();
+    _bucket_gptrs.reserve(_buckets.size());
+    for (const auto & bucket : _buckets) {
+      _bucket_gptrs.push_back(bucket.gptr);
+    }
+    DASH_LOG_TRACE("GlobHeapMem.update_index_tables >",
+                   "unit cumulative sizes:", _unit_cumul_sizes);
+  }
 
   /**
    * Commit global deallocation of buffers marked for detach.
@@ -1050,7 +1093,7 @@ private:
     size_type num_attached_elem    = 0;
     // Number of elements at remote units before the commit:
     size_type old_remote_size      = _remote_size;
-    _remote_size                   = update_remote_size();
+    _remote_size                   = update_remote_size(max_attach_buckets);
     // Whether at least one remote unit needs to attach additional global
     // memory:
     bool has_remote_attach         = _remote_size > old_remote_size;
@@ -1107,6 +1150,12 @@ private:
       bucket.attached           = true;
       DASH_ASSERT(!DART_GPTR_ISNULL(bucket.gptr));
       _buckets.push_back(bucket);
+      // Register null bucket in cumulative bucket sizes so bucket indices
+      // are identical to bucket positions in the sequence of collective
+      // attach operations at all units:
+      auto & my_bucket_cumul_sizes = _bucket_cumul_sizes[_myid];
+      my_bucket_cumul_sizes.push_back(
+        my_bucket_cumul_sizes.empty() ? 0 : my_bucket_cumul_sizes.back());
       num_attached_buckets++;
       DASH_LOG_TRACE("GlobHeapMem.commit_attach", "attached null bucket:",
                      "gptr:", bucket.gptr,
@@ -1144,7 +1193,9 @@ private:
    * Request the size of all units' local memory, including unattached memory
    * regions, and update the capacity of global memory space.
    */
-  size_type update_remote_size()
+  size_type update_remote_size(
+    /// Maximum number of buckets attached by any unit in this commit.
+    size_type max_attach_buckets)
   {
     // This function updates local snapshots of the remote unit's local
     // sizes.
@@ -1178,6 +1229,9 @@ private:
     //      single buckets must be retrieved from the vector
     //      attach_bucket_sizes temporarily attached by u in step 1.
     // 5. Detach vector attach_bucket_sizes.
+    // 6. For every remote unit u that attaches less than the maximum number
+    //    of buckets, append the sizes of the null buckets attached by u
+    //    in commit_attach.
 
     DASH_LOG_TRACE("GlobHeapMem.update_remote_size()");
     size_type new_remote_size = 0;
@@ -1226,9 +1280,9 @@ private:
           std::accumulate(std::begin(num_unattached_buckets),
                           std::end(num_unattached_buckets), 0);
 
-      team_unattached_bucket_sizes.reserve(n_team_unattached_buckets);
+      team_unattached_bucket_sizes.resize(n_team_unattached_buckets);
 
-      displs.reserve(_team->size());
+      displs.resize(_team->size());
       displs[0] = 0;
 
       //calculate the displs of each unit
@@ -1301,6 +1355,11 @@ private:
       if (u_local_size_diff < 0 && u_bucket_cumul_sizes.size() > 0) {
         u_bucket_cumul_sizes.back() += u_local_size_diff;
       }
+      // Null buckets attached by unit u:
+      for (auto bi = u_num_attach_buckets; bi < max_attach_buckets; ++bi) {
+        u_bucket_cumul_sizes.push_back(
+          u_bucket_cumul_sizes.empty() ? 0 : u_bucket_cumul_sizes.back());
+      }
     }
 
     _team->barrier();
@@ -1332,18 +1391,28 @@ private:
     if (_nunits == 0) {
       DASH_THROW(dash::exception::RuntimeError, "No units in team");
     }
-    // Get the referenced bucket's dart_gptr:
-    auto bucket_it = _buckets.begin();
-    std::advance(bucket_it, bucket_index);
-    auto dart_gptr = bucket_it->gptr;
-    DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->attached);
-    DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->gptr);
+    // Get the referenced bucket's dart_gptr, buckets beyond the table are
+    // not attached yet:
+    dart_gptr_t dart_gptr = DART_GPTR_NULL;
+    if (bucket_index >= 0 &&
+        static_cast<size_type>(bucket_index) < _bucket_gptrs.size()) {
+      dart_gptr = _bucket_gptrs[bucket_index];
+    }
+    DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", dart_gptr);
+#if defined(DASH_ENABLE_ASSERTIONS)
     if (unit == _myid) {
-      DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->lptr);
-      DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_it->size);
-      DASH_ASSERT_LT(bucket_phase, bucket_it->size,
+      const auto & my_bucket_cumul_sizes = _bucket_cumul_sizes[_myid];
+      DASH_ASSERT_LT(bucket_index, my_bucket_cumul_sizes.size(),
+                     "bucket index out of bounds");
+      auto bucket_size = my_bucket_cumul_sizes[bucket_index];
+      if (bucket_index > 0) {
+        bucket_size -= my_bucket_cumul_sizes[bucket_index - 1];
+      }
+      DASH_LOG_TRACE_VAR("GlobHeapMem.dart_gptr_at", bucket_size);
+      DASH_ASSERT_LT(bucket_phase, bucket_size,
                      "bucket phase out of bounds");
     }
+#endif
     if (DART_GPTR_ISNULL(dart_gptr)) {
       DASH_LOG_TRACE("GlobHeapMem.dart_gptr_at",
                      "bucket.gptr is DART_GPTR_NULL");
@@ -10,6 +10,7 @@
 
 #include <dash/internal/Logging.h>
 
+#include <algorithm>
 #include <type_traits>
 #include <list>
 #include <vector>
@@ -60,12 +61,16 @@ public:
 private:
   typedef std::vector<std::vector<size_type> >
     bucket_cumul_sizes_map;
+  typedef std::vector<size_type>
+    unit_cumul_sizes_map;
 
 private:
   /// Global memory used to dereference iterated values.
   const globmem_type           * _globmem            = nullptr;
   /// Mapping unit id to buckets in the unit's attached local storage.
   const bucket_cumul_sizes_map * _bucket_cumul_sizes = nullptr;
+  /// Cumulative local sizes of all units.
+  const unit_cumul_sizes_map   * _unit_cumul_sizes   = nullptr;
   /// Pointer to first element in local data space.
   local_pointer                  _lbegin;
   /// Current position of the pointer in global canonical index space.
@@ -90,6 +95,7 @@ public:
   GlobHeapPtr()
   : _globmem(nullptr),
     _bucket_cumul_sizes(nullptr),
+    _unit_cumul_sizes(nullptr),
     _idx(0),
     _max_idx(0),
     _myid(dash::Team::GlobalUnitID()),
@@ -111,6 +117,7 @@ public:
 	  index_type           position = 0)
   : _globmem(reinterpret_cast<const globmem_type *>(gmem)),
     _bucket_cumul_sizes(&_globmem->_bucket_cumul_sizes),
+    _unit_cumul_sizes(&_globmem->_unit_cumul_sizes),
     _lbegin(_globmem->lbegin()),
     _idx(position),
     _max_idx(gmem->size() - 1),
@@ -121,31 +128,7 @@ public:
     _idx_bucket_phase(0)
   {
     DASH_LOG_TRACE("GlobHeapPtr(gmem,idx)", "gidx:", position);
-    for (auto unit_bucket_cumul_sizes : *_bucket_cumul_sizes) {
-      DASH_LOG_TRACE_VAR("GlobHeapPtr(gmem,idx)",
-                         unit_bucket_cumul_sizes);
-      size_type bucket_cumul_size_prev = 0;
-      for (auto bucket_cumul_size : unit_bucket_cumul_sizes) {
-        DASH_LOG_TRACE_VAR("GlobHeapPtr(gmem,idx)", bucket_cumul_size);
-        if (position < bucket_cumul_size) {
-          DASH_LOG_TRACE_VAR("GlobHeapPtr(gmem,idx)", position);
-          _idx_bucket_phase -= bucket_cumul_size;
-          position           = 0;
-          _idx_local_idx     = position;
-          _idx_bucket_phase  = position - bucket_cumul_size_prev;
-          break;
-        }
-        bucket_cumul_size_prev = bucket_cumul_size;
-        ++_idx_bucket_idx;
-      }
-      if (position == 0) {
-        break;
-      }
-      // Advance to next unit, adjust position relative to next unit's
-      // local index space:
-      position -= unit_bucket_cumul_sizes.back();
-      ++_idx_unit_id;
-    }
+    resolve_global_index();
     DASH_LOG_TRACE("GlobHeapPtr(gmem,idx)",
                    "gidx:",   _idx,
                    "unit:",   _idx_unit_id,
@@ -164,6 +147,7 @@ public:
 	  index_type           local_index)
   : _globmem(reinterpret_cast<const globmem_type *>(gmem)),
     _bucket_cumul_sizes(&_globmem->_bucket_cumul_sizes),
+    _unit_cumul_sizes(&_globmem->_unit_cumul_sizes),
     _lbegin(_globmem->lbegin()),
     _idx(0),
     _max_idx(gmem->size() - 1),
@@ -178,11 +162,12 @@ public:
                    "lidx:", local_index);
     DASH_ASSERT_LT(unit, _bucket_cumul_sizes->size(), "invalid unit id");
 
-    for (size_type unit = 0; unit < _idx_unit_id; ++unit) {
-      auto prec_unit_local_size = (*_bucket_cumul_sizes)[unit].back();
-      _idx += prec_unit_local_size;
+    // Offset of the unit's first element in global index space:
+    if (_idx_unit_id > 0) {
+      _idx = (*_unit_cumul_sizes)[_idx_unit_id - 1];
     }
-    increment(local_index);
+    _idx += local_index;
+    resolve_local_index(local_index);
     DASH_LOG_TRACE("GlobHeapPtr(gmem,unit,lidx) >",
                    "gidx:",   _idx,
                    "maxidx:", _max_idx,
@@ -200,6 +185,7 @@ public:
     const GlobHeapPtr<E_, M_> & other)
   : _globmem(other._globmem),
     _bucket_cumul_sizes(other._bucket_cumul_sizes),
+    _unit_cumul_sizes(other._unit_cumul_sizes),
     _lbegin(other._lbegin),
     _idx(other._idx),
     _max_idx(other._max_idx),
@@ -218,6 +204,7 @@ public:
   {
     _globmem            = other._globmem;
     _bucket_cumul_sizes = other._bucket_cumul_sizes;
+    _unit_cumul_sizes   = other._unit_cumul_sizes;
     _lbegin             = other._lbegin;
     _idx                = other._idx;
     _max_idx            = other._max_idx;
@@ -401,7 +388,7 @@ public:
 
   inline self_t & operator-=(index_type offset)
   {
-    increment(offset);
+    decrement(offset);
     return *this;
   }
 
@@ -469,9 +456,64 @@ public:
 
 private:
   /**
-   * Advance pointer by specified position offset.
+   * Resolve unit, local offset, bucket and bucket phase at the pointer's
+   * global position.
+   *
+   * \complexity  O(log u + log b) for u units and b buckets of the unit
+   *              at the pointer's position.
+   */
+  void resolve_global_index()
+  {
+    const auto & unit_cumul_sizes = *_unit_cumul_sizes;
+    DASH_ASSERT_GT(unit_cumul_sizes.size(), 0, "no units in global memory");
+    // First unit with cumulative size exceeding the global index, skips
+    // units with empty local memory space:
+    auto unit_it = std::upper_bound(unit_cumul_sizes.begin(),
+                                    unit_cumul_sizes.end(),
+                                    static_cast<size_type>(_idx));
+    if (unit_it == unit_cumul_sizes.end()) {
+      // Position past the final element, resolved relative to last unit:
+      --unit_it;
+    }
+    _idx_unit_id = team_unit_t(
+                     std::distance(unit_cumul_sizes.begin(), unit_it));
+    index_type local_index = _idx;
+    if (_idx_unit_id > 0) {
+      local_index -= unit_cumul_sizes[_idx_unit_id - 1];
+    }
+    resolve_local_index(local_index);
+  }
+
+  /**
+   * Resolve bucket and bucket phase of the given offset in the local
+   * index space of the unit at the pointer's position.
+   *
+   * \complexity  O(log b) for b buckets of the unit.
    */
-  void increment(int offset)
+  void resolve_local_index(index_type local_index)
+  {
+    const auto & unit_bkt_sizes = (*_bucket_cumul_sizes)[_idx_unit_id];
+    // First bucket with cumulative size exceeding the local offset, skips
+    // empty buckets:
+    auto bkt_it = std::upper_bound(unit_bkt_sizes.begin(),
+                                   unit_bkt_sizes.end(),
+                                   static_cast<size_type>(local_index));
+    if (bkt_it == unit_bkt_sizes.end() && !unit_bkt_sizes.empty()) {
+      // Position past the unit's final element:
+      --bkt_it;
+    }
+    _idx_local_idx    = local_index;
+    _idx_bucket_idx   = std::distance(unit_bkt_sizes.begin(), bkt_it);
+    _idx_bucket_phase = local_index;
+    if (_idx_bucket_idx > 0) {
+      _idx_bucket_phase -= unit_bkt_sizes[_idx_bucket_idx - 1];
+    }
+  }
+
+  /**
+   * Increment pointer by specified position offset.
+   */
+  void increment(index_type offset)
   {
     DASH_LOG_TRACE("GlobHeapPtr.increment()",
                    "gidx:",   _idx,
@@ -480,10 +522,16 @@ private:
                    "bidx:",   _idx_bucket_idx,
                    "bphase:", _idx_bucket_phase,
                    "offset:", offset);
+    if (offset < 0) {
+      decrement(-offset);
+      return;
+    }
     _idx += offset;
-    auto current_bucket_size =
-           (*_bucket_cumul_sizes)[_idx_unit_id][_idx_bucket_idx];
-    if (_idx_local_idx + offset < current_bucket_size) {
+    const auto & unit_bkt_sizes = (*_bucket_cumul_sizes)[_idx_unit_id];
+    if (_idx_bucket_idx >= 0 &&
+        static_cast<size_type>(_idx_bucket_idx) < unit_bkt_sizes.size() &&
+        static_cast<size_type>(_idx_local_idx + offset)
+          < unit_bkt_sizes[_idx_bucket_idx]) {
       DASH_LOG_TRACE("GlobHeapPtr.increment", "position current bucket");
       // element is in bucket currently referenced by this pointer:
       _idx_bucket_phase += offset;
@@ -491,64 +539,7 @@ private:
     } else {
       DASH_LOG_TRACE("GlobHeapPtr.increment",
                      "position in succeeding bucket");
-      // iterate units:
-      auto unit_id_max = _bucket_cumul_sizes->size() - 1;
-      for (; _idx_unit_id <= unit_id_max; ++_idx_unit_id) {
-        if (offset == 0) {
-          break;
-        }
-        auto unit_bkt_sizes       = (*_bucket_cumul_sizes)[_idx_unit_id];
-        auto unit_bkt_sizes_total = unit_bkt_sizes.back();
-        auto unit_num_bkts        = unit_bkt_sizes.size();
-        DASH_LOG_TRACE("GlobHeapPtr.increment",
-                       "unit:", _idx_unit_id,
-                       "remaining offset:", offset,
-                       "total local bucket size:", unit_bkt_sizes_total);
-        if (_idx_local_idx + offset >= unit_bkt_sizes_total) {
-          // offset refers to next unit:
-          DASH_LOG_TRACE("GlobHeapPtr.increment",
-                         "position in remote range");
-          // subtract remaining own local size from remaining offset:
-          offset -= (unit_bkt_sizes_total - _idx_local_idx);
-          if (_idx_unit_id == unit_id_max) {
-            // end pointer, offset exceeds iteration space:
-            _idx_bucket_idx    = unit_num_bkts - 1;
-            auto last_bkt_size = unit_bkt_sizes.back();
-            if (unit_num_bkts > 1) {
-              last_bkt_size -= unit_bkt_sizes[_idx_bucket_idx-1];
-            }
-            _idx_bucket_phase  = last_bkt_size + offset;
-            _idx_local_idx    += unit_bkt_sizes_total  + offset;
-            break;
-          }
-          _idx_local_idx    = 0;
-          _idx_bucket_idx   = 0;
-          _idx_bucket_phase = 0;
-        } else {
-          // offset refers to current unit:
-          DASH_LOG_TRACE("GlobHeapPtr.increment",
-                         "position in local range",
-                         "current bucket phase:", _idx_bucket_phase,
-                         "cumul. bucket sizes:",  unit_bkt_sizes);
-          _idx_local_idx += offset;
-          // iterate the unit's bucket sizes:
-          for (; _idx_bucket_idx < unit_num_bkts; ++_idx_bucket_idx) {
-            auto cumul_bucket_size = unit_bkt_sizes[_idx_bucket_idx];
-            if (_idx_local_idx < cumul_bucket_size) {
-              auto cumul_prev  = _idx_bucket_idx > 0
-                                 ? unit_bkt_sizes[_idx_bucket_idx-1]
-                                 : 0;
-              // offset refers to current bucket:
-              _idx_bucket_phase = _idx_local_idx - cumul_prev;
-              offset            = 0;
-              break;
-            }
-          }
-          if (offset == 0) {
-            break;
-          }
-        }
-      }
+      resolve_global_index();
     }
     DASH_LOG_TRACE("GlobHeapPtr.increment >",
                    "gidx:",   _idx,
@@ -561,7 +552,7 @@ private:
   /**
    * Decrement pointer by specified position offset.
    */
-  void decrement(int offset)
+  void decrement(index_type offset)
   {
     DASH_LOG_TRACE("GlobHeapPtr.decrement()",
                    "gidx:",   _idx,
@@ -570,58 +561,24 @@ private:
                    "bidx:",   _idx_bucket_idx,
                    "bphase:", _idx_bucket_phase,
                    "offset:", -offset);
+    if (offset < 0) {
+      increment(-offset);
+      return;
+    }
     if (offset > _idx) {
       DASH_THROW(dash::exception::OutOfRange,
                  "offset " << offset << " is out of range");
     }
     _idx -= offset;
     if (offset <= _idx_bucket_phase) {
+      DASH_LOG_TRACE("GlobHeapPtr.decrement", "position current bucket");
       // element is in bucket currently referenced by this pointer:
       _idx_bucket_phase -= offset;
       _idx_local_idx    -= offset;
     } else {
-      // iterate units:
-      auto first_unit = _idx_unit_id;
-      for (; _idx_unit_id >= 0; --_idx_unit_id) {
-        auto unit_bkt_sizes       = (*_bucket_cumul_sizes)[_idx_unit_id];
-        auto unit_bkt_sizes_total = unit_bkt_sizes.back();
-        auto unit_num_bkts        = unit_bkt_sizes.size();
-        if (_idx_unit_id != first_unit) {
-          --offset;
-          _idx_bucket_idx    = unit_num_bkts - 1;
-          _idx_local_idx     = unit_bkt_sizes_total - 1;
-          auto last_bkt_size = unit_bkt_sizes.back();
-          if (unit_num_bkts > 1) {
-            last_bkt_size -= unit_bkt_sizes[_idx_bucket_idx-1];
-          }
-          _idx_bucket_phase  = last_bkt_size - 1;
-        }
-        if (offset <= _idx_local_idx) {
-          // offset refers to current unit:
-          // iterate the unit's bucket sizes:
-          for (; _idx_bucket_idx >= 0; --_idx_bucket_idx) {
-            auto bucket_size = unit_bkt_sizes[_idx_bucket_idx];
-            if (offset <= _idx_bucket_phase) {
-              // offset refers to current bucket:
-              _idx_local_idx    -= offset;
-              _idx_bucket_phase -= offset;
-              offset             = 0;
-              break;
-            } else {
-              // offset refers to preceeding bucket:
-              _idx_local_idx    -= (_idx_bucket_phase + 1);
-              offset            -= (_idx_bucket_phase + 1);
-              _idx_bucket_phase  = unit_bkt_sizes[_idx_bucket_idx-1] - 1;
-            }
-          }
-        } else {
-          // offset refers to preceeding unit:
-          offset -= _idx_local_idx;
-        }
-        if (offset == 0) {
-          break;
-        }
-      }
+      DASH_LOG_TRACE("GlobHeapPtr.decrement",
+                     "position in preceeding bucket");
+      resolve_global_index();
     }
     DASH_LOG_TRACE("GlobHeapPtr.decrement >",
                    "gidx:",   _idx,
@@ -0,0 +1,1508 @@
+#ifndef DASH__SFC_TILE_PATTERN_H_
+#define DASH__SFC_TILE_PATTERN_H_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <dash/Types.h>
+#include <dash/Distribution.h>
+#include <dash/Exception.h>
+#include <dash/Dimensional.h>
+#include <dash/Cartesian.h>
+#include <dash/Team.h>
+
+#include <dash/pattern/PatternProperties.h>
+#include <dash/pattern/internal/PatternArguments.h>
+
+#include <dash/internal/Math.h>
+#include <dash/internal/Logging.h>
+
+namespace dash {
+
+/**
+ * Space-filling curves defining the order of blocks in a
+ * \c dash::SFCTilePattern.
+ */
+enum class SFCurve : int {
+  /// Z-order curve, interleaves the bits of the block coordinates.
+  MORTON,
+  /// Hilbert curve, consecutive blocks on the curve are always adjacent.
+  HILBERT
+};
+
+namespace internal {
+
+/**
+ * Position of a point on the Morton curve in a hypercube with extent
+ * 2^bits in every dimension.
+ */
+template<dim_t NumDimensions, typename CoordT>
+uint64_t sfc_morton_key(
+  const std::array<CoordT, NumDimensions> & coords,
+  int                                       bits)
+{
+  uint64_t key = 0;
+  for (int bit = bits - 1; bit >= 0; --bit) {
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      key = (key << 1) | ((static_cast<uint64_t>(coords[d]) >> bit) & 1);
+    }
+  }
+  return key;
+}
+
+/**
+ * Position of a point on the Hilbert curve in a hypercube with extent
+ * 2^bits in every dimension.
+ *
+ * Transforms the coordinates to the transposed Hilbert index as described
+ * in J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707,
+ * 2004, and interleaves its bits.
+ */
+template<dim_t NumDimensions, typename CoordT>
+uint64_t sfc_hilbert_key(
+  std::array<CoordT, NumDimensions> coords,
+  int                               bits)
+{
+  typedef typename std::make_unsigned<CoordT>::type ucoord_t;
+  std::array<ucoord_t, NumDimensions> x;
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    x[d] = static_cast<ucoord_t>(coords[d]);
+  }
+  ucoord_t m = ucoord_t(1) << (bits - 1);
+  // Inverse undo of excess work:
+  for (ucoord_t q = m; q > 1; q >>= 1) {
+    ucoord_t p = q - 1;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      if (x[d] & q) {
+        x[0] ^= p;
+      } else {
+        ucoord_t t = (x[0] ^ x[d]) & p;
+        x[0] ^= t;
+        x[d] ^= t;
+      }
+    }
+  }
+  // Gray encode:
+  for (dim_t d = 1; d < NumDimensions; ++d) {
+    x[d] ^= x[d-1];
+  }
+  ucoord_t t = 0;
+  for (ucoord_t q = m; q > 1; q >>= 1) {
+    if (x[NumDimensions-1] & q) {
+      t ^= q - 1;
+    }
+  }
+  for (dim_t d = 0; d < NumDimensions; ++d) {
+    x[d] ^= t;
+  }
+  return sfc_morton_key<NumDimensions, ucoord_t>(x, bits);
+}
+
+} // namespace internal
+
+/**
+ * Defines how a list of global indices is mapped to single units within
+ * a Team.
+ *
+ * Tiles are ordered along a space-filling curve (\c SFCurve::HILBERT or
+ * \c SFCurve::MORTON) and every unit is assigned a contiguous segment of
+ * the curve, the number of tiles per unit differs by at most one.
+ * Tiles that are consecutive on the curve are spatially close, so the
+ * tiles of a unit form a compact region with a small surface for any
+ * number of units, reducing the number of neighbors and the
+ * communication volume of nearest-neighbor stencils compared to a
+ * cyclic tile distribution.
+ * Local tiles are stored contiguously in the order of the curve.
+ * Like in \c TilePattern, global indices iterate the tiles in
+ * canonical order and the elements within a tile.
+ *
+ * Expects \c extent[d] to be a multiple of \c blocksize[d].
+ * The arrangement of units in the team spec is only used to derive the
+ * default tile extents, its size must match the size of the team.
+ * Halo regions of the tiles are exchanged by \c dash::halo::GhostExchange.
+ *
+ * Example:
+ *
+ * \code
+ *   // 2D matrix with 32x32 tiles ordered along a Hilbert curve:
+ *   typedef dash::SFCTilePattern<2, dash::SFCurve::HILBERT> pattern_t;
+ *   dash::Matrix<double, 2, dash::default_index_t, pattern_t> matrix(
+ *     dash::SizeSpec<2>(1024, 1024),
+ *     dash::DistributionSpec<2>(dash::TILE(32), dash::TILE(32)));
+ * \endcode
+ *
+ * \tparam  NumDimensions  The number of dimensions of the pattern
+ * \tparam  Curve          The space-filling curve defining the order of
+ *                         tiles, defaults to HILBERT.
+ * \tparam  Arrangement    The memory order of the pattern (ROW_MAJOR
+ *                         or COL_MAJOR), defaults to ROW_MAJOR.
+ *                         Memory order defines how elements in the
+ *                         pattern will be iterated predominantly
+ *                         \see MemArrange
+ *
+ * \concept{DashPatternConcept}
+ *
+ */
+template<
+  dim_t      NumDimensions,
+  SFCurve    Curve       = SFCurve::HILBERT,
+  MemArrange Arrangement = ROW_MAJOR,
+  typename   IndexType   = dash::default_index_t>
+class SFCTilePattern
+{
+  static_assert(NumDimensions > 1,
+                "SFCTilePattern requires at least two dimensions");
+
+public:
+  static constexpr char const * PatternName = "SFCTilePattern";
+
+public:
+  /// Satisfiable properties in pattern property category Partitioning:
+  typedef pattern_partitioning_properties<
+              // Block extents are constant for every dimension.
+              pattern_partitioning_tag::rectangular,
+              // All blocks have identical extents.
+              pattern_partitioning_tag::regular,
+              // Identical number of elements in every block.
+              pattern_partitioning_tag::balanced,
+              // Data range is partitioned in every dimension.
+              pattern_partitioning_tag::ndimensional
+          > partitioning_properties;
+  /// Satisfiable properties in pattern property category Mapping:
+  typedef pattern_mapping_properties<
+              // Number of blocks assigned to a unit may differ.
+              pattern_mapping_tag::unbalanced,
+              // Units are mapped to more than one block.
+              pattern_mapping_tag::multiple
+          > mapping_properties;
+  /// Satisfiable properties in pattern property category Layout:
+  typedef pattern_layout_properties<
+              // Elements are contiguous in local memory within single
+              // block.
+              pattern_layout_tag::blocked,
+              // Local element order corresponds to a logical
+              // linearization within single blocks.
+              pattern_layout_tag::linear
+          > layout_properties;
+
+private:
+  /// Fully specified type definition of self type
+  typedef SFCTilePattern<NumDimensions, Curve, Arrangement, IndexType>
+    self_t;
+  /// Derive size type from given signed index / ptrdiff type
+  typedef typename std::make_unsigned<IndexType>::type
+    SizeType;
+  typedef CartesianIndexSpace<NumDimensions, Arrangement, IndexType>
+    MemoryLayout_t;
+  typedef CartesianIndexSpace<NumDimensions, Arrangement, IndexType>
+    LocalMemoryLayout_t;
+  typedef CartesianIndexSpace<NumDimensions, Arrangement, SizeType>
+    BlockSpec_t;
+  typedef CartesianIndexSpace<NumDimensions, Arrangement, SizeType>
+    BlockSizeSpec_t;
+  typedef DistributionSpec<NumDimensions>
+    DistributionSpec_t;
+  typedef TeamSpec<NumDimensions, IndexType>
+    TeamSpec_t;
+  typedef SizeSpec<NumDimensions, SizeType>
+    SizeSpec_t;
+  typedef ViewSpec<NumDimensions, IndexType>
+    ViewSpec_t;
+  typedef internal::PatternArguments<NumDimensions, IndexType>
+    PatternArguments_t;
+
+public:
+  typedef IndexType   index_type;
+  typedef SizeType    size_type;
+  typedef ViewSpec_t  viewspec_type;
+  typedef struct {
+    team_unit_t unit;
+    IndexType   index{};
+  } local_index_t;
+  typedef struct {
+    team_unit_t unit;
+    std::array<index_type, NumDimensions> coords;
+  } local_coords_t;
+
+private:
+  /// Distribution type (BLOCKED, CYCLIC, BLOCKCYCLIC, TILE or NONE) of
+  /// all dimensions. Defaults to BLOCKED in first, and NONE in higher
+  /// dimensions
+  DistributionSpec_t          _distspec;
+  /// Team containing the units to which the patterns element are mapped
+  dash::Team                * _team            = nullptr;
+  /// The active unit's id.
+  team_unit_t                 _myid;
+  /// Cartesian arrangement of units within the team
+  TeamSpec_t                  _teamspec;
+  /// The global layout of the pattern's elements in memory respective to
+  /// memory order. Also specifies the extents of the pattern space.
+  MemoryLayout_t              _memory_layout;
+  /// Total amount of units to which this pattern's elements are mapped
+  SizeType                    _nunits          = dash::Team::All().size();
+  /// Maximum extents of a block in this pattern
+  BlockSizeSpec_t             _blocksize_spec;
+  /// Arrangement of blocks in all dimensions
+  BlockSpec_t                 _blockspec;
+  /// Position on the curve of every block, by global block index
+  std::vector<IndexType>      _block_curve_pos;
+  /// Global block index of every position on the curve
+  std::vector<IndexType>      _curve_block;
+  /// Arrangement of local blocks in all dimensions
+  BlockSpec_t                 _local_blockspec;
+  /// A projected view of the global memory layout representing the
+  /// local memory layout of this unit's elements respective to memory
+  /// order.
+  LocalMemoryLayout_t         _local_memory_layout;
+  /// Maximum number of elements assigned to a single unit
+  SizeType                    _local_capacity;
+  /// Corresponding global index to first local index of the active unit
+  IndexType                   _lbegin;
+  /// Corresponding global index past last local index of the active unit
+  IndexType                   _lend;
+
+public:
+  /**
+   * Constructor, initializes a pattern from an argument list consisting
+   * of the pattern size (extent, number of elements) in every dimension
+   * followed by optional distribution types.
+   *
+   * Examples:
+   *
+   * \code
+   *   // A 64x64 matrix with 8x8 tiles ordered along a Hilbert curve:
+   *   SFCTilePattern<2> p1(64, 64, TILE(8), TILE(8));
+   *   // Same as
+   *   SFCTilePattern<2> p1(SizeSpec<2>(64, 64),
+   *                        DistributionSpec<2>(TILE(8), TILE(8)));
+   * \endcode
+   */
+  template<typename ... Args>
+  SFCTilePattern(
+    /// Argument list consisting of the pattern size (extent, number of
+    /// elements) in every dimension followed by optional distribution
+    /// types.
+    SizeType arg,
+    /// Argument list consisting of the pattern size (extent, number of
+    /// elements) in every dimension followed by optional distribution
+    /// types.
+    Args && ... args)
+  : SFCTilePattern(PatternArguments_t(arg, args...))
+  {
+    DASH_LOG_TRACE("SFCTilePattern()", "Constructor with Argument list");
+    initialize_local_range();
+  }
+
+  /**
+   * Constructor, initializes a pattern from explicit instances of
+   * \c SizeSpec, \c DistributionSpec, \c TeamSpec and a \c Team.
+   */
+  SFCTilePattern(
+    /// SFCTilePattern size (extent, number of elements) in every dimension
+    const SizeSpec_t         & sizespec,
+    /// Distribution type (BLOCKED, CYCLIC, BLOCKCYCLIC, TILE or NONE) of
+    /// all dimensions. Defaults to BLOCKED in first, and NONE in higher
+    /// dimensions
+    DistributionSpec_t         dist,
+    /// Cartesian arrangement of units within the team
+    const TeamSpec_t         & teamspec,
+    /// Team containing units to which this pattern maps its elements
+    dash::Team               & team = dash::Team::All())
+  : _distspec(std::move(dist)),
+    _team(&team),
+    _myid(_team->myid()),
+    _teamspec(teamspec, _distspec, *_team),
+    _memory_layout(sizespec.extents()),
+    _nunits(_teamspec.size()),
+    _blocksize_spec(initialize_blocksizespec(
+        sizespec,
+        _distspec,
+        _teamspec)),
+    _blockspec(initialize_blockspec(
+        sizespec,
+        _blocksize_spec)),
+    _local_blockspec(),
+    _local_memory_layout(),
+    _local_capacity(0)
+  {
+    DASH_LOG_TRACE("SFCTilePattern()", "(sizespec, dist, teamspec, team)");
+    if (_teamspec.size() != _team->size()) {
+      DASH_THROW(
+        dash::exception::InvalidArgument,
+        "SFCTilePattern: size of team spec (" << _teamspec.size() << ") " <<
+        "differs from team size (" << _team->size() << ")");
+    }
+    initialize_curve();
+    initialize_local_range();
+  }
+
+  /**
+   * Constructor, initializes a pattern from explicit instances of
+   * \c SizeSpec, \c DistributionSpec and a \c Team.
+   */
+  SFCTilePattern(
+    /// SFCTilePattern size (extent, number of elements) in every dimension
+    const SizeSpec_t         & sizespec,
+    /// Distribution type (BLOCKED, CYCLIC, BLOCKCYCLIC, TILE or NONE) of
+    /// all dimensions. Defaults to BLOCKED in first, and NONE in higher
+    /// dimensions
+    const DistributionSpec_t & dist = DistributionSpec_t(),
+    /// Team containing units to which this pattern maps its elements
+    Team                     & team = dash::Team::All())
+  : _distspec(dist),
+    _team(&team),
+    _myid(_team->myid()),
+    _teamspec(_distspec, *_team),
+    _memory_layout(sizespec.extents()),
+    _nunits(_teamspec.size()),
+    _blocksize_spec(initialize_blocksizespec(
+        sizespec,
+        _distspec,
+        _teamspec)),
+    _blockspec(initialize_blockspec(
+        sizespec,
+        _blocksize_spec)),
+    _local_blockspec(),
+    _local_memory_layout(),
+    _local_capacity(0)
+  {
+    DASH_LOG_TRACE("SFCTilePattern()", "(sizespec, dist, team)");
+    initialize_curve();
+    initialize_local_range();
+  }
+
+  /**
+   * Copy constructor.
+   */
+  SFCTilePattern(const self_t & other) = default;
+
+  /**
+   * Copy constructor using non-const lvalue reference parameter.
+   *
+   * Introduced so variadic constructor is not a better match for
+   * copy-construction.
+   */
+  SFCTilePattern(self_t & other)
+  : SFCTilePattern(static_cast<const self_t &>(other))
+  { }
+
+  /**
+   * Assignment operator.
+   */
+  SFCTilePattern & operator=(const SFCTilePattern & other) = default;
+
+  /**
+   * Equality comparison operator.
+   */
+  bool operator==(
+    /// SFCTilePattern instance to compare for equality
+    const self_t & other) const
+  {
+    if (this == &other) {
+      return true;
+    }
+    // no need to compare all members as most are derived from
+    // constructor arguments.
+    return(
+      _distspec       == other._distspec &&
+      _teamspec       == other._teamspec &&
+      _memory_layout  == other._memory_layout &&
+      _blockspec      == other._blockspec &&
+      _blocksize_spec == other._blocksize_spec &&
+      _nunits         == other._nunits
+    );
+  }
+
+  /**
+   * Inquality comparison operator.
+   */
+  bool operator!=(
+    /// SFCTilePattern instance to compare for inequality
+    const self_t & other
+  ) const {
+    return !(*this == other);
+  }
+
+  /**
+   * Resolves the global index of the first local element in the pattern.
+   *
+   * \see DashPatternConcept
+   */
+  IndexType lbegin() const {
+    return _lbegin;
+  }
+
+  /**
+   * Resolves the global index past the last local element in the pattern.
+   *
+   * \see DashPatternConcept
+   */
+  IndexType lend() const {
+    return _lend;
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// unit_at
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Convert given point in pattern to its assigned unit id.
+   *
+   * \see DashPatternConcept
+   */
+  team_unit_t unit_at(
+    /// Absolute coordinates of the point relative to the given view.
+    const std::array<IndexType, NumDimensions> & coords,
+    /// View specification (offsets) of the coordinates.
+    const ViewSpec_t & viewspec) const
+  {
+    std::array<IndexType, NumDimensions> vs_coords;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      vs_coords[d] = coords[d] + viewspec.offset(d);
+    }
+    return unit_at(vs_coords);
+  }
+
+  /**
+   * Convert given coordinate in pattern to its assigned unit id.
+   *
+   * \see DashPatternConcept
+   */
+  team_unit_t unit_at(
+    const std::array<IndexType, NumDimensions> & coords) const
+  {
+    auto unit_id = unit_at_curve_pos(_block_curve_pos[block_at(coords)]);
+    DASH_LOG_TRACE("SFCTilePattern.unit_at",
+                   "coords:", coords, "> unit:", unit_id);
+    return unit_id;
+  }
+
+  /**
+   * Convert given global linear index to its assigned unit id.
+   *
+   * \see DashPatternConcept
+   */
+  team_unit_t unit_at(
+    /// Global linear element offset
+    IndexType global_pos,
+    /// View to apply global position
+    const ViewSpec_t & viewspec) const
+  {
+    auto global_coords = coords(global_pos);
+    return unit_at(global_coords, viewspec);
+  }
+
+  /**
+   * Convert given global linear index to its assigned unit id.
+   *
+   * \see DashPatternConcept
+   */
+  team_unit_t unit_at(
+    /// Global linear element offset
+    IndexType global_pos) const
+  {
+    auto global_coords = coords(global_pos);
+    return unit_at(global_coords);
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// extent
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * The number of elements in this pattern in the given dimension.
+   *
+   * \see  blocksize()
+   * \see  local_size()
+   * \see  local_extent()
+   *
+   * \see  DashPatternConcept
+   */
+  SizeType extent(dim_t dim) const {
+    if (dim >= NumDimensions || dim < 0) {
+      DASH_THROW(
+        dash::exception::OutOfRange,
+        "Wrong dimension for SFCTilePattern::extent. "
+        << "Expected dimension between 0 and " << NumDimensions-1 << ", "
+        << "got " << dim);
+    }
+    return _memory_layout.extent(dim);
+  }
+
+  /**
+   * The actual number of elements in this pattern that are local to the
+   * calling unit in the given dimension.
+   *
+   * \see  local_extents()
+   * \see  blocksize()
+   * \see  local_size()
+   * \see  extent()
+   *
+   * \see  DashPatternConcept
+   */
+  SizeType local_extent(dim_t dim) const
+  {
+    if (dim >= NumDimensions || dim < 0) {
+      DASH_THROW(
+        dash::exception::OutOfRange,
+        "Wrong dimension for SFCTilePattern::local_extent. "
+        << "Expected dimension between 0 and " << NumDimensions-1 << ", "
+        << "got " << dim);
+    }
+    return _local_memory_layout.extent(dim);
+  }
+
+  /**
+   * The actual number of elements in this pattern that are local to the
+   * given unit, by dimension.
+   *
+   * \see  local_extent()
+   * \see  blocksize()
+   * \see  local_size()
+   * \see  extent()
+   *
+   * \see  DashPatternConcept
+   */
+  std::array<SizeType, NumDimensions> local_extents(
+      team_unit_t unit = UNDEFINED_TEAM_UNIT_ID) const
+  {
+    if (unit == UNDEFINED_TEAM_UNIT_ID) {
+      unit = _myid;
+    }
+    if (unit == _myid) {
+      return _local_memory_layout.extents();
+    }
+    return initialize_local_extents(unit);
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// local
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Convert given local coordinates and viewspec to linear local offset
+   * (index).
+   *
+   * \see DashPatternConcept
+   */
+  IndexType local_at(
+    /// Point in local memory
+    const std::array<IndexType, NumDimensions> & local_coords,
+    /// View specification (local offsets) to apply on \c local_coords
+    const ViewSpec_t & viewspec) const
+  {
+    std::array<IndexType, NumDimensions> vs_coords;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      vs_coords[d] = local_coords[d] + viewspec.offset(d);
+    }
+    return local_at(vs_coords);
+  }
+
+  /**
+   * Convert given local coordinates to linear local offset (index).
+   *
+   * \see DashPatternConcept
+   */
+  IndexType local_at(
+    /// Point in local memory
+    const std::array<IndexType, NumDimensions> & local_coords) const
+  {
+    // Phase coordinates of element:
+    std::array<IndexType, NumDimensions> phase_coords{};
+    // Coordinates of the local block containing the element:
+    std::array<IndexType, NumDimensions> block_coords_l{};
+    for (auto d = 0; d < NumDimensions; ++d) {
+      auto block_size_d = _blocksize_spec.extent(d);
+      phase_coords[d]   = local_coords[d] % block_size_d;
+      block_coords_l[d] = local_coords[d] / block_size_d;
+    }
+    // Number of blocks preceeding the coordinates' block:
+    auto block_offset_l = _local_blockspec.at(block_coords_l);
+    auto local_index    =
+           block_offset_l * _blocksize_spec.size() + // preceeding blocks
+           _blocksize_spec.at(phase_coords);         // element phase
+    DASH_LOG_TRACE("SFCTilePattern.local_at",
+                   "local coords:", local_coords,
+                   "> local index:", local_index);
+    return local_index;
+  }
+
+  /**
+   * Converts global coordinates to their associated unit and its
+   * respective local coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  local_coords_t local(
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    auto curve_pos = _block_curve_pos[block_at(global_coords)];
+    local_coords_t l_coords;
+    l_coords.unit   = unit_at_curve_pos(curve_pos);
+    l_coords.coords = local_coords_in_block(
+                        curve_pos - unit_curve_begin(l_coords.unit),
+                        global_coords);
+    return l_coords;
+  }
+
+  /**
+   * Converts global index to its associated unit and respective local
+   * index.
+   *
+   * \see  DashPatternConcept
+   */
+  local_index_t local(
+    IndexType g_index) const
+  {
+    DASH_LOG_TRACE_VAR("SFCTilePattern.local()", g_index);
+    return local_index(coords(g_index));
+  }
+
+  /**
+   * Converts global coordinates to their associated unit's respective
+   * local coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  std::array<IndexType, NumDimensions> local_coords(
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    return local(global_coords).coords;
+  }
+
+  /**
+   * Resolves the unit and the local index from global coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  local_index_t local_index(
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    auto curve_pos = _block_curve_pos[block_at(global_coords)];
+    team_unit_t unit(unit_at_curve_pos(curve_pos));
+    auto l_block_index = curve_pos - unit_curve_begin(unit);
+    auto l_index       = l_block_index * _blocksize_spec.size() +
+                         _blocksize_spec.at(phase_coords(global_coords));
+    DASH_LOG_TRACE("SFCTilePattern.local_index",
+                   "global coords:", global_coords,
+                   "> unit:", unit, "local index:", l_index);
+    return local_index_t { unit, static_cast<IndexType>(l_index) };
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// global
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Converts local coordinates of a given unit to global coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  std::array<IndexType, NumDimensions> global(
+    team_unit_t unit,
+    const std::array<IndexType, NumDimensions> & local_coords) const
+  {
+    // Blocks in local memory are arranged in a one-dimensional sequence.
+    // Local blockspec has extents { n_local_blocks, 1, 1, ... }.
+    auto l_block_index  = local_coords[0] / _blocksize_spec.extent(0);
+    auto g_block_index  = _curve_block[unit_curve_begin(unit) +
+                                       l_block_index];
+    auto g_block_coords = _blockspec.coords(g_block_index);
+    // Global coordinate of local element:
+    std::array<IndexType, NumDimensions> global_coords{};
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      auto blocksize_d     = _blocksize_spec.extent(d);
+      auto phase           = local_coords[d] % blocksize_d;
+      global_coords[d]     = (g_block_coords[d] * blocksize_d) + phase;
+    }
+    DASH_LOG_TRACE("SFCTilePattern.global",
+                   "unit:", unit, "local coords:", local_coords,
+                   "> global coords:", global_coords);
+    return global_coords;
+  }
+
+  /**
+   * Converts local coordinates of a active unit to global coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  std::array<IndexType, NumDimensions> global(
+    const std::array<IndexType, NumDimensions> & local_coords) const {
+    return global(_myid, local_coords);
+  }
+
+  /**
+   * Resolve an element's linear global index from the calling unit's local
+   * index of that element.
+   *
+   * \see  at  Inverse of global()
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType global(
+    IndexType local_index) const
+  {
+    auto block_size    = _blocksize_spec.size();
+    auto phase         = local_index % block_size;
+    auto l_block_index = local_index / block_size;
+    // Coordinate of element in block:
+    auto phase_coord   = _blocksize_spec.coords(phase);
+    // Coordinate of element in local memory:
+    std::array<IndexType, NumDimensions> l_coords{};
+    for (auto d = 0; d < NumDimensions; ++d) {
+      l_coords[d] = phase_coord[d];
+    }
+    l_coords[0] += l_block_index * _blocksize_spec.extent(0);
+    auto offset = global_at(global(_myid, l_coords));
+    DASH_LOG_TRACE("SFCTilePattern.global",
+                   "local index:", local_index, "> global index:", offset);
+    return offset;
+  }
+
+  /**
+   * Resolve an element's linear global index from a given unit's local
+   * coordinates of that element.
+   *
+   * \see  at
+   * \see  global_at
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType global_index(
+    team_unit_t unit,
+    const std::array<IndexType, NumDimensions> & local_coords) const
+  {
+    return global_at(global(unit, local_coords));
+  }
+
+  /**
+   * Global coordinates and viewspec to global position in the pattern's
+   * block-wise iteration order.
+   *
+   * \see  at
+   * \see  local_at
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType global_at(
+    const std::array<IndexType, NumDimensions> & global_coords,
+    const ViewSpec_t                           & viewspec) const
+  {
+    std::array<IndexType, NumDimensions> vs_coords;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      vs_coords[d] = global_coords[d] + viewspec.offset(d);
+    }
+    return global_at(vs_coords);
+  }
+
+  /**
+   * Global coordinates to global position in the pattern's block-wise
+   * iteration order.
+   *
+   * \see  at
+   * \see  local_at
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType global_at(
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    // Number of blocks preceeding the coordinates' block, equivalent
+    // to linear global block offset:
+    auto block_index = block_at(global_coords);
+    auto offset = block_index * _blocksize_spec.size() +     // preceed. blocks
+                  _blocksize_spec.at(phase_coords(global_coords)); // phase
+    DASH_LOG_TRACE("SFCTilePattern.global_at",
+                   "global coords:", global_coords, "> offset:", offset);
+    return offset;
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// at
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Global coordinates and viewspec to local index.
+   *
+   * \see  global_at
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType at(
+    const std::array<IndexType, NumDimensions> & global_coords,
+    const ViewSpec_t                           & viewspec) const
+  {
+    std::array<IndexType, NumDimensions> vs_coords;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      vs_coords[d] = global_coords[d] + viewspec.offset(d);
+    }
+    return local_index(vs_coords).index;
+  }
+
+  /**
+   * Global coordinates to local index.
+   *
+   * Convert given global coordinates in pattern to their respective
+   * linear local index.
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType at(
+    std::array<IndexType, NumDimensions> global_coords) const
+  {
+    return local_index(global_coords).index;
+  }
+
+  /**
+   * Global coordinates to local index.
+   *
+   * Convert given coordinate in pattern to its linear local index.
+   *
+   * \see  DashPatternConcept
+   */
+  template<typename ... Values>
+  IndexType at(Values ... values) const
+  {
+    static_assert(
+      sizeof...(values) == NumDimensions,
+      "Wrong parameter number");
+    std::array<IndexType, NumDimensions> inputindex = {
+      (IndexType)values...
+    };
+    return at(inputindex);
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// is_local
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Whether there are local elements in a dimension at a given offset,
+   * e.g. in a specific row or column.
+   *
+   * \see  DashPatternConcept
+   */
+  bool has_local_elements(
+    /// Dimension to check
+    dim_t dim,
+    /// Offset in dimension
+    IndexType dim_offset,
+    /// DART id of the unit
+    team_unit_t unit,
+    /// Viewspec to apply
+    const ViewSpec_t & viewspec) const
+  {
+    // Apply viewspec offset in dimension to given position
+    dim_offset += viewspec.offset(dim);
+    IndexType block_coord_d = dim_offset / _blocksize_spec.extent(dim);
+    auto curve_end = unit_curve_begin(static_cast<IndexType>(unit.id) + 1);
+    for (auto pos = unit_curve_begin(unit); pos < curve_end; ++pos) {
+      if (static_cast<IndexType>(
+            _blockspec.coords(_curve_block[pos])[dim]) == block_coord_d) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Whether the given global index is local to the specified unit.
+   *
+   * \see  DashPatternConcept
+   */
+  bool is_local(
+    IndexType    index,
+    team_unit_t unit) const
+  {
+    return unit_at(coords(index)) == unit;
+  }
+
+  /**
+   * Whether the given global index is local to the unit that created
+   * this pattern instance.
+   *
+   * \see  DashPatternConcept
+   */
+  bool is_local(
+    IndexType index) const
+  {
+    return is_local(index, _myid);
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+  /// block
+  ////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Index of block at given global coordinates.
+   *
+   * \see  DashPatternConcept
+   */
+  index_type block_at(
+    /// Global coordinates of element
+    const std::array<index_type, NumDimensions> & g_coords) const
+  {
+    std::array<index_type, NumDimensions> block_coords;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      block_coords[d] = g_coords[d] / _blocksize_spec.extent(d);
+    }
+    return _blockspec.at(block_coords);
+  }
+
+  /**
+   * View spec (offset and extents) of block at global linear block index
+   * in global cartesian element space.
+   *
+   * \see  DashPatternConcept
+   */
+  ViewSpec_t block(
+    index_type global_block_index) const
+  {
+    auto g_block_coords = _blockspec.coords(global_block_index);
+    std::array<index_type, NumDimensions> offsets{};
+    std::array<size_type, NumDimensions>  extents{};
+    for (auto d = 0; d < NumDimensions; ++d) {
+      auto blocksize_d = _blocksize_spec.extent(d);
+      extents[d] = blocksize_d;
+      offsets[d] = g_block_coords[d] * blocksize_d;
+    }
+    auto block_vs = ViewSpec_t(offsets, extents);
+    DASH_LOG_TRACE_VAR("SFCTilePattern.block >", block_vs);
+    return block_vs;
+  }
+
+  /**
+   * View spec (offset and extents) of block at local linear block index in
+   * global cartesian element space.
+   *
+   * \see  DashPatternConcept
+   */
+  ViewSpec_t local_block(
+    index_type local_block_index) const
+  {
+    return local_block(_myid, local_block_index);
+  }
+
+  /**
+   * View spec (offset and extents) of block at local linear block index in
+   * global cartesian element space.
+   *
+   * \see  DashPatternConcept
+   */
+  ViewSpec_t local_block(
+    team_unit_t unit,
+    index_type   local_block_index) const
+  {
+    return block(_curve_block[unit_curve_begin(unit) + local_block_index]);
+  }
+
+  /**
+   * View spec (offset and extents) of block at local linear block index in
+   * local cartesian element space.
+   *
+   * \see  DashPatternConcept
+   */
+  ViewSpec_t local_block_local(
+    index_type local_block_index) const
+  {
+    std::array<index_type, NumDimensions> offsets{};
+    std::array<size_type, NumDimensions>  extents =
+      _blocksize_spec.extents();
+    offsets[0] = local_block_index * extents[0];
+    ViewSpec_t block_vs(offsets, extents);
+    DASH_LOG_TRACE_VAR("SFCTilePattern.local_block_local >", block_vs);
+    return block_vs;
+  }
+
+  /**
+   * Cartesian arrangement of pattern blocks.
+   */
+  const BlockSpec_t & blockspec() const
+  {
+    return _blockspec;
+  }
+
+  /**
+   * Cartesian arrangement of local pattern blocks.
+   */
+  const BlockSpec_t & local_blockspec() const
+  {
+    return _local_blockspec;
+  }
+
+  /**
+   * Cartesian arrangement of local pattern blocks of the given unit.
+   */
+  BlockSpec_t local_blockspec(team_unit_t unit) const
+  {
+    if (unit == _myid) {
+      return local_blockspec();
+    }
+    return initialize_local_blockspec(unit);
+  }
+
+  /**
+   * Position of the block at given global block index on the space-filling
+   * curve.
+   */
+  index_type block_curve_pos(
+    index_type global_block_index) const
+  {
+    return _block_curve_pos[global_block_index];
+  }
+
+  /**
+   * Maximum number of elements in a single block in the given dimension.
+   *
+   * \return  The blocksize in the given dimension
+   *
+   * \see     DashPatternConcept
+   */
+  SizeType blocksize(
+    /// The dimension in the pattern
+    dim_t dimension) const
+  {
+    return _blocksize_spec.extent(dimension);
+  }
+
+  /**
+   * Maximum number of elements in a single block in all dimensions.
+   *
+   * \return  The maximum number of elements in a single block assigned to
+   *          a unit.
+   *
+   * \see     DashPatternConcept
+   */
+  SizeType max_blocksize() const {
+    return _blocksize_spec.size();
+  }
+
+  /**
+   * Maximum number of elements assigned to a single unit in total,
+   * equivalent to the local capacity of every unit in this pattern.
+   *
+   * \see  DashPatternConcept
+   */
+  SizeType local_capacity() const {
+    return _local_capacity;
+  }
+
+  /**
+   * The actual number of elements in this pattern that are local to the
+   * calling unit in total.
+   *
+   * \see  blocksize()
+   * \see  local_extent()
+   * \see  local_capacity()
+   *
+   * \see  DashPatternConcept
+   */
+  SizeType local_size(team_unit_t unit = UNDEFINED_TEAM_UNIT_ID) const {
+    if (unit == UNDEFINED_TEAM_UNIT_ID) {
+      return _local_memory_layout.size();
+    }
+    return (unit_curve_begin(static_cast<IndexType>(unit.id) + 1) -
+            unit_curve_begin(unit)) * _blocksize_spec.size();
+  }
+
+  /**
+   * The number of units to which this pattern's elements are mapped.
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType num_units() const {
+    return _teamspec.size();
+  }
+
+  /**
+   * The maximum number of elements arranged in this pattern.
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType capacity() const {
+    return _memory_layout.size();
+  }
+
+  /**
+   * The number of elements arranged in this pattern.
+   *
+   * \see  DashPatternConcept
+   */
+  IndexType size() const {
+    return _memory_layout.size();
+  }
+
+  /**
+   * The Team containing the units to which this pattern's elements are
+   * mapped.
+   */
+  dash::Team & team() const {
+    return *_team;
+  }
+
+  /**
+   * Distribution specification of this pattern.
+   */
+  const DistributionSpec_t & distspec() const {
+    return _distspec;
+  }
+
+  /**
+   * Size specification of the index space mapped by this pattern.
+   *
+   * \see DashPatternConcept
+   */
+  SizeSpec_t sizespec() const {
+    return SizeSpec_t(_memory_layout.extents());
+  }
+
+  /**
+   * Size specification of the index space mapped by this pattern.
+   *
+   * \see DashPatternConcept
+   */
+  const std::array<SizeType, NumDimensions> & extents() const {
+    return _memory_layout.extents();
+  }
+
+  /**
+   * Cartesian arrangement of the Team containing the units to which this
+   * pattern's elements are mapped.
+   *
+   * \see DashPatternConcept
+   */
+  const TeamSpec_t & teamspec() const {
+    return _teamspec;
+  }
+
+  /**
+   * Convert given global linear offset (index) to global cartesian
+   * coordinates.
+   *
+   * \see DashPatternConcept
+   */
+  std::array<IndexType, NumDimensions> coords(
+    IndexType index) const {
+    std::array<IndexType, NumDimensions> pos{};
+    auto block_coords = _blockspec.coords(index / _blocksize_spec.size());
+    auto phase_coords = _blocksize_spec.coords(index % _blocksize_spec.size());
+    for (auto d = 0; d < NumDimensions; ++d) {
+      pos[d] = block_coords[d] * _blocksize_spec.extent(d) + phase_coords[d];
+    }
+    return pos;
+  }
+
+  /**
+   * Convert given global linear offset (index) to global cartesian
+   * coordinates using viewspec.
+   *
+   * \see DashPatternConcept
+   */
+  std::array<IndexType, NumDimensions> coords(
+    IndexType          index,
+    const ViewSpec_t & viewspec) const {
+    std::array<IndexType, NumDimensions> pos{};
+    auto block_coords = _blockspec.coords(index / _blocksize_spec.size(),
+                                          viewspec);
+    auto phase_coords = _blocksize_spec.coords(index % _blocksize_spec.size(),
+                                               viewspec);
+    for (auto d = 0; d < NumDimensions; ++d) {
+      pos[d] = block_coords[d] * _blocksize_spec.extent(d) + phase_coords[d];
+    }
+    return pos;
+  }
+
+  /**
+   * Space-filling curve defining the order of blocks.
+   */
+  constexpr static SFCurve curve() {
+    return Curve;
+  }
+
+  /**
+   * Memory order followed by the pattern.
+   */
+  constexpr static MemArrange memory_order() {
+    return Arrangement;
+  }
+
+  /**
+   * Number of dimensions of the cartesian space partitioned by the
+   * pattern.
+   */
+  constexpr static dim_t ndim() {
+    return NumDimensions;
+  }
+
+private:
+
+  SFCTilePattern(const PatternArguments_t & arguments)
+  : _distspec(arguments.distspec()),
+    _team(&arguments.team()),
+    _myid(_team->myid()),
+    _teamspec(arguments.teamspec()),
+    _memory_layout(arguments.sizespec().extents()),
+    _nunits(_teamspec.size()),
+    _blocksize_spec(initialize_blocksizespec(
+        arguments.sizespec(),
+        _distspec,
+        _teamspec)),
+    _blockspec(initialize_blockspec(
+        arguments.sizespec(),
+        _blocksize_spec)),
+    _local_blockspec(),
+    _local_memory_layout(),
+    _local_capacity(0)
+  {
+    initialize_curve();
+  }
+
+  /**
+   * Coordinates of an element within its block.
+   */
+  std::array<IndexType, NumDimensions> phase_coords(
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    std::array<IndexType, NumDimensions> phase{};
+    for (auto d = 0; d < NumDimensions; ++d) {
+      phase[d] = global_coords[d] % _blocksize_spec.extent(d);
+    }
+    return phase;
+  }
+
+  /**
+   * Local coordinates of an element at given global coordinates in the
+   * local block at given local block index.
+   */
+  std::array<IndexType, NumDimensions> local_coords_in_block(
+    IndexType                                    l_block_index,
+    const std::array<IndexType, NumDimensions> & global_coords) const
+  {
+    auto l_coords = phase_coords(global_coords);
+    l_coords[0]  += l_block_index * _blocksize_spec.extent(0);
+    return l_coords;
+  }
+
+  /**
+   * Position on the curve of the first block assigned to the given unit.
+   * Unit \c u is assigned the curve segment
+   * <tt>[u * nblocks / nunits, (u+1) * nblocks / nunits)</tt>.
+   */
+  IndexType unit_curve_begin(team_unit_t unit) const
+  {
+    return unit_curve_begin(static_cast<IndexType>(unit.id));
+  }
+
+  IndexType unit_curve_begin(IndexType unit) const
+  {
+    return static_cast<IndexType>(
+             (static_cast<SizeType>(unit) * _blockspec.size()) / _nunits);
+  }
+
+  /**
+   * Unit assigned to the block at the given position on the curve, the
+   * inverse of \c unit_curve_begin.
+   */
+  team_unit_t unit_at_curve_pos(IndexType curve_pos) const
+  {
+    SizeType nblocks = _blockspec.size();
+    return team_unit_t(static_cast<dart_unit_t>(
+             ((curve_pos + 1) * _nunits + nblocks - 1) / nblocks - 1));
+  }
+
+  /**
+   * Initialize block size specs from memory layout, team spec and
+   * distribution spec.
+   */
+  BlockSizeSpec_t initialize_blocksizespec(
+    const SizeSpec_t         & sizespec,
+    const DistributionSpec_t & distspec,
+    const TeamSpec_t         & teamspec) const
+  {
+    // Extents of a single block:
+    std::array<SizeType, NumDimensions> s_blocks{};
+    for (auto d = 0; d < NumDimensions; ++d) {
+      const Distribution & dist = distspec[d];
+      s_blocks[d] = dist.max_blocksize_in_range(
+                      sizespec.extent(d),  // size of range (extent)
+                      teamspec.extent(d)); // number of blocks (units)
+      if (s_blocks[d] == 0 || sizespec.extent(d) % s_blocks[d] != 0) {
+        DASH_THROW(
+          dash::exception::InvalidArgument,
+          "SFCTilePattern requires the extent in every dimension to be " <<
+          "a multiple of the block size, got extent " <<
+          sizespec.extent(d) << " and block size " << s_blocks[d] <<
+          " in dimension " << d);
+      }
+    }
+    DASH_LOG_TRACE_VAR("SFCTilePattern.init_blocksizespec >", s_blocks);
+    return BlockSizeSpec_t(s_blocks);
+  }
+
+  /**
+   * Initialize block spec from memory layout and block size spec.
+   */
+  BlockSpec_t initialize_blockspec(
+    const SizeSpec_t         & sizespec,
+    const BlockSizeSpec_t    & blocksizespec) const
+  {
+    // Number of blocks in all dimensions:
+    std::array<SizeType, NumDimensions> n_blocks{};
+    for (auto d = 0; d < NumDimensions; ++d) {
+      n_blocks[d] = sizespec.extent(d) / blocksizespec.extent(d);
+    }
+    DASH_LOG_TRACE_VAR("SFCTilePattern.init_blockspec >", n_blocks);
+    return BlockSpec_t(n_blocks);
+  }
+
+  /**
+   * Order all blocks along the space-filling curve and initialize the
+   * local layout of the active unit.
+   *
+   * Blocks are ordered by their position on the curve in the smallest
+   * hypercube with power-of-two extents containing all blocks.
+   */
+  void initialize_curve()
+  {
+    SizeType max_blocks_d = 1;
+    for (auto d = 0; d < NumDimensions; ++d) {
+      max_blocks_d = std::max(max_blocks_d, _blockspec.extent(d));
+    }
+    int bits = 1;
+    while ((SizeType(1) << bits) < max_blocks_d) {
+      ++bits;
+    }
+    SizeType nblocks = _blockspec.size();
+    std::vector<std::pair<uint64_t, IndexType>> keys;
+    keys.reserve(nblocks);
+    for (SizeType b = 0; b < nblocks; ++b) {
+      auto block_coords = _blockspec.coords(b);
+      auto key = (Curve == SFCurve::HILBERT)
+                 ? internal::sfc_hilbert_key<NumDimensions>(block_coords, bits)
+                 : internal::sfc_morton_key<NumDimensions>(block_coords, bits);
+      keys.emplace_back(key, static_cast<IndexType>(b));
+    }
+    std::sort(keys.begin(), keys.end());
+
+    _block_curve_pos.resize(nblocks);
+    _curve_block.resize(nblocks);
+    for (SizeType pos = 0; pos < nblocks; ++pos) {
+      _curve_block[pos]                     = keys[pos].second;
+      _block_curve_pos[keys[pos].second]    = static_cast<IndexType>(pos);
+    }
+
+    _local_blockspec     = initialize_local_blockspec(_myid);
+    _local_memory_layout = LocalMemoryLayout_t(
+                             initialize_local_extents(_myid));
+    // The first units are assigned one more block than the others:
+    _local_capacity      = dash::math::div_ceil(nblocks, _nunits) *
+                           _blocksize_spec.size();
+  }
+
+  /**
+   * Initialize local block spec of the given unit. Local blocks are
+   * arranged in a one-dimensional sequence in the order of the curve.
+   */
+  BlockSpec_t initialize_local_blockspec(
+    team_unit_t unit_id) const
+  {
+    std::array<SizeType, NumDimensions> l_blocks{};
+    l_blocks[0] = unit_curve_begin(static_cast<IndexType>(unit_id.id) + 1) -
+                  unit_curve_begin(unit_id);
+    for (auto d = 1; d < NumDimensions; ++d) {
+      l_blocks[d] = 1;
+    }
+    DASH_LOG_TRACE_VAR("SFCTilePattern.init_local_blockspec >", l_blocks);
+    return BlockSpec_t(l_blocks);
+  }
+
+  /**
+   * Initialize pointer to begin and end of local index range.
+   */
+  void initialize_local_range()
+  {
+    auto local_size = _local_memory_layout.size();
+    if (local_size == 0) {
+      _lbegin = 0;
+      _lend   = 0;
+    } else {
+      // First local index transformed to global index
+      _lbegin = global(0);
+      // Index past last local index transformed to global index
+      _lend   = global(local_size - 1) + 1;
+    }
+    DASH_LOG_DEBUG("SFCTilePattern.init_local_range >",
+                   "local extents:", _local_memory_layout.extents(),
+                   "lbegin:",        _lbegin,
+                   "lend:",          _lend);
+  }
+
+  /**
+   * Resolve extents of local memory layout for a specified unit.
+   */
+  std::array<SizeType, NumDimensions> initialize_local_extents(
+      team_unit_t unit) const
+  {
+    auto l_blockspec = initialize_local_blockspec(unit);
+    std::array<SizeType, NumDimensions> l_extents{};
+    for (auto d = 0; d < NumDimensions; ++d) {
+      l_extents[d] = _blocksize_spec.extent(d) * l_blockspec.extent(d);
+    }
+    DASH_LOG_DEBUG_VAR("SFCTilePattern.init_local_extents >", l_extents);
+    return l_extents;
+  }
+};
+
+template<
+  dim_t      ND,
+  SFCurve    Cu,
+  MemArrange Ar,
+  typename   Index>
+std::ostream & operator<<(
+  std::ostream                            & os,
+  const SFCTilePattern<ND,Cu,Ar,Index>    & pattern)
+{
+  typedef Index index_t;
+
+  dim_t ndim = pattern.ndim();
+
+  std::string storage_order = pattern.memory_order() == ROW_MAJOR
+                              ? "ROW_MAJOR"
+                              : "COL_MAJOR";
+  std::string curve         = pattern.curve() == SFCurve::HILBERT
+                              ? "HILBERT"
+                              : "MORTON";
+
+  std::array<index_t, ND> blocksize;
+  for (dim_t d = 0; d < ND; ++d) {
+    blocksize[d] = pattern.blocksize(d);
+  }
+
+  std::ostringstream ss;
+  ss << "dash::"
+     << SFCTilePattern<ND,Cu,Ar,Index>::PatternName
+     << "<"
+     << ndim << ","
+     << curve << ","
+     << storage_order << ","
+     << typeid(index_t).name()
+     << ">"
+     << "("
+     << "SizeSpec:"  << pattern.sizespec().extents()  << ", "
+     << "TeamSpec:"  << pattern.teamspec().extents()  << ", "
+     << "BlockSpec:" << pattern.blockspec().extents() << ", "
+     << "BlockSize:" << blocksize
+     << ")";
+
+  return operator<<(os, ss.str());
+}
+
+} // namespace dash
+
+#endif // DASH__SFC_TILE_PATTERN_H_
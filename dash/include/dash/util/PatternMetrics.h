@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <array>
+#include <iterator>
+#include <numeric>
 #include <vector>
 
 
@@ -18,6 +20,8 @@ private:
   typedef typename PatternT::index_type index_t;
   typedef typename PatternT::size_type  extent_t;
 
+  static constexpr dim_t NumDimensions = PatternT::ndim();
+
 public:
 
   PatternMetrics(const PatternT & pattern)
@@ -87,30 +91,79 @@ public:
     return _unit_blocks[unit];
   }
 
+  /**
+   * Number of units mapped to blocks adjacent to a block of the given unit,
+   * i.e. the number of units the given unit exchanges halo elements with
+   * in a nearest-neighbor stencil.
+   */
+  constexpr int unit_neighbors(dash::team_unit_t unit) const noexcept {
+    return _unit_neighbors[unit];
+  }
+
+  /**
+   * Maximum number of neighbors of any unit.
+   *
+   * \see unit_neighbors
+   */
+  constexpr int max_neighbors_per_unit() const noexcept {
+    return _max_neighbors;
+  }
+
+  /**
+   * Number of elements in the faces between blocks of the given unit and
+   * adjacent blocks of other units, i.e. the number of halo elements
+   * received by the unit in a nearest-neighbor stencil of width 1.
+   */
+  constexpr int unit_comm_volume(dash::team_unit_t unit) const noexcept {
+    return _unit_comm_volume[unit];
+  }
+
+  /**
+   * Maximum communication volume of any unit.
+   *
+   * \see unit_comm_volume
+   */
+  constexpr int max_comm_volume_per_unit() const noexcept {
+    return _max_comm_volume;
+  }
+
+  /**
+   * Communication volume of all units.
+   *
+   * \see unit_comm_volume
+   */
+  constexpr int comm_volume() const noexcept {
+    return _comm_volume;
+  }
+
 private:
   /**
    * Calculate mapping balancing metrics of given pattern instance.
    */
   void init_metrics(const PatternT & pattern)
   {
-    _num_blocks   = pattern.blockspec().size();
+    const auto & blockspec = pattern.blockspec();
+    _num_blocks   = blockspec.size();
 
     size_t nunits = pattern.teamspec().size();
-    _unit_blocks.resize(nunits);
+    _unit_blocks.assign(nunits, 0);
 
-    for (size_t u = 0; u < nunits; ++u) {
-      _unit_blocks[u] = 0;
-    }
+    std::vector<int> block_units(_num_blocks);
     for (int bi = 0; bi < _num_blocks; ++bi) {
       auto block      = pattern.block(bi);
-      auto block_unit = pattern.unit_at(std::array<index_t, 2> {{
-                          block.offset(0),
-                          block.offset(1)
-			    }});
+      std::array<index_t, NumDimensions> block_offsets;
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        block_offsets[d] = block.offset(d);
+      }
+      auto block_unit = pattern.unit_at(block_offsets);
+      block_units[bi] = block_unit;
       _unit_blocks[block_unit]++;
     }
 
-    _block_size      = pattern.blocksize(0) * pattern.blocksize(1);
+    _block_size      = 1;
+    for (dim_t d = 0; d < NumDimensions; ++d) {
+      _block_size *= pattern.blocksize(d);
+    }
     _min_blocks      = *std::min_element(_unit_blocks.begin(),
                                          _unit_blocks.begin() + nunits);
     _max_blocks      = *std::max_element(_unit_blocks.begin(),
@@ -124,20 +177,79 @@ private:
                                     _unit_blocks.begin() + nunits,
                                     _max_blocks);
 
+    init_neighbor_metrics(pattern, block_units);
+
     int min_elements = _min_blocks * _block_size;
     int max_elements = _max_blocks * _block_size;
     _imb_factor = static_cast<float>(max_elements) /
                   static_cast<float>(min_elements);
   }
 
+  /**
+   * Calculate neighbor and communication metrics from the faces between
+   * adjacent blocks mapped to different units.
+   */
+  void init_neighbor_metrics(
+    const PatternT         & pattern,
+    const std::vector<int> & block_units)
+  {
+    const auto & blockspec = pattern.blockspec();
+    size_t nunits = pattern.teamspec().size();
+
+    std::vector<std::vector<int>> neighbors(nunits);
+    _unit_comm_volume.assign(nunits, 0);
+    for (int bi = 0; bi < _num_blocks; ++bi) {
+      auto block        = pattern.block(bi);
+      auto block_coords = blockspec.coords(bi);
+      int  unit         = block_units[bi];
+      for (dim_t d = 0; d < NumDimensions; ++d) {
+        // Count every face once from the block with lower coordinates:
+        if (block_coords[d] + 1 >= blockspec.extent(d)) {
+          continue;
+        }
+        auto nb_coords = block_coords;
+        nb_coords[d]++;
+        int  nb_unit   = block_units[blockspec.at(nb_coords)];
+        if (nb_unit == unit) {
+          continue;
+        }
+        int face_size = block.size() / block.extent(d);
+        _unit_comm_volume[unit]    += face_size;
+        _unit_comm_volume[nb_unit] += face_size;
+        neighbors[unit].push_back(nb_unit);
+        neighbors[nb_unit].push_back(unit);
+      }
+    }
+
+    _unit_neighbors.assign(nunits, 0);
+    for (size_t u = 0; u < nunits; ++u) {
+      auto & unit_nbs = neighbors[u];
+      std::sort(unit_nbs.begin(), unit_nbs.end());
+      _unit_neighbors[u] = std::distance(
+                             unit_nbs.begin(),
+                             std::unique(unit_nbs.begin(), unit_nbs.end()));
+    }
+    _max_neighbors   = *std::max_element(_unit_neighbors.begin(),
+                                         _unit_neighbors.end());
+    _max_comm_volume = *std::max_element(_unit_comm_volume.begin(),
+                                         _unit_comm_volume.end());
+    _comm_volume     = std::accumulate(_unit_comm_volume.begin(),
+                                       _unit_comm_volume.end(), 0);
+  }
+
 private:
   std::vector<int> _unit_blocks;
+  std::vector<int> _unit_neighbors;
+  std::vector<int> _unit_comm_volume;
   int              _num_blocks    = 0;
   int              _block_size    = 0;
   int              _min_blocks    = 0;
   int              _max_blocks    = 0;
   int              _num_imb_units = 0;
   int              _num_bal_units = 0;
+  int              _max_neighbors = 0;
+  int              _max_comm_volume = 0;
+  int              _comm_volume   = 0;
   double           _imb_factor    = 0.0;
 };
 
@@ -0,0 +1,35 @@
+#ifndef DASH__UTIL__STATIC_CONFIG_H__INCLUDED
+#define DASH__UTIL__STATIC_CONFIG_H__INCLUDED
+
+/*
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * !!!!! ----------- AUTO-GENERATED FILE - DO NOT EDIT ----------------!!!!!
+ * !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ *
+ *       Do not modify the auto-generated file `StaticConfig.h`,
+ *       ensure to edit the header template `StaticConfig.h.in`.
+ */
+
+namespace dash {
+namespace util {
+
+  static struct StaticConfig {
+    bool avail_papi            = false;
+    bool avail_hwloc           = true;
+    bool avail_likwid          = false;
+    bool avail_numa            = true;
+    bool avail_plasma          = false;
+    bool avail_hdf5            = false;
+    bool avail_mkl             = false;
+    bool avail_blas            = true;
+    bool avail_lapack          = true;
+    bool avail_scalapack       = false;
+    bool avail_memkind         = false;
+    /* Available Algorithms */
+    bool avail_algo_summa      = true;
+  } DashConfig;
+
+}
+}
+
+#endif // DASH__UTIL__STATIC_CONFIG_H__INCLUDED
@@ -0,0 +1,333 @@
+#ifndef DASH__VECTOR__GLOB_VECTOR_ITER_H__INCLUDED
+#define DASH__VECTOR__GLOB_VECTOR_ITER_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/GlobRef.h>
+
+#include <dash/internal/Logging.h>
+
+#include <iterator>
+#include <sstream>
+#include <iostream>
+
+
+namespace dash {
+
+/**
+ * Random access global iterator on elements of a \c dash::Vector instance.
+ *
+ * Positions in global index space are resolved to the referenced element's
+ * unit and local offset from the cumulative local sizes of all units that
+ * have been published in the last call of \c dash::Vector::commit.
+ *
+ * \concept{DashVectorConcept}
+ * \concept{DashGlobalIteratorConcept}
+ */
+template<
+  typename ElementType,
+  class    VectorType,
+  class    ReferenceType = GlobRef<ElementType> >
+class GlobVectorIter
+: public std::iterator<
+           std::random_access_iterator_tag,
+           ElementType,
+           dash::default_index_t,
+           GlobVectorIter<ElementType, VectorType, ReferenceType>,
+           ReferenceType >
+{
+  template<typename E_, class V_, class R_>
+  friend class GlobVectorIter;
+
+  template<typename E_, class V_, class R_>
+  friend std::ostream & operator<<(
+    std::ostream & os,
+    const GlobVectorIter<E_, V_, R_> & it);
+
+private:
+  typedef GlobVectorIter<ElementType, VectorType, ReferenceType>
+    self_t;
+
+  typedef typename std::conditional<
+            std::is_const<ElementType>::value,
+            const VectorType,
+            VectorType >::type
+    vector_type;
+
+public:
+  typedef ElementType                                            value_type;
+  typedef dash::default_index_t                                  index_type;
+  typedef dash::default_index_t                             difference_type;
+  typedef dash::default_size_t                                    size_type;
+
+  typedef       ReferenceType                                     reference;
+  typedef GlobRef<const typename std::remove_const<ElementType>::type>
+    const_reference;
+
+  typedef self_t                                                    pointer;
+
+  typedef struct {
+    team_unit_t unit;
+    index_type  index;
+  } local_index;
+
+public:
+  typedef std::integral_constant<bool, false>                      has_view;
+
+public:
+  /**
+   * Default constructor.
+   */
+  GlobVectorIter() = default;
+
+  /**
+   * Constructor, creates a global iterator on a \c dash::Vector instance
+   * at the given position in global index space.
+   */
+  GlobVectorIter(
+    vector_type * vec,
+    index_type    position)
+  : _vector(vec),
+    _idx(position)
+  {
+    DASH_LOG_TRACE("GlobVectorIter(vec,idx)", "gidx:", position);
+  }
+
+  /**
+   * Copy constructor.
+   */
+  GlobVectorIter(
+    const self_t & other) = default;
+
+  /**
+   * Assignment operator.
+   */
+  self_t & operator=(
+    const self_t & other) = default;
+
+  /**
+   * Conversion to iterator on const elements.
+   */
+  template<class R_>
+  operator GlobVectorIter<const ElementType, VectorType, R_>() const
+  {
+    return GlobVectorIter<const ElementType, VectorType, R_>(_vector, _idx);
+  }
+
+  /**
+   * Explicit conversion to \c dart_gptr_t.
+   *
+   * \return  A DART global pointer to the element at the iterator's
+   *          position
+   */
+  dart_gptr_t dart_gptr() const
+  {
+    return _vector->dart_gptr_at(_idx);
+  }
+
+  /**
+   * Dereference operator.
+   *
+   * \return  A global reference to the element at the iterator's position.
+   */
+  reference operator*() const
+  {
+    return reference(dart_gptr());
+  }
+
+  /**
+   * Subscript operator, returns global reference to element at given
+   * offset relative to the iterator's position.
+   */
+  reference operator[](
+    /// The offset relative to the iterator's position
+    index_type offset) const
+  {
+    return reference(_vector->dart_gptr_at(_idx + offset));
+  }
+
+  /**
+   * Checks whether the element referenced by this global iterator is in
+   * the calling unit's local memory.
+   */
+  inline bool is_local() const
+  {
+    return lpos().unit == _vector->team().myid();
+  }
+
+  /**
+   * Unit and local offset at the iterator's position.
+   */
+  inline local_index lpos() const
+  {
+    auto l_pos = _vector->local_index_at(_idx);
+    local_index local_pos;
+    local_pos.unit  = l_pos.first;
+    local_pos.index = l_pos.second;
+    return local_pos;
+  }
+
+  /**
+   * Map iterator to global index domain.
+   */
+  inline const self_t & global() const noexcept
+  {
+    return *this;
+  }
+
+  /**
+   * Position of the iterator in global index space.
+   */
+  constexpr index_type pos() const noexcept
+  {
+    return _idx;
+  }
+
+  /**
+   * Position of the iterator in global index range.
+   */
+  constexpr index_type gpos() const noexcept
+  {
+    return _idx;
+  }
+
+  /**
+   * Prefix increment operator.
+   */
+  inline self_t & operator++() noexcept
+  {
+    ++_idx;
+    return *this;
+  }
+
+  /**
+   * Prefix decrement operator.
+   */
+  inline self_t & operator--() noexcept
+  {
+    --_idx;
+    return *this;
+  }
+
+  /**
+   * Postfix increment operator.
+   */
+  inline self_t operator++(int) noexcept
+  {
+    auto result = *this;
+    ++_idx;
+    return result;
+  }
+
+  /**
+   * Postfix decrement operator.
+   */
+  inline self_t operator--(int) noexcept
+  {
+    auto result = *this;
+    --_idx;
+    return result;
+  }
+
+  inline self_t & operator+=(index_type offset) noexcept
+  {
+    _idx += offset;
+    return *this;
+  }
+
+  inline self_t & operator-=(index_type offset) noexcept
+  {
+    _idx -= offset;
+    return *this;
+  }
+
+  inline self_t operator+(index_type offset) const noexcept
+  {
+    return self_t(_vector, _idx + offset);
+  }
+
+  inline self_t operator-(index_type offset) const noexcept
+  {
+    return self_t(_vector, _idx - offset);
+  }
+
+  inline index_type operator-(const self_t & other) const noexcept
+  {
+    return _idx - other._idx;
+  }
+
+  template<typename E_, class V_, class R_>
+  inline bool operator<(const GlobVectorIter<E_, V_, R_> & other) const
+  {
+    return (_idx < other._idx);
+  }
+
+  template<typename E_, class V_, class R_>
+  inline bool operator<=(const GlobVectorIter<E_, V_, R_> & other) const
+  {
+    return (_idx <= other._idx);
+  }
+
+  template<typename E_, class V_, class R_>
+  inline bool operator>(const GlobVectorIter<E_, V_, R_> & other) const
+  {
+    return (_idx > other._idx);
+  }
+
+  template<typename E_, class V_, class R_>
+  inline bool operator>=(const GlobVectorIter<E_, V_, R_> & other) const
+  {
+    return (_idx >= other._idx);
+  }
+
+  template<typename E_, class V_, class R_>
+  inline bool operator==(const GlobVectorIter<E_, V_, R_> & other) const
+  {
+    return _idx == other._idx;
+  }
+
+  template<typename E_, class V_, class R_>
+  inline bool operator!=(const GlobVectorIter<E_, V_, R_> & other) const
+  {
+    return _idx != other._idx;
+  }
+
+private:
+  /// The vector referenced by the iterator.
+  vector_type * _vector = nullptr;
+  /// Current position of the iterator in global canonical index space.
+  index_type    _idx    = 0;
+
+}; // class GlobVectorIter
+
+/**
+ * Resolve the number of elements between two global vector iterators.
+ *
+ * \complexity  O(1)
+ *
+ * \ingroup     Algorithms
+ */
+template<typename ElementType, class VectorType, class ReferenceType>
+auto distance(
+  /// Global iterator to the first position in the global sequence
+  const dash::GlobVectorIter<ElementType, VectorType, ReferenceType> & first,
+  /// Global iterator to the final position in the global sequence
+  const dash::GlobVectorIter<ElementType, VectorType, ReferenceType> & last)
+-> typename VectorType::index_type
+{
+  return last - first;
+}
+
+template<typename ElementType, class VectorType, class ReferenceType>
+std::ostream & operator<<(
+  std::ostream & os,
+  const dash::GlobVectorIter<ElementType, VectorType, ReferenceType> & it)
+{
+  std::ostringstream ss;
+  ss << "dash::GlobVectorIter<" << typeid(ElementType).name() << ">("
+     << "gidx:" << it._idx << ")";
+  return operator<<(os, ss.str());
+}
+
+} // namespace dash
+
+#endif // DASH__VECTOR__GLOB_VECTOR_ITER_H__INCLUDED
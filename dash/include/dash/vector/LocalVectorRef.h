@@ -0,0 +1,227 @@
+#ifndef DASH__VECTOR__LOCAL_VECTOR_REF_H__INCLUDED
+#define DASH__VECTOR__LOCAL_VECTOR_REF_H__INCLUDED
+
+#include <dash/Types.h>
+#include <dash/Exception.h>
+
+#include <dash/internal/Logging.h>
+
+#include <iterator>
+#include <utility>
+
+
+namespace dash {
+
+// forward declaration
+template<
+  typename ElementType,
+  typename LocalMemorySpace >
+class Vector;
+
+/**
+ * Proxy type representing a local view on a referenced \c dash::Vector.
+ *
+ * All operations of the local view are local to the calling unit and do
+ * not communicate.
+ *
+ * \concept{DashVectorConcept}
+ */
+template<
+  typename T,
+  class    LMemSpace >
+class LocalVectorRef
+{
+  template <typename T_, typename LM_>
+  friend class LocalVectorRef;
+
+private:
+  typedef LocalVectorRef<T, LMemSpace>
+    self_t;
+  typedef Vector<T, LMemSpace>
+    vector_type;
+
+/// Type definitions required for std::vector concept:
+public:
+  typedef T                                                       value_type;
+  typedef typename vector_type::index_type                        index_type;
+  typedef typename vector_type::size_type                          size_type;
+  typedef typename vector_type::index_type                   difference_type;
+
+  typedef typename vector_type::local_reference                    reference;
+  typedef typename vector_type::const_local_reference        const_reference;
+
+  typedef typename vector_type::local_iterator                      iterator;
+  typedef typename vector_type::const_local_iterator          const_iterator;
+
+  typedef std::reverse_iterator<      iterator>             reverse_iterator;
+  typedef std::reverse_iterator<const_iterator>       const_reverse_iterator;
+
+public:
+  /**
+   * Constructor, creates a local access proxy for the given vector.
+   */
+  LocalVectorRef(
+    vector_type * vec)
+  : _vector(vec)
+  { }
+
+  /**
+   * Iterator to initial local element in the vector.
+   */
+  inline iterator begin() const noexcept
+  {
+    return _vector->lbegin();
+  }
+
+  /**
+   * Iterator past final local element in the vector.
+   */
+  inline iterator end() const noexcept
+  {
+    return _vector->lend();
+  }
+
+  /**
+   * Inserts a new element at the end of the local elements.
+   * The content of \c value is copied to the inserted element.
+   * Increases the local size by one.
+   *
+   * Local operation, the new element is visible to other units after the
+   * next call of \c dash::Vector::commit.
+   *
+   * \complexity  Amortized O(1), local capacity is increased
+   *              geometrically.
+   */
+  inline void push_back(const value_type & value)
+  {
+    _vector->local_push_back(value);
+  }
+
+  /**
+   * Constructs a new element in place at the end of the local elements.
+   * Increases the local size by one.
+   *
+   * Local operation, the new element is visible to other units after the
+   * next call of \c dash::Vector::commit.
+   *
+   * \complexity  Amortized O(1), local capacity is increased
+   *              geometrically.
+   */
+  template<typename... Args>
+  inline void emplace_back(Args &&... args)
+  {
+    _vector->local_emplace_back(std::forward<Args>(args)...);
+  }
+
+  /**
+   * Removes the last local element, reducing the local size by one.
+   * Does not release local capacity.
+   */
+  inline void pop_back()
+  {
+    DASH_ASSERT_GT(size(), 0, "pop_back on empty local range");
+    _vector->local_resize(size() - 1);
+  }
+
+  /**
+   * Accesses the first local element.
+   */
+  inline reference front()
+  {
+    return (*this)[0];
+  }
+
+  /**
+   * Accesses the last local element.
+   */
+  inline reference back()
+  {
+    return (*this)[size() - 1];
+  }
+
+  /**
+   * Subscript operator, access to local element at given local offset.
+   */
+  inline reference operator[](index_type local_index)
+  {
+    return _vector->lbegin()[local_index];
+  }
+
+  /**
+   * Subscript operator, access to local element at given local offset.
+   */
+  inline const_reference operator[](index_type local_index) const
+  {
+    return _vector->lbegin()[local_index];
+  }
+
+  /**
+   * Ensures that the local capacity is at least the given number of
+   * elements.
+   */
+  inline void reserve(size_type lcap)
+  {
+    _vector->local_reserve(lcap);
+  }
+
+  /**
+   * Changes the number of local elements. New elements are not
+   * initialized.
+   */
+  inline void resize(size_type lsize)
+  {
+    _vector->local_resize(lsize);
+  }
+
+  /**
+   * Removes all local elements. Does not release local capacity.
+   */
+  inline void clear()
+  {
+    _vector->local_resize(0);
+  }
+
+  /**
+   * Number of vector elements in local memory.
+   */
+  inline size_type size() const noexcept
+  {
+    return _vector->lsize();
+  }
+
+  /**
+   * Number of vector elements that can be held in currently allocated
+   * local memory.
+   */
+  inline size_type capacity() const noexcept
+  {
+    return _vector->lcapacity();
+  }
+
+  /**
+   * Whether the local range is empty.
+   */
+  inline bool empty() const noexcept
+  {
+    return size() == 0;
+  }
+
+  /**
+   * Checks whether the given global index is local to the calling unit.
+   */
+  inline bool is_local(
+    /// A global vector index
+    index_type global_index) const
+  {
+    return _vector->local_index_at(global_index).first
+             == _vector->team().myid();
+  }
+
+private:
+  /// Pointer to vector instance referenced by this view.
+  vector_type * const _vector;
+};
+
+} // namespace dash
+
+#endif // DASH__VECTOR__LOCAL_VECTOR_REF_H__INCLUDED
@@ -42,6 +42,7 @@ namespace dash {
 #include <dash/Onesided.h>
 
 #include <dash/LaunchPolicy.h>
+#include <dash/Execution.h>
 
 #include <dash/Container.h>
 #include <dash/Shared.h>
@@ -54,6 +55,8 @@ namespace dash {
 #include <dash/Pattern.h>
 
 #include <dash/halo/HaloMatrixWrapper.h>
+#include <dash/halo/HaloMatrixGroup.h>
+#include <dash/halo/GhostExchange.h>
 
 #include <dash/util/BenchmarkParams.h>
 #include <dash/util/Config.h>
@@ -0,0 +1,118 @@
+
+#include "AsyncReduceTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/AllOf.h>
+#include <dash/algorithm/AnyOf.h>
+#include <dash/algorithm/Equal.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/Find.h>
+#include <dash/algorithm/MinMax.h>
+#include <dash/algorithm/Reduce.h>
+
+#include <cstdint>
+
+
+TEST_F(AsyncReduceTest, ReduceTestAndWait)
+{
+  dash::Array<int64_t> array(num_local_elem * dash::size());
+  dash::fill(array.begin(), array.end(), 2);
+  array.barrier();
+
+  int64_t const n = array.size();
+  auto fut_sum = dash::reduce_async(array.begin(), array.end(), int64_t(3));
+  auto fut_max = dash::reduce_async(array.begin(), array.end(), int64_t(0),
+                                    dash::max<int64_t>());
+  // Overlap with local work until the reduction is completed:
+  int64_t local_sum = 0;
+  while (!fut_sum.test()) {
+    for (auto lit = array.lbegin(); lit != array.lend(); ++lit) {
+      local_sum += *lit;
+    }
+  }
+  EXPECT_EQ_U(3 + 2 * n, fut_sum.get());
+  EXPECT_EQ_U(2, fut_max.get());
+}
+
+TEST_F(AsyncReduceTest, ReduceCustomOperation)
+{
+  dash::Array<int> array(num_local_elem * dash::size());
+  auto lidx = 0;
+  for (auto lit = array.lbegin(); lit != array.lend(); ++lit, ++lidx) {
+    *lit = static_cast<int>(array.pattern().global(lidx));
+  }
+  array.barrier();
+
+  // Range in the first unit's local range only
+  auto fut_max = dash::reduce_async(
+                   array.begin() + 3, array.begin() + num_local_elem - 1, 0,
+                   [](int a, int b) { return std::max(a, b); });
+  EXPECT_EQ_U(static_cast<int>(num_local_elem - 2), fut_max.get());
+}
+
+TEST_F(AsyncReduceTest, MinMaxElement)
+{
+  dash::Array<int> array(num_local_elem * dash::size());
+  dash::fill(array.begin(), array.end(), 5);
+  array.barrier();
+
+  auto last_unit = dash::size() - 1;
+  if (dash::myid() == last_unit) {
+    array.local[num_local_elem / 2] = 1;
+    array.local[num_local_elem - 1] = 9;
+  }
+  if (dash::myid() == 0) {
+    array.local[3] = 9;
+  }
+  array.barrier();
+
+  auto fut_min = dash::min_element_async(array.begin(), array.end());
+  auto fut_max = dash::max_element_async(array.begin(), array.end());
+  auto g_min   = fut_min.get();
+  auto g_max   = fut_max.get();
+  EXPECT_EQ_U(last_unit * num_local_elem + num_local_elem / 2,
+              g_min - array.begin());
+  // First occurrence of the maximum
+  EXPECT_EQ_U(3, g_max - array.begin());
+  EXPECT_EQ_U(1, static_cast<int>(*g_min));
+
+  auto fut_empty = dash::min_element_async(array.begin(), array.begin());
+  EXPECT_EQ_U(array.begin(), fut_empty.get());
+}
+
+TEST_F(AsyncReduceTest, FindEqualAllOf)
+{
+  dash::Array<int> a(num_local_elem * dash::size());
+  dash::Array<int> b(num_local_elem * dash::size());
+  dash::fill(a.begin(), a.end(), 0);
+  dash::fill(b.begin(), b.end(), 0);
+  a.barrier();
+
+  EXPECT_TRUE_U(dash::equal_async(a.begin(), a.end(), b.begin()).get());
+  EXPECT_TRUE_U(dash::all_of_async(a.begin(), a.end(),
+                                   [](int v) { return v == 0; }).get());
+  EXPECT_FALSE_U(dash::any_of_async(a.begin(), a.end(),
+                                    [](int v) { return v != 0; }).get());
+  EXPECT_EQ_U(a.end(), dash::find_async(a.begin(), a.end(), 42).get());
+  a.barrier();
+
+  auto last_unit = dash::size() - 1;
+  if (dash::myid() == last_unit) {
+    a.local[num_local_elem - 5] = 42;
+  }
+  a.barrier();
+
+  auto fut_found   = dash::find_async(a.begin(), a.end(), 42);
+  auto fut_not     = dash::find_if_not_async(a.begin(), a.end(),
+                                             [](int v) { return v == 0; });
+  auto fut_equal   = dash::equal_async(a.begin(), a.end(), b.begin());
+  auto fut_all     = dash::all_of_async(a.begin(), a.end(),
+                                        [](int v) { return v == 0; });
+  auto fut_any     = dash::any_of_async(a.begin(), a.end(),
+                                        [](int v) { return v == 42; });
+  EXPECT_EQ_U(a.size() - 5, fut_found.get() - a.begin());
+  EXPECT_EQ_U(a.size() - 5, fut_not.get() - a.begin());
+  EXPECT_FALSE_U(fut_equal.get());
+  EXPECT_FALSE_U(fut_all.get());
+  EXPECT_TRUE_U(fut_any.get());
+}
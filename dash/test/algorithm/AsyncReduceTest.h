@@ -0,0 +1,15 @@
+#ifndef DASH__TEST__ASYNC_REDUCE_TEST_H_
+#define DASH__TEST__ASYNC_REDUCE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for the asynchronous variants of reducing algorithms
+ * like dash::reduce_async and dash::min_element_async
+ */
+class AsyncReduceTest : public dash::test::TestBase {
+protected:
+  size_t const num_local_elem = 100;
+};
+
+#endif // DASH__TEST__ASYNC_REDUCE_TEST_H_
@@ -1082,3 +1082,109 @@ TEST_F(CopyTest, InputOutputTypeTest)
   ASSERT_TRUE_U((dash::internal::is_dash_copyable<const point_t, point_t>::value));
 
 }
+
+TEST_F(CopyTest, BlockingGlobalToGlobal)
+{
+  const size_t num_elem_per_unit = 40;
+  size_t num_elem_total          = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> src(num_elem_total, dash::BLOCKED);
+  dash::Array<int> dst(num_elem_total, dash::BLOCKCYCLIC(3));
+
+  auto lidx = 0;
+  for (auto lit = src.lbegin(); lit != src.lend(); ++lit, ++lidx) {
+    *lit = static_cast<int>(src.pattern().global(lidx));
+  }
+  dash::fill(dst.begin(), dst.end(), -1);
+  dash::barrier();
+
+  // Unaligned ranges, shifted by 3 elements in the destination:
+  auto in_first = src.begin() + 5;
+  auto in_last  = src.end() - 7;
+  auto out_last = dash::copy(in_first, in_last, dst.begin() + 2);
+  EXPECT_EQ_U(dst.begin() + 2 + (num_elem_total - 12), out_last);
+
+  if (dash::myid() == 0) {
+    for (size_t g = 0; g < num_elem_total; ++g) {
+      int expected = (g < 2 || g >= num_elem_total - 10)
+                     ? -1
+                     : static_cast<int>(g + 3);
+      ASSERT_EQ_U(expected, static_cast<int>(dst[g]));
+    }
+  }
+  dash::barrier();
+}
+
+TEST_F(CopyTest, BlockingGlobalToGlobalTiles)
+{
+  typedef dash::TilePattern<2>                                 tile_pattern_t;
+  typedef dash::Matrix<int, 2>                                 src_matrix_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, tile_pattern_t>
+                                                               dst_matrix_t;
+
+  size_t tilesize = 2;
+  size_t extent   = 2 * tilesize * _dash_size;
+
+  src_matrix_t src(extent, extent);
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  dst_matrix_t dst(dash::SizeSpec<2>(extent, extent),
+                   dash::DistributionSpec<2>(dash::TILE(tilesize),
+                                             dash::TILE(tilesize)),
+                   dash::Team::All(), teamspec);
+
+  auto lidx = 0;
+  for (auto lit = src.lbegin(); lit != src.lend(); ++lit, ++lidx) {
+    *lit = static_cast<int>(src.pattern().global(lidx));
+  }
+  dash::fill(dst.begin(), dst.end(), -1);
+  dash::barrier();
+
+  dash::copy(src.begin(), src.end(), dst.begin());
+
+  if (dash::myid() == 0) {
+    for (size_t g = 0; g < src.size(); ++g) {
+      ASSERT_EQ_U(static_cast<int>(src.begin()[g]),
+                  static_cast<int>(dst.begin()[g]));
+    }
+  }
+  dash::barrier();
+}
+
+TEST_F(CopyTest, AsyncGlobalToGlobalPipelined)
+{
+  const size_t num_elem_per_unit = 100;
+  size_t num_elem_total          = _dash_size * num_elem_per_unit;
+
+  dash::Array<int> src(num_elem_total, dash::BLOCKED);
+  dash::Array<int> dst(num_elem_total, dash::CYCLIC);
+
+  auto lidx = 0;
+  for (auto lit = src.lbegin(); lit != src.lend(); ++lit, ++lidx) {
+    *lit = static_cast<int>(src.pattern().global(lidx)) * 2;
+  }
+  dash::barrier();
+
+  // Single-element chunks with at most 4 pending transfers:
+  std::vector<dart_handle_t> handles;
+  dash::internal::copy_impl(src.begin(), src.end(), dst.begin(), &handles, 4);
+  EXPECT_LE_U(handles.size(), 4);
+  dash::internal::copy_waitall(handles);
+  dash::barrier();
+  lidx = 0;
+  for (auto lit = dst.lbegin(); lit != dst.lend(); ++lit, ++lidx) {
+    ASSERT_EQ_U(static_cast<int>(dst.pattern().global(lidx)) * 2, *lit);
+  }
+  dash::barrier();
+
+  dash::fill(dst.begin(), dst.end(), 0);
+  dash::barrier();
+
+  auto fut_last = dash::copy_async(src.begin(), src.end(), dst.begin());
+  EXPECT_EQ_U(dst.end(), fut_last.get());
+  dash::barrier();
+  lidx = 0;
+  for (auto lit = dst.lbegin(); lit != dst.lend(); ++lit, ++lidx) {
+    ASSERT_EQ_U(static_cast<int>(dst.pattern().global(lidx)) * 2, *lit);
+  }
+}
@@ -0,0 +1,227 @@
+
+#include "ExecutionPolicyTest.h"
+
+#include <dash/Array.h>
+#include <dash/Execution.h>
+#include <dash/algorithm/Count.h>
+#include <dash/algorithm/Equal.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/Find.h>
+#include <dash/algorithm/ForEach.h>
+#include <dash/algorithm/Generate.h>
+#include <dash/algorithm/Operation.h>
+#include <dash/algorithm/Transform.h>
+#include <dash/algorithm/TransformReduce.h>
+
+#include <cmath>
+#include <cstdint>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+TEST_F(ExecutionPolicyTest, IsExecutionPolicy)
+{
+  static_assert(dash::execution::is_execution_policy<
+                  dash::execution::sequenced_policy>::value, "");
+  static_assert(dash::execution::is_execution_policy<
+                  dash::execution::parallel_policy>::value, "");
+  static_assert(dash::execution::is_execution_policy<
+                  dash::execution::parallel_unsequenced_policy>::value, "");
+  static_assert(!dash::execution::is_execution_policy<int>::value, "");
+  EXPECT_EQ_U(1, dash::internal::execution_num_threads(
+                   dash::execution::seq, num_local_elem));
+}
+
+TEST_F(ExecutionPolicyTest, FillForEachGenerate)
+{
+  dash::Array<int64_t> array(num_local_elem * dash::size());
+
+  auto check = [&](auto policy) {
+    dash::fill(policy, array.begin(), array.end(), 3);
+    array.barrier();
+    dash::for_each(policy, array.begin(), array.end(),
+                   [](int64_t & v) { v *= 2; });
+    for (auto lit = array.lbegin(); lit != array.lend(); ++lit) {
+      ASSERT_EQ_U(6, *lit);
+    }
+    array.barrier();
+
+    dash::generate(policy, array.begin(), array.end(),
+                   []() { return int64_t(7); });
+    array.barrier();
+    for (auto lit = array.lbegin(); lit != array.lend(); ++lit) {
+      ASSERT_EQ_U(7, *lit);
+    }
+    array.barrier();
+  };
+  check(dash::execution::seq);
+  check(dash::execution::par);
+  check(dash::execution::par_unseq);
+}
+
+TEST_F(ExecutionPolicyTest, FindAndCount)
+{
+  dash::Array<int> array(num_local_elem * dash::size());
+  dash::fill(array.begin(), array.end(), 0);
+  array.barrier();
+
+  // Matches in the last unit, near the end of its local range:
+  auto last_unit = dash::size() - 1;
+  if (dash::myid() == last_unit) {
+    array.local[num_local_elem - 5] = 42;
+    array.local[num_local_elem - 2] = 42;
+  }
+  array.barrier();
+
+  auto check = [&](auto policy) {
+    auto found = dash::find(policy, array.begin(), array.end(), 42);
+    EXPECT_EQ_U(array.size() - 5, found - array.begin());
+
+    auto not_zero = dash::find_if_not(policy, array.begin(), array.end(),
+                                      [](int v) { return v == 0; });
+    EXPECT_EQ_U(array.size() - 5, not_zero - array.begin());
+
+    auto missing = dash::find(policy, array.begin(), array.end(), 7);
+    EXPECT_EQ_U(array.end(), missing);
+
+    auto num_equal = dash::count(policy, array.begin(), array.end(), 42);
+    EXPECT_EQ_U(2, num_equal);
+    auto num_less  = dash::count_if(policy, array.begin(), array.end(),
+                                    [](int v) { return v < 42; });
+    EXPECT_EQ_U(array.size() - 2, num_less);
+  };
+  check(dash::execution::seq);
+  check(dash::execution::par);
+  check(dash::execution::par_unseq);
+
+  EXPECT_EQ_U(2, dash::count(array.begin(), array.end(), 42));
+}
+
+#ifdef DASH_ENABLE_OPENMP
+TEST_F(ExecutionPolicyTest, FindFewerThreadsGranted)
+{
+  size_t const nelem = 8 * EXECUTION_MIN_NELEM_PER_THREAD + 3;
+  size_t const match = nelem - 2;
+
+  // The nested parallel region of the local search is granted a single
+  // thread, fewer than requested
+  auto max_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(1);
+  size_t first = 0;
+  #pragma omp parallel num_threads(1)
+  {
+    first = dash::internal::execution_find_first(
+              dash::execution::par, nelem,
+              [match](size_t i) { return i >= match; });
+  }
+  omp_set_max_active_levels(max_levels);
+  EXPECT_EQ_U(match, first);
+}
+#endif // DASH_ENABLE_OPENMP
+
+TEST_F(ExecutionPolicyTest, Equal)
+{
+  dash::Array<double> a(num_local_elem * dash::size());
+  dash::Array<double> b(num_local_elem * dash::size());
+  dash::fill(a.begin(), a.end(), 1.5);
+  dash::fill(b.begin(), b.end(), 1.5);
+  a.barrier();
+
+  EXPECT_TRUE_U(dash::equal(dash::execution::par,
+                            a.begin(), a.end(), b.begin()));
+
+  if (dash::myid() == 0) {
+    b.local[num_local_elem - 1] = 2.0;
+  }
+  b.barrier();
+  EXPECT_FALSE_U(dash::equal(dash::execution::par,
+                             a.begin(), a.end(), b.begin()));
+  auto near_equal = dash::equal(dash::execution::par_unseq,
+                                a.begin(), a.end(), b.begin(),
+                                [](double x, double y) {
+                                  return std::abs(x - y) <= 0.5;
+                                });
+  EXPECT_TRUE_U(near_equal);
+}
+
+TEST_F(ExecutionPolicyTest, TransformAndReduce)
+{
+  dash::Array<int64_t> a(num_local_elem * dash::size());
+  dash::Array<int64_t> b(num_local_elem * dash::size());
+  dash::Array<int64_t> c(num_local_elem * dash::size());
+  dash::fill(a.begin(), a.end(), 2);
+  dash::fill(b.begin(), b.end(), 5);
+  a.barrier();
+
+  auto out = dash::transform(dash::execution::par,
+                             a.begin(), a.end(), b.begin(), c.begin(),
+                             dash::plus<int64_t>());
+  EXPECT_EQ_U(c.end(), out);
+  c.barrier();
+  for (auto lit = c.lbegin(); lit != c.lend(); ++lit) {
+    ASSERT_EQ_U(7, *lit);
+  }
+
+  int64_t const n = c.size();
+  auto sum = dash::transform_reduce(
+               dash::execution::seq, c.begin(), c.end(), int64_t(0),
+               dash::plus<int64_t>(), [](int64_t v) { return v; });
+  EXPECT_EQ_U(7 * n, sum);
+  EXPECT_EQ_U(10 * n, dash::transform_reduce(
+                        dash::execution::par_unseq,
+                        a.begin(), a.end(), b.begin(), int64_t(0),
+                        dash::plus<int64_t>(), dash::multiply<int64_t>()));
+}
+
+TEST_F(ExecutionPolicyTest, TransformLambda)
+{
+  typedef int64_t value_t;
+  auto nelem = num_local_elem * dash::size();
+  dash::Array<value_t> a(nelem);
+  dash::Array<value_t> b(nelem);
+  dash::Array<value_t> c(nelem);
+  // Output range with different distribution:
+  dash::Array<value_t> d(nelem, dash::BLOCKCYCLIC(3));
+  for (size_t l = 0; l < a.lsize(); ++l) {
+    auto g = a.pattern().global(l);
+    a.local[l] = g;
+    b.local[l] = 2 * g;
+  }
+  a.barrier();
+
+  auto mult = [](value_t x, value_t y) { return x * y; };
+
+  // Identical distribution, transformed in local memory:
+  auto out = dash::transform(dash::execution::par,
+                             a.begin(), a.end(), b.begin(), c.begin(),
+                             mult);
+  EXPECT_EQ_U(c.end(), out);
+  // Different distribution, every unit computes its local output elements:
+  out = dash::transform(dash::execution::seq,
+                        a.begin(), a.end(), b.begin(), d.begin(), mult);
+  EXPECT_EQ_U(d.end(), out);
+  d.barrier();
+
+  for (size_t l = 0; l < c.lsize(); ++l) {
+    value_t g = c.pattern().global(l);
+    ASSERT_EQ_U(2 * g * g, c.local[l]);
+  }
+  for (size_t l = 0; l < d.lsize(); ++l) {
+    value_t g = d.pattern().global(l);
+    ASSERT_EQ_U(2 * g * g, d.local[l]);
+  }
+  d.barrier();
+
+  // DART operation on different distribution with output range distinct
+  // from the second input range:
+  dash::transform(dash::execution::par,
+                  a.begin(), a.end(), b.begin(), d.begin(),
+                  dash::plus<value_t>());
+  d.barrier();
+  for (size_t l = 0; l < d.lsize(); ++l) {
+    value_t g = d.pattern().global(l);
+    ASSERT_EQ_U(3 * g, d.local[l]);
+  }
+}
@@ -0,0 +1,18 @@
+#ifndef DASH__TEST__EXECUTION_POLICY_TEST_H_
+#define DASH__TEST__EXECUTION_POLICY_TEST_H_
+
+#include "../TestBase.h"
+
+#include <dash/Execution.h>
+
+/**
+ * Test fixture for algorithms invoked with execution policies
+ * dash::execution::seq, par and par_unseq
+ */
+class ExecutionPolicyTest : public dash::test::TestBase {
+protected:
+  // Large enough for the local elements to be split among threads
+  size_t const num_local_elem = 4 * EXECUTION_MIN_NELEM_PER_THREAD + 3;
+};
+
+#endif // DASH__TEST__EXECUTION_POLICY_TEST_H_
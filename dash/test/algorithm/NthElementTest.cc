@@ -0,0 +1,153 @@
+
+#include "NthElementTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/NthElement.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+
+template <typename ValueType, typename Distribution>
+static std::vector<ValueType> fill_random(
+  dash::Array<ValueType> & array, Distribution distribution)
+{
+  std::mt19937 generator(1234 + dash::myid());
+  for (auto lit = array.lbegin(); lit != array.lend(); ++lit) {
+    *lit = static_cast<ValueType>(distribution(generator));
+  }
+  array.barrier();
+  std::vector<ValueType> values(array.size());
+  dash::copy(array.begin(), array.end(), values.data());
+  array.barrier();
+  return values;
+}
+
+TEST_F(NthElementTest, Median)
+{
+  dash::Array<int64_t> array(num_local_elem * dash::size());
+  auto values = fill_random(
+      array, std::uniform_int_distribution<int64_t>(-100000, 100000));
+  auto const orig = values;
+
+  for (auto const pos : { size_t(0), array.size() / 2, array.size() - 1 }) {
+    auto expected = values;
+    std::nth_element(expected.begin(), expected.begin() + pos,
+                     expected.end());
+
+    auto const nth = dash::nth_element(
+        array.begin(), array.begin() + pos, array.end());
+    EXPECT_EQ_U(expected[pos], nth);
+  }
+
+  // The range is not modified
+  std::vector<int64_t> after(array.size());
+  dash::copy(array.begin(), array.end(), after.data());
+  EXPECT_TRUE_U(orig == after);
+}
+
+TEST_F(NthElementTest, DuplicatesAndPercentiles)
+{
+  dash::Array<double> array(num_local_elem * dash::size());
+  auto values = fill_random(
+      array, std::uniform_int_distribution<int>(0, 20));
+  std::sort(values.begin(), values.end());
+
+  std::vector<size_t> positions;
+  for (size_t p = 0; p <= 100; p += 10) {
+    positions.push_back(std::min(p * array.size() / 100, array.size() - 1));
+  }
+  std::vector<double> percentiles(positions.size());
+  auto out = dash::nth_elements(
+      array.begin(), array.end(), positions.begin(), positions.end(),
+      percentiles.begin());
+  EXPECT_EQ_U(percentiles.end(), out);
+  for (size_t i = 0; i < positions.size(); ++i) {
+    EXPECT_EQ_U(values[positions[i]], percentiles[i]);
+  }
+}
+
+TEST_F(NthElementTest, PartialSortCopy)
+{
+  dash::Array<int32_t> array(num_local_elem * dash::size());
+  auto values = fill_random(
+      array, std::uniform_int_distribution<int32_t>(-50, 50));
+  std::sort(values.begin(), values.end());
+
+  size_t const k = std::min(num_local_elem + 7, array.size());
+  std::vector<int32_t> smallest(k);
+  auto out = dash::partial_sort_copy(
+      array.begin(), array.end(), smallest.begin(), smallest.end());
+  EXPECT_EQ_U(smallest.end(), out);
+  for (size_t i = 0; i < k; ++i) {
+    EXPECT_EQ_U(values[i], smallest[i]);
+  }
+}
+
+TEST_F(NthElementTest, TopK)
+{
+  dash::Array<uint32_t> array(num_local_elem * dash::size());
+  auto values = fill_random(
+      array, std::uniform_int_distribution<uint32_t>(0, 1000));
+  std::sort(values.begin(), values.end(), std::greater<uint32_t>());
+
+  size_t const k = 10;
+  std::vector<uint32_t> largest(k);
+  dash::top_k(array.begin(), array.end(), k, largest.begin());
+  for (size_t i = 0; i < k; ++i) {
+    EXPECT_EQ_U(values[i], largest[i]);
+  }
+}
+
+TEST_F(NthElementTest, TopKWithSortableHash)
+{
+  struct item_t {
+    int32_t key;
+    int32_t origin;
+  };
+  dash::Array<item_t> array(num_local_elem * dash::size());
+
+  std::mt19937 generator(42 + dash::myid());
+  std::uniform_int_distribution<int32_t> distribution(-50, 50);
+  auto lidx = 0;
+  for (auto lit = array.lbegin(); lit != array.lend(); ++lit, ++lidx) {
+    lit->key    = distribution(generator);
+    lit->origin = static_cast<int32_t>(array.pattern().global(lidx));
+  }
+  array.barrier();
+  std::vector<item_t> values(array.size());
+  dash::copy(array.begin(), array.end(), values.data());
+  std::stable_sort(values.begin(), values.end(),
+                   [](const item_t & a, const item_t & b) {
+                     return b.key < a.key;
+                   });
+  array.barrier();
+
+  size_t const k = std::min(3 * num_local_elem / 2, array.size());
+  std::vector<item_t> largest(k);
+  dash::top_k(array.begin(), array.end(), k, largest.begin(),
+              [](const item_t & item) { return item.key; });
+  for (size_t i = 0; i < k; ++i) {
+    EXPECT_EQ_U(values[i].key, largest[i].key);
+  }
+  // Every element is selected at most once
+  std::vector<int32_t> origins;
+  for (auto const & item : largest) {
+    origins.push_back(item.origin);
+  }
+  std::sort(origins.begin(), origins.end());
+  EXPECT_TRUE_U(
+      std::adjacent_find(origins.begin(), origins.end()) == origins.end());
+}
+
+TEST_F(NthElementTest, OutOfRange)
+{
+  dash::Array<int32_t> array(num_local_elem * dash::size());
+  EXPECT_THROW(
+      dash::nth_element(array.begin(), array.end(), array.end()),
+      dash::exception::OutOfRange);
+}
@@ -0,0 +1,15 @@
+#ifndef DASH__TEST__NTH_ELEMENT_TEST_H__INCLUDED
+#define DASH__TEST__NTH_ELEMENT_TEST_H__INCLUDED
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::nth_element, dash::partial_sort_copy
+ * and dash::top_k
+ */
+class NthElementTest : public dash::test::TestBase {
+protected:
+  size_t const num_local_elem = 1000;
+};
+
+#endif // DASH__TEST__NTH_ELEMENT_TEST_H__INCLUDED
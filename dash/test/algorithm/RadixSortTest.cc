@@ -0,0 +1,200 @@
+
+#include "RadixSortTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Copy.h>
+#include <dash/algorithm/RadixSort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+template <typename ValueType, typename Distribution>
+static std::vector<ValueType> fill_random(
+  dash::Array<ValueType> & array, Distribution distribution)
+{
+  std::mt19937 generator(1234 + dash::myid());
+  for (auto lit = array.lbegin(); lit != array.lend(); ++lit) {
+    *lit = static_cast<ValueType>(distribution(generator));
+  }
+  array.barrier();
+  // Expected result from sorting a copy of all values
+  std::vector<ValueType> values(array.size());
+  dash::copy(array.begin(), array.end(), values.data());
+  array.barrier();
+  return values;
+}
+
+template <typename ValueType>
+static void expect_equal_values(
+  dash::Array<ValueType> & array, const std::vector<ValueType> & expected)
+{
+  std::vector<ValueType> values(array.size());
+  dash::copy(array.begin(), array.end(), values.data());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ_U(expected[i], values[i]);
+  }
+  array.barrier();
+}
+
+TEST_F(RadixSortTest, SignedIntegers)
+{
+  dash::Array<int32_t> array(num_local_elem * dash::size());
+  auto expected = fill_random(
+      array, std::uniform_int_distribution<int32_t>(-1000000, 1000000));
+  std::sort(expected.begin(), expected.end());
+
+  dash::radix_sort(array.begin(), array.end());
+
+  expect_equal_values(array, expected);
+}
+
+TEST_F(RadixSortTest, ExtremeValues)
+{
+  dash::Array<int64_t> array(num_local_elem * dash::size());
+  auto expected = fill_random(
+      array, std::uniform_int_distribution<int64_t>(
+               std::numeric_limits<int64_t>::min(),
+               std::numeric_limits<int64_t>::max()));
+  if (dash::myid() == 0) {
+    array.local[0] = std::numeric_limits<int64_t>::min();
+    array.local[1] = std::numeric_limits<int64_t>::max();
+    array.local[2] = 0;
+    array.local[3] = -1;
+  }
+  array.barrier();
+  std::vector<int64_t> values(array.size());
+  dash::copy(array.begin(), array.end(), values.data());
+  expected = values;
+  std::sort(expected.begin(), expected.end());
+  array.barrier();
+
+  dash::radix_sort(array.begin(), array.end());
+
+  expect_equal_values(array, expected);
+}
+
+TEST_F(RadixSortTest, Doubles)
+{
+  dash::Array<double> array(num_local_elem * dash::size());
+  auto expected = fill_random(
+      array, std::uniform_real_distribution<double>(-1.0e6, 1.0e6));
+  if (dash::myid() == 0) {
+    array.local[0] = -0.0;
+    array.local[1] = std::numeric_limits<double>::lowest();
+    array.local[2] = std::numeric_limits<double>::max();
+    array.local[3] = std::numeric_limits<double>::min();
+  }
+  array.barrier();
+  std::vector<double> values(array.size());
+  dash::copy(array.begin(), array.end(), values.data());
+  expected = values;
+  std::sort(expected.begin(), expected.end());
+  array.barrier();
+
+  dash::radix_sort(array.begin(), array.end());
+
+  std::vector<double> sorted(array.size());
+  dash::copy(array.begin(), array.end(), sorted.data());
+  EXPECT_TRUE_U(std::is_sorted(sorted.begin(), sorted.end()));
+  for (size_t i = 0; i < expected.size(); ++i) {
+    // -0.0 and 0.0 compare equal but have different keys
+    EXPECT_EQ_U(expected[i], sorted[i]);
+  }
+}
+
+TEST_F(RadixSortTest, PartialRange)
+{
+  dash::Array<uint32_t> array(num_local_elem * dash::size());
+  auto values = fill_random(
+      array, std::uniform_int_distribution<uint32_t>(0, 1000));
+  auto expected = values;
+  auto first    = num_local_elem / 2;
+  auto last     = array.size() - num_local_elem / 3;
+  std::sort(expected.begin() + first, expected.begin() + last);
+
+  dash::radix_sort(array.begin() + first, array.begin() + last);
+
+  expect_equal_values(array, expected);
+}
+
+TEST_F(RadixSortTest, StableWithSortableHash)
+{
+  struct item_t {
+    int32_t key;
+    int32_t origin;
+  };
+  dash::Array<item_t> array(num_local_elem * dash::size());
+
+  std::mt19937 generator(42 + dash::myid());
+  std::uniform_int_distribution<int32_t> distribution(-50, 50);
+  auto lidx = 0;
+  for (auto lit = array.lbegin(); lit != array.lend(); ++lit, ++lidx) {
+    lit->key    = distribution(generator);
+    lit->origin = static_cast<int32_t>(array.pattern().global(lidx));
+  }
+  array.barrier();
+  std::vector<item_t> expected(array.size());
+  dash::copy(array.begin(), array.end(), expected.data());
+  std::stable_sort(expected.begin(), expected.end(),
+                   [](const item_t & a, const item_t & b) {
+                     return a.key < b.key;
+                   });
+  array.barrier();
+
+  dash::radix_sort(array.begin(), array.end(),
+                   [](const item_t & item) { return item.key; });
+
+  std::vector<item_t> sorted(array.size());
+  dash::copy(array.begin(), array.end(), sorted.data());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ_U(expected[i].key,    sorted[i].key);
+    EXPECT_EQ_U(expected[i].origin, sorted[i].origin);
+  }
+}
+
+TEST_F(RadixSortTest, KeyValuePairs)
+{
+  auto nelem = num_local_elem * dash::size();
+  dash::Array<uint64_t> keys(nelem);
+  dash::Array<int64_t>  values(nelem);
+
+  auto expected_keys = fill_random(
+      keys, std::uniform_int_distribution<uint64_t>());
+  auto lidx = 0;
+  for (auto lit = values.lbegin(); lit != values.lend(); ++lit, ++lidx) {
+    *lit = static_cast<int64_t>(values.pattern().global(lidx));
+  }
+  values.barrier();
+  std::sort(expected_keys.begin(), expected_keys.end());
+
+  std::vector<uint64_t> orig_keys(nelem);
+  dash::copy(keys.begin(), keys.end(), orig_keys.data());
+  keys.barrier();
+
+  dash::radix_sort_by_key(keys.begin(), keys.end(), values.begin());
+
+  expect_equal_values(keys, expected_keys);
+  std::vector<int64_t> sorted_values(nelem);
+  dash::copy(values.begin(), values.end(), sorted_values.data());
+  for (size_t i = 0; i < nelem; ++i) {
+    // values are the original positions of their keys
+    EXPECT_EQ_U(expected_keys[i], orig_keys[sorted_values[i]]);
+  }
+}
+
+TEST_F(RadixSortTest, ConstantKeys)
+{
+  dash::Array<int32_t> array(num_local_elem * dash::size());
+  std::fill(array.lbegin(), array.lend(), 7);
+  array.barrier();
+
+  dash::radix_sort(array.begin(), array.end());
+
+  for (auto lit = array.lbegin(); lit != array.lend(); ++lit) {
+    EXPECT_EQ_U(7, *lit);
+  }
+}
@@ -0,0 +1,14 @@
+#ifndef DASH__TEST__RADIX_SORT_TEST_H__INCLUDED
+#define DASH__TEST__RADIX_SORT_TEST_H__INCLUDED
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithm dash::radix_sort
+ */
+class RadixSortTest : public dash::test::TestBase {
+protected:
+  size_t const num_local_elem = 1000;
+};
+
+#endif // DASH__TEST__RADIX_SORT_TEST_H__INCLUDED
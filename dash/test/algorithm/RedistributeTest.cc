@@ -0,0 +1,146 @@
+
+#include "RedistributeTest.h"
+
+#include <dash/Matrix.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/Redistribute.h>
+#include <dash/pattern/SeqTilePattern.h>
+#include <dash/pattern/ShiftTilePattern.h>
+#include <dash/pattern/TilePattern.h>
+
+#include <cstdint>
+
+
+namespace {
+
+template <class MatrixT>
+void init_by_coords(MatrixT & matrix, int offset)
+{
+  auto & pattern = matrix.pattern();
+  auto   ncols   = static_cast<int>(matrix.extent(1));
+  for (size_t lidx = 0; lidx < pattern.local_size(); ++lidx) {
+    auto coords = pattern.coords(pattern.global(lidx));
+    matrix.lbegin()[lidx] = offset +
+                            static_cast<int>(coords[0]) * ncols +
+                            static_cast<int>(coords[1]);
+  }
+  matrix.barrier();
+}
+
+template <class MatrixT>
+int num_errors_by_coords(MatrixT & matrix, int offset)
+{
+  auto & pattern = matrix.pattern();
+  auto   ncols   = static_cast<int>(matrix.extent(1));
+  int    errors  = 0;
+  for (size_t lidx = 0; lidx < pattern.local_size(); ++lidx) {
+    auto coords = pattern.coords(pattern.global(lidx));
+    int  expect = offset +
+                  static_cast<int>(coords[0]) * ncols +
+                  static_cast<int>(coords[1]);
+    errors += (matrix.lbegin()[lidx] != expect) ? 1 : 0;
+  }
+  return errors;
+}
+
+} // namespace
+
+TEST_F(RedistributeTest, BlockedRowsToTiles)
+{
+  typedef dash::TilePattern<2>                                 tile_pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, tile_pattern_t>
+                                                               tile_matrix_t;
+
+  // Blocked rows are not aligned to tiles:
+  size_t extent_y = tilesize * (2 * dash::size() + 1);
+  size_t extent_x = tilesize * 3 * dash::size() + 2 * tilesize;
+
+  dash::Matrix<int, 2> rows(extent_y, extent_x);
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  tile_matrix_t tiles(dash::SizeSpec<2>(extent_y, extent_x),
+                      dash::DistributionSpec<2>(dash::TILE(tilesize),
+                                                dash::TILE(tilesize)),
+                      dash::Team::All(), teamspec);
+  dash::fill(tiles.begin(), tiles.end(), -1);
+  init_by_coords(rows, 0);
+
+  dash::redistribute(rows, tiles);
+  EXPECT_EQ_U(0, num_errors_by_coords(tiles, 0));
+
+  // And back:
+  dash::fill(rows.begin(), rows.end(), -1);
+  dash::redistribute(tiles, rows);
+  EXPECT_EQ_U(0, num_errors_by_coords(rows, 0));
+}
+
+TEST_F(RedistributeTest, ReuseSchedule)
+{
+  typedef dash::ShiftTilePattern<2>                           shift_pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, shift_pattern_t>
+                                                              shift_matrix_t;
+
+  size_t extent = tilesize * dash::size() * 2;
+
+  dash::Matrix<int, 2> src(dash::SizeSpec<2>(extent, extent),
+                           dash::DistributionSpec<2>(dash::BLOCKCYCLIC(tilesize),
+                                                     dash::NONE));
+  dash::TeamSpec<2> teamspec;
+  shift_matrix_t dst(dash::SizeSpec<2>(extent, extent),
+                     dash::DistributionSpec<2>(dash::TILE(tilesize),
+                                               dash::TILE(tilesize)),
+                     dash::Team::All(), teamspec);
+
+  dash::RedistributeSchedule<
+      typename dash::Matrix<int, 2>::pattern_type,
+      shift_pattern_t>
+    schedule(src.pattern(), dst.pattern());
+
+  // Rows in the intersection with a destination tile are combined to a
+  // single strided transfer:
+  EXPECT_LE_U(schedule.transfers().size(),
+              src.pattern().local_extent(0) / tilesize * (extent / tilesize));
+
+  for (int iter = 0; iter < 3; ++iter) {
+    init_by_coords(src, iter * 100000);
+    dash::redistribute(src, dst, schedule);
+    EXPECT_EQ_U(0, num_errors_by_coords(dst, iter * 100000));
+  }
+}
+
+TEST_F(RedistributeTest, TilesToSeqTiles)
+{
+  typedef dash::TilePattern<2>                                 tile_pattern_t;
+  typedef dash::SeqTilePattern<2>                               seq_pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, tile_pattern_t>
+                                                               tile_matrix_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, seq_pattern_t>
+                                                               seq_matrix_t;
+
+  size_t extent = tilesize * 2 * dash::size();
+  dash::SizeSpec<2> sizespec(extent, extent);
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+
+  tile_matrix_t tiles(sizespec,
+                      dash::DistributionSpec<2>(dash::TILE(tilesize),
+                                                dash::TILE(tilesize)),
+                      dash::Team::All(), teamspec);
+  seq_matrix_t  seq_tiles(sizespec,
+                          dash::DistributionSpec<2>(dash::TILE(2 * tilesize),
+                                                    dash::TILE(tilesize)),
+                          dash::Team::All(), dash::TeamSpec<2>());
+  init_by_coords(tiles, 7);
+
+  dash::redistribute(tiles, seq_tiles);
+  EXPECT_EQ_U(0, num_errors_by_coords(seq_tiles, 7));
+}
+
+TEST_F(RedistributeTest, ExtentsMismatch)
+{
+  dash::Matrix<int, 2> a(2 * dash::size(), 4);
+  dash::Matrix<int, 2> b(2 * dash::size(), 5);
+  EXPECT_THROW(
+    dash::redistribute(a, b),
+    dash::exception::InvalidArgument);
+}
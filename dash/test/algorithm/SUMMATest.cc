@@ -4,9 +4,13 @@
 #include <dash/Matrix.h>
 #include <dash/Meta.h>
 #include <dash/algorithm/SUMMA.h>
+#include <dash/algorithm/SUMMA25D.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/internal/Gemm.h>
 
 #include <iomanip>
 #include <sstream>
+#include <vector>
 
 #define SKIP_TEST_IF_NO_SUMMA()           \
   auto conf = dash::util::DashConfig;     \
@@ -117,6 +121,15 @@ TEST_F(SUMMATest, Deduction)
   dash::Matrix<value_t, 2, index_t, decltype(pattern)> matrix_b(pattern);
   dash::Matrix<value_t, 2, index_t, decltype(pattern)> matrix_c(pattern);
 
+  // Team specs with a single unit in one dimension, e.g. for 2 units,
+  // yield non-square tiles which are not supported by dash::summa:
+  if (pattern.block(0).extent(0) != pattern.block(0).extent(1)) {
+    EXPECT_THROW(
+      dash::mmult(matrix_a, matrix_b, matrix_c),
+      dash::exception::InvalidArgument);
+    SKIP_TEST_MSG("dash::summa requires square tiles");
+  }
+
   LOG_MESSAGE("Starting initialization of matrix values");
   dash::barrier();
 
@@ -275,3 +288,132 @@ TEST_F(SUMMATest, SeqTilePatternMatrix)
 
   dash::barrier();
 }
+
+TEST_F(SUMMATest, LocalGemmKernel)
+{
+  // Extents not divisible by register and cache block sizes:
+  long long m = 37;
+  long long n = 45;
+  long long k = 300;
+
+  auto check = [&](auto value, dash::MemArrange storage) {
+    typedef decltype(value) value_t;
+    // Leading dimensions of A, B and C:
+    long long lda = (storage == dash::ROW_MAJOR) ? k : m;
+    long long ldb = (storage == dash::ROW_MAJOR) ? n : k;
+    long long ldc = (storage == dash::ROW_MAJOR) ? n : m;
+    auto elem = [&](long long ld, long long row, long long col) {
+      return (storage == dash::ROW_MAJOR) ? row * ld + col
+                                          : col * ld + row;
+    };
+    std::vector<value_t> a(m * k);
+    std::vector<value_t> b(k * n);
+    std::vector<value_t> c(m * n);
+    std::vector<value_t> c_exp(m * n);
+    for (long long i = 0; i < m; ++i) {
+      for (long long p = 0; p < k; ++p) {
+        a[elem(lda, i, p)] = static_cast<value_t>((i * 7 + p) % 11) - 5;
+      }
+    }
+    for (long long p = 0; p < k; ++p) {
+      for (long long j = 0; j < n; ++j) {
+        b[elem(ldb, p, j)] = static_cast<value_t>((p * 3 + j) % 5) - 2;
+      }
+    }
+    for (long long i = 0; i < m; ++i) {
+      for (long long j = 0; j < n; ++j) {
+        value_t c_ij = static_cast<value_t>(i + j);
+        c[elem(ldc, i, j)] = c_ij;
+        for (long long p = 0; p < k; ++p) {
+          c_ij += a[elem(lda, i, p)] * b[elem(ldb, p, j)];
+        }
+        c_exp[elem(ldc, i, j)] = c_ij;
+      }
+    }
+    dash::internal::gemm_local(
+      a.data(), b.data(), c.data(), m, n, k, storage);
+    for (long long e = 0; e < m * n; ++e) {
+      ASSERT_EQ_U(c_exp[e], c[e]);
+    }
+  };
+  check(double(0), dash::ROW_MAJOR);
+  check(double(0), dash::COL_MAJOR);
+  check(float(0),  dash::ROW_MAJOR);
+  check(float(0),  dash::COL_MAJOR);
+}
+
+TEST_F(SUMMATest, SUMMA25D)
+{
+  typedef dash::TilePattern<2>           pattern_t;
+  typedef double                         value_t;
+  typedef typename pattern_t::index_type index_t;
+  typedef typename pattern_t::size_type  extent_t;
+
+  extent_t tile_size = 4;
+  extent_t extent    = dash::size() * 2 * tile_size;
+  dash::SizeSpec<2> size_spec(extent, extent);
+
+  auto team_spec = dash::make_team_spec<
+                     dash::summa_pattern_partitioning_constraints,
+                     dash::summa_pattern_mapping_constraints,
+                     dash::summa_pattern_layout_constraints >(
+                       size_spec);
+  pattern_t pattern(size_spec,
+                    dash::DistributionSpec<2>(dash::TILE(tile_size),
+                                              dash::TILE(tile_size)),
+                    team_spec);
+
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_a(pattern);
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_b(pattern);
+  dash::Matrix<value_t, 2, index_t, pattern_t> matrix_c(pattern);
+
+  auto value_a = [](index_t i, index_t j) {
+    return static_cast<value_t>((i * 3 + j) % 7) - 3;
+  };
+  auto value_b = [](index_t i, index_t j) {
+    return static_cast<value_t>((i + 2 * j) % 5) - 2;
+  };
+  if (dash::myid() == 0) {
+    for (index_t i = 0; i < static_cast<index_t>(extent); ++i) {
+      for (index_t j = 0; j < static_cast<index_t>(extent); ++j) {
+        matrix_a[i][j] = value_a(i, j);
+        matrix_b[i][j] = value_b(i, j);
+      }
+    }
+  }
+
+  std::vector<extent_t> layers { 1, dash::size(),
+                                 dash::summa_25d_num_layers(
+                                   matrix_a, matrix_b, matrix_c) };
+  if (dash::size() > 2 && dash::size() % 2 == 0) {
+    layers.push_back(2);
+  }
+  for (auto num_layers : layers) {
+    LOG_MESSAGE("dash::summa_25d with %lu layers", num_layers);
+    dash::fill(matrix_c.begin(), matrix_c.end(), 0);
+    dash::barrier();
+
+    dash::summa_25d(matrix_a, matrix_b, matrix_c, num_layers);
+
+    if (dash::myid() == 0) {
+      for (index_t i = 0; i < static_cast<index_t>(extent); ++i) {
+        for (index_t j = 0; j < static_cast<index_t>(extent); ++j) {
+          value_t expect = 0;
+          for (index_t k = 0; k < static_cast<index_t>(extent); ++k) {
+            expect += value_a(i, k) * value_b(k, j);
+          }
+          value_t actual = matrix_c[i][j];
+          ASSERT_EQ_U(expect, actual);
+        }
+      }
+    }
+    dash::barrier();
+  }
+
+  // Number of layers must divide the team size:
+  if (dash::size() > 1) {
+    EXPECT_THROW(
+      dash::summa_25d(matrix_a, matrix_b, matrix_c, dash::size() + 1),
+      dash::exception::InvalidArgument);
+  }
+}
@@ -8,6 +8,7 @@
 #include <dash/algorithm/Sort.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <random>
 
@@ -26,6 +27,37 @@ class sense_of_life_dev {
 template <typename GlobIter>
 static void perform_test(GlobIter begin, GlobIter end);
 
+/**
+ * Sets a configuration value for the lifetime of the guard and restores
+ * the previous value, also if the test fails. Values derived from the key
+ * (\c _BOOL, \c _BYTES) are restored as well.
+ */
+class ConfigGuard {
+public:
+  ConfigGuard(std::string const& key, std::string const& value)
+    : _keys{{key, key + "_BOOL", key + "_BYTES"}}
+  {
+    for (size_t k = 0; k < _keys.size(); ++k) {
+      _prev[k] = dash::util::Config::get<std::string>(_keys[k]);
+    }
+    dash::util::Config::set(key, value);
+  }
+
+  ~ConfigGuard()
+  {
+    for (size_t k = 0; k < _keys.size(); ++k) {
+      dash::util::Config::set(_keys[k], _prev[k]);
+    }
+  }
+
+  ConfigGuard(ConfigGuard const&) = delete;
+  ConfigGuard& operator=(ConfigGuard const&) = delete;
+
+private:
+  std::array<std::string, 3> _keys;
+  std::array<std::string, 3> _prev;
+};
+
 template <
     class GlobIter,
     typename std::enable_if<std::is_integral<
@@ -430,5 +462,175 @@ TEST_F(SortTest, ExtremValues)
   perform_test(arr.begin(), arr.end());
 }
 
+TEST_F(SortTest, ThreadedLocalSortAndMerge)
+{
+  using value_t = int64_t;
+
+  size_t const nelem = 20 * PSORT_MIN_NELEM_PER_THREAD + 17;
+
+  std::mt19937 generator(dash::myid());
+  std::uniform_int_distribution<value_t> distribution(-1E6, 1E6);
+  std::vector<value_t> values(nelem);
+  std::generate(values.begin(), values.end(), [&]() {
+    return distribution(generator);
+  });
+  std::vector<value_t> expected(values);
+  std::sort(expected.begin(), expected.end());
+
+  auto const comp = std::less<value_t>();
+
+  // Threads are used independent of the threads available to the unit if
+  // OpenMP is enabled:
+  for (int nthreads : {1, 3, 4}) {
+    std::vector<value_t> sorted(values);
+    dash::detail::psort__local_sort(
+        sorted.data(), sorted.data() + nelem, comp, nthreads);
+    EXPECT_TRUE_U(sorted == expected);
+  }
+  for (int nthreads : {1, 3, 4}) {
+    std::vector<value_t> sorted(values);
+    dash::detail::psort__local_sort_inplace(
+        sorted.data(), sorted.data() + nelem, comp, nthreads);
+    EXPECT_TRUE_U(sorted == expected);
+  }
+
+  // Merge sorted sequences of different size, including empty sequences:
+  std::vector<size_t> offsets{0,
+                              0,
+                              nelem / 7,
+                              nelem / 2,
+                              nelem / 2,
+                              nelem - 3,
+                              nelem};
+  for (int nthreads : {1, 4}) {
+    std::vector<value_t> sequences(values);
+    for (size_t s = 0; s + 1 < offsets.size(); ++s) {
+      std::sort(
+          sequences.begin() + offsets[s],
+          sequences.begin() + offsets[s + 1]);
+    }
+    dash::detail::psort__merge_sequences(
+        sequences.data(), offsets, comp, nthreads);
+    EXPECT_TRUE_U(sequences == expected);
+  }
+}
+
+TEST_F(SortTest, InPlaceExchange)
+{
+  using value_t = int64_t;
+
+  size_t const nlocal = 1000;
+
+  dash::Array<value_t> array(nlocal * dash::size());
+  auto const& stats = dash::sort_stats();
+
+  {
+    ConfigGuard inplace("DASH_SORT_INPLACE", "true");
+    // Staging buffer of 64 elements, partitions are exchanged in many rounds
+    ConfigGuard staging("DASH_SORT_STAGING_SIZE", "512");
+
+    rand_range(array.begin(), array.end());
+    array.barrier();
+
+    perform_test(array.begin(), array.end());
+
+    if (dash::size() > 1) {
+      EXPECT_GT_U(stats.exchange_rounds, 1);
+    }
+    EXPECT_LT_U(stats.peak_extra_bytes, nlocal * sizeof(value_t));
+
+    // Partial range with empty local ranges
+    if (dash::size() > 2) {
+      rand_range(array.begin(), array.end());
+      array.barrier();
+      perform_test(array.begin() + nlocal + 10, array.end() - nlocal - 20);
+    }
+  }
+
+  // Without the in-place exchange, the local copy and the merge buffer
+  // span the local range
+  EXPECT_FALSE_U(dash::util::Config::get<bool>("DASH_SORT_INPLACE"));
+  rand_range(array.begin(), array.end());
+  array.barrier();
+  perform_test(array.begin(), array.end());
+  if (dash::size() > 1) {
+    EXPECT_EQ_U(0, stats.exchange_rounds);
+    EXPECT_GE_U(stats.peak_extra_bytes, nlocal * sizeof(value_t));
+  }
+}
+
+TEST_F(SortTest, StableSortOfPoints)
+{
+  dash::Array<Point> array(num_local_elem * dash::size());
+
+  std::mt19937 generator(dash::myid());
+  std::uniform_int_distribution<int32_t> distribution(-10, 10);
+  for (size_t i = 0; i < array.lsize(); ++i) {
+    array.local[i].x = distribution(generator);
+    array.local[i].y = static_cast<int32_t>(array.pattern().global(i));
+  }
+  array.barrier();
+
+  dash::stable_sort(
+      array.begin(), array.end(), [](Point const& p) { return p.x; });
+
+  if (dash::myid() == 0) {
+    for (size_t i = 1; i < array.size(); ++i) {
+      Point const prev = array[i - 1];
+      Point const curr = array[i];
+      ASSERT_LE_U(prev.x, curr.x);
+      if (prev.x == curr.x) {
+        // equal keys remain in their original order
+        ASSERT_LT_U(prev.y, curr.y);
+      }
+    }
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, SortByKey)
+{
+  using key_t   = int64_t;
+  using value_t = int64_t;
+
+  // Large enough for threaded local phases
+  size_t const nlocal = 3 * PSORT_MIN_NELEM_PER_THREAD + 5;
+  size_t const nelem  = nlocal * dash::size();
+
+  dash::Array<key_t>   keys(nelem);
+  dash::Array<value_t> values(nelem);
+
+  std::mt19937 generator(dash::myid());
+  std::uniform_int_distribution<key_t> distribution(0, 100);
+  for (size_t i = 0; i < keys.lsize(); ++i) {
+    keys.local[i]   = distribution(generator);
+    values.local[i] = keys.pattern().global(i);
+  }
+  keys.barrier();
+
+  std::vector<key_t> orig_keys(nelem);
+  dash::copy(keys.begin(), keys.end(), orig_keys.data());
+  keys.barrier();
+
+  dash::sort_by_key(keys.begin(), keys.end(), values.begin());
+
+  std::vector<key_t>   sorted_keys(nelem);
+  std::vector<value_t> sorted_values(nelem);
+  dash::copy(keys.begin(), keys.end(), sorted_keys.data());
+  dash::copy(values.begin(), values.end(), sorted_values.data());
+
+  for (size_t i = 0; i < nelem; ++i) {
+    // values are the original positions of their keys
+    ASSERT_EQ_U(orig_keys[sorted_values[i]], sorted_keys[i]);
+    if (i > 0) {
+      ASSERT_LE_U(sorted_keys[i - 1], sorted_keys[i]);
+      if (sorted_keys[i - 1] == sorted_keys[i]) {
+        ASSERT_LT_U(sorted_values[i - 1], sorted_values[i]);
+      }
+    }
+  }
+  keys.barrier();
+}
+
 // TODO: add additional unit tests with various pattern types and containers
 //
@@ -0,0 +1,150 @@
+
+#include "TransformReduceTest.h"
+
+#include <dash/Array.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/TransformReduce.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+
+TEST_F(TransformReduceTest, SquaredNorm)
+{
+  dash::Array<double> array(num_local_elem * dash::size());
+  auto lidx = 0;
+  for (auto lit = array.lbegin(); lit != array.lend(); ++lit, ++lidx) {
+    *lit = static_cast<double>(array.pattern().global(lidx) % 7);
+  }
+  array.barrier();
+
+  double expected = 0;
+  for (size_t g = 0; g < array.size(); ++g) {
+    expected += static_cast<double>((g % 7) * (g % 7));
+  }
+
+  auto result = dash::transform_reduce(
+                  array.begin(), array.end(), 1.0, dash::plus<double>(),
+                  [](double v) { return v * v; });
+  EXPECT_EQ_U(expected + 1.0, result);
+}
+
+TEST_F(TransformReduceTest, InnerProduct)
+{
+  // Large enough for the local pass to be split among threads with
+  // dash::execution::par
+  auto const nlocal = 3 * TRANSFORM_REDUCE_MIN_NELEM_PER_THREAD + 3;
+  dash::Array<int64_t> x(nlocal * dash::size());
+  dash::Array<int64_t> y(nlocal * dash::size());
+  dash::fill(x.begin(), x.end(), 3);
+  auto lidx = 0;
+  for (auto lit = y.lbegin(); lit != y.lend(); ++lit, ++lidx) {
+    *lit = static_cast<int64_t>(y.pattern().global(lidx));
+  }
+  y.barrier();
+
+  int64_t const n = y.size();
+  auto result = dash::inner_product(x.begin(), x.end(), y.begin(),
+                                    int64_t(5));
+  EXPECT_EQ_U(5 + 3 * (n * (n - 1) / 2), result);
+
+  auto par_result = dash::transform_reduce(
+                      dash::execution::par,
+                      x.begin(), x.end(), y.begin(), int64_t(5),
+                      dash::plus<int64_t>(), dash::multiply<int64_t>());
+  EXPECT_EQ_U(result, par_result);
+}
+
+TEST_F(TransformReduceTest, PartialRange)
+{
+  dash::Array<int> x(num_local_elem * dash::size());
+  dash::Array<int> y(num_local_elem * dash::size());
+  dash::fill(x.begin(), x.end(), 2);
+  dash::fill(y.begin(), y.end(), 4);
+  x.barrier();
+
+  // Range owned by the first unit only, other units have no local elements
+  auto first  = num_local_elem / 4;
+  auto last   = num_local_elem / 2;
+  auto result = dash::inner_product(x.begin() + first, x.begin() + last,
+                                    y.begin() + first, 0);
+  EXPECT_EQ_U(static_cast<int>(8 * (last - first)), result);
+}
+
+TEST_F(TransformReduceTest, PartialRangeMinMax)
+{
+  dash::Array<int> x(num_local_elem * dash::size());
+  auto lidx = 0;
+  for (auto lit = x.lbegin(); lit != x.lend(); ++lit, ++lidx) {
+    *lit = static_cast<int>(x.pattern().global(lidx)) - 100;
+  }
+  x.barrier();
+
+  // Units without local elements contribute the identity of the
+  // predefined reduction
+  auto first = num_local_elem / 4;
+  auto last  = num_local_elem / 2;
+  auto min   = dash::transform_reduce(
+                 x.begin() + first, x.begin() + last,
+                 std::numeric_limits<int>::max(), dash::min<int>(),
+                 [](int v) { return -v; });
+  EXPECT_EQ_U(100 - static_cast<int>(last - 1), min);
+
+  auto max   = dash::transform_reduce(
+                 x.begin() + first, x.begin() + last,
+                 std::numeric_limits<int>::lowest(), dash::max<int>(),
+                 [](int v) { return -v; });
+  EXPECT_EQ_U(100 - static_cast<int>(first), max);
+}
+
+#ifdef DASH_ENABLE_OPENMP
+TEST_F(TransformReduceTest, FewerThreadsGranted)
+{
+  auto const nelem = 4 * TRANSFORM_REDUCE_MIN_NELEM_PER_THREAD + 5;
+  int64_t const n  = nelem;
+
+  // The nested parallel region of the local pass is granted a single
+  // thread, fewer than requested
+  auto max_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(1);
+  int64_t result  = 0;
+  #pragma omp parallel num_threads(1)
+  {
+    result = dash::internal::transform_reduce_local<int64_t>(
+               dash::execution::par, nelem, dash::plus<int64_t>(),
+               [](size_t i) { return static_cast<int64_t>(i); }).value;
+  }
+  omp_set_max_active_levels(max_levels);
+  EXPECT_EQ_U(n * (n - 1) / 2, result);
+}
+#endif // DASH_ENABLE_OPENMP
+
+TEST_F(TransformReduceTest, CustomOperations)
+{
+  dash::Array<int32_t> x(num_local_elem * dash::size());
+  dash::Array<int32_t> y(num_local_elem * dash::size());
+  auto lidx = 0;
+  for (auto lit = x.lbegin(); lit != x.lend(); ++lit, ++lidx) {
+    *lit = static_cast<int32_t>(x.pattern().global(lidx));
+  }
+  dash::fill(y.begin(), y.end(), 0);
+  x.barrier();
+  if (dash::myid() == 0) {
+    y.local[1] = 1000000;
+  }
+  y.barrier();
+
+  // Maximum absolute difference
+  auto result = dash::transform_reduce(
+                  x.begin(), x.end(), y.begin(), int64_t(0),
+                  [](int64_t a, int64_t b) { return std::max(a, b); },
+                  [](int32_t a, int32_t b) {
+                    return static_cast<int64_t>(std::abs(a - b));
+                  });
+  EXPECT_EQ_U(std::max<int64_t>(x.size() - 1, 1000000 - 1), result);
+}
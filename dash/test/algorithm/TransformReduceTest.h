@@ -0,0 +1,15 @@
+#ifndef DASH__TEST__TRANSFORM_REDUCE_TEST_H_
+#define DASH__TEST__TRANSFORM_REDUCE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for algorithms dash::transform_reduce and
+ * dash::inner_product
+ */
+class TransformReduceTest : public dash::test::TestBase {
+protected:
+  size_t const num_local_elem = 1000;
+};
+
+#endif // DASH__TEST__TRANSFORM_REDUCE_TEST_H_
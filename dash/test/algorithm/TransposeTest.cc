@@ -0,0 +1,145 @@
+#include "TransposeTest.h"
+
+#include <dash/Matrix.h>
+#include <dash/algorithm/Fill.h>
+#include <dash/algorithm/Transpose.h>
+#include <dash/pattern/TilePattern.h>
+
+
+namespace {
+
+template <class MatrixT>
+void init_by_coords(MatrixT & matrix)
+{
+  auto & pattern = matrix.pattern();
+  auto   ncols   = static_cast<int>(matrix.extent(1));
+  for (size_t lidx = 0; lidx < pattern.local_size(); ++lidx) {
+    auto coords = pattern.coords(pattern.global(lidx));
+    matrix.lbegin()[lidx] = static_cast<int>(coords[0]) * ncols +
+                            static_cast<int>(coords[1]);
+  }
+  matrix.barrier();
+}
+
+/**
+ * Counts the local elements of \c matrix that differ from the elements of
+ * a matrix initialized by \c init_by_coords or, if \c transposed is set,
+ * of its transpose.
+ */
+template <class MatrixT>
+int num_errors_by_coords(MatrixT & matrix, bool transposed)
+{
+  auto & pattern = matrix.pattern();
+  int    errors  = 0;
+  for (size_t lidx = 0; lidx < pattern.local_size(); ++lidx) {
+    auto coords = pattern.coords(pattern.global(lidx));
+    int  expect = transposed
+                  ? static_cast<int>(coords[1] * matrix.extent(0) + coords[0])
+                  : static_cast<int>(coords[0] * matrix.extent(1) + coords[1]);
+    errors += (matrix.lbegin()[lidx] != expect) ? 1 : 0;
+  }
+  return errors;
+}
+
+} // namespace
+
+TEST_F(TransposeTest, BlockedRows)
+{
+  // Non-square matrix, blocks are not aligned to the transposed blocks:
+  size_t extent_y = tilesize * dash::size() + 1;
+  size_t extent_x = 2 * tilesize * dash::size() + 2;
+
+  dash::Matrix<int, 2> src(extent_y, extent_x);
+  dash::Matrix<int, 2> dst(extent_x, extent_y);
+  dash::fill(dst.begin(), dst.end(), -1);
+  init_by_coords(src);
+
+  dash::transpose(src, dst);
+  EXPECT_EQ_U(0, num_errors_by_coords(dst, true));
+}
+
+TEST_F(TransposeTest, TilesToBlockedRows)
+{
+  typedef dash::TilePattern<2>                                 tile_pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, tile_pattern_t>
+                                                               tile_matrix_t;
+
+  // Non-square unit grid if the number of units is no square number:
+  size_t extent_y = tilesize * 2 * dash::size();
+  size_t extent_x = tilesize * 3 * dash::size();
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  tile_matrix_t tiles(dash::SizeSpec<2>(extent_y, extent_x),
+                      dash::DistributionSpec<2>(dash::TILE(tilesize),
+                                                dash::TILE(tilesize)),
+                      dash::Team::All(), teamspec);
+  dash::Matrix<int, 2> rows(extent_x, extent_y);
+  dash::fill(rows.begin(), rows.end(), -1);
+  init_by_coords(tiles);
+
+  dash::transpose(tiles, rows);
+  EXPECT_EQ_U(0, num_errors_by_coords(rows, true));
+}
+
+TEST_F(TransposeTest, InPlaceTiles)
+{
+  typedef dash::TilePattern<2>                                 tile_pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, tile_pattern_t>
+                                                               tile_matrix_t;
+
+  size_t extent = tilesize * 2 * dash::size();
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  tile_matrix_t matrix(dash::SizeSpec<2>(extent, extent),
+                       dash::DistributionSpec<2>(dash::TILE(tilesize),
+                                                 dash::TILE(2 * tilesize)),
+                       dash::Team::All(), teamspec);
+  init_by_coords(matrix);
+
+  dash::transpose(matrix);
+  EXPECT_EQ_U(0, num_errors_by_coords(matrix, true));
+
+  // Transposing twice restores the matrix:
+  dash::transpose(matrix);
+  EXPECT_EQ_U(0, num_errors_by_coords(matrix, false));
+}
+
+TEST_F(TransposeTest, ReuseSchedule)
+{
+  typedef dash::TilePattern<2>                                 tile_pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, tile_pattern_t>
+                                                               tile_matrix_t;
+  typedef dash::Matrix<int, 2>::pattern_type                 block_pattern_t;
+
+  size_t extent_y = tilesize * 2 * dash::size() + 3;
+  size_t extent_x = tilesize * dash::size();
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  tile_matrix_t tiles(dash::SizeSpec<2>(extent_y, extent_x),
+                      dash::DistributionSpec<2>(dash::TILE(tilesize),
+                                                dash::TILE(tilesize)),
+                      dash::Team::All(), teamspec);
+  dash::Matrix<int, 2> rows(extent_x, extent_y);
+  init_by_coords(tiles);
+
+  dash::RedistributeSchedule<tile_pattern_t, block_pattern_t>
+    schedule(tiles.pattern(), rows.pattern(),
+             dash::RedistributeMapping::TRANSPOSE);
+  for (int rep = 0; rep < 2; ++rep) {
+    dash::fill(rows.begin(), rows.end(), -1);
+    schedule.execute(tiles, rows);
+    EXPECT_EQ_U(0, num_errors_by_coords(rows, true));
+  }
+}
+
+TEST_F(TransposeTest, ExtentsMismatch)
+{
+  dash::Matrix<int, 2> a(2 * dash::size() + 1, 4);
+  dash::Matrix<int, 2> b(2 * dash::size() + 1, 4);
+  EXPECT_THROW(
+    dash::transpose(a, b),
+    dash::exception::InvalidArgument);
+}
@@ -0,0 +1,14 @@
+#ifndef DASH__TEST__TRANSPOSE_TEST_H_
+#define DASH__TEST__TRANSPOSE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for dash::transpose
+ */
+class TransposeTest : public dash::test::TestBase {
+protected:
+  size_t const tilesize = 3;
+};
+
+#endif // DASH__TEST__TRANSPOSE_TEST_H_
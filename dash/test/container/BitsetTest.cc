@@ -0,0 +1,152 @@
+
+#include "BitsetTest.h"
+
+#include <dash/Bitset.h>
+
+#include <vector>
+
+
+TEST_F(BitsetTest, SetResetTest)
+{
+  size_t nbits = 64 * 3 * dash::size() + 17;
+  dash::Bitset<> bits(nbits);
+
+  EXPECT_EQ_U(nbits, bits.size());
+  EXPECT_EQ_U(0, bits.count());
+
+  // Every unit sets a distinct bit in every word:
+  for (size_t b = dash::myid(); b < nbits; b += 64) {
+    bits.set(b);
+  }
+  bits.barrier();
+
+  size_t nunits = dash::size();
+  size_t nset   = 0;
+  for (size_t b = 0; b < nbits; ++b) {
+    bool expected = (b % 64) < nunits;
+    EXPECT_EQ_U(expected, bits.test(b));
+    if (expected) {
+      ++nset;
+    }
+  }
+  EXPECT_EQ_U(nset, bits.count());
+  bits.barrier();
+
+  for (size_t b = dash::myid(); b < nbits; b += 64) {
+    if (b % 2 == 0) {
+      bits.reset(b);
+    }
+  }
+  bits.barrier();
+
+  for (size_t b = 0; b < nbits; ++b) {
+    bool expected = (b % 64) < nunits && (b % 2 == 1);
+    EXPECT_EQ_U(expected, bits.test(b));
+  }
+  bits.barrier();
+
+  bits.clear();
+  EXPECT_EQ_U(0, bits.count());
+  EXPECT_TRUE_U(bits.none());
+}
+
+#if defined(DASH_ENABLE_ASSERTIONS)
+TEST_F(BitsetTest, BitIndexOutOfRange)
+{
+  // Last word contains padding bits past the size of the bitset:
+  size_t nbits = 64 * dash::size() + 17;
+  dash::Bitset<> bits(nbits);
+
+  EXPECT_THROW(bits.set(nbits), dash::exception::OutOfRange);
+  EXPECT_THROW(bits.reset(nbits + 1), dash::exception::OutOfRange);
+  EXPECT_THROW(bits.test(nbits), dash::exception::OutOfRange);
+  EXPECT_THROW(bits.test_and_set(nbits), dash::exception::OutOfRange);
+  EXPECT_THROW(bits.test(-1), dash::exception::OutOfRange);
+  bits.barrier();
+
+  EXPECT_EQ_U(0, bits.count());
+}
+#endif
+
+TEST_F(BitsetTest, BatchedSetTest)
+{
+  size_t nbits = 1000 * dash::size();
+  dash::Bitset<> bits(nbits);
+
+  // Every unit sets every third bit, duplicates and unsorted indices
+  // included:
+  std::vector<long> indices;
+  for (long b = nbits - 1; b >= 0; b -= 3) {
+    indices.push_back(b);
+    indices.push_back(b);
+  }
+  bits.set(indices.begin(), indices.end());
+  bits.barrier();
+
+  size_t nexpected = (nbits + 2) / 3;
+  EXPECT_EQ_U(nexpected, bits.count());
+
+  std::vector<long> queries(nbits);
+  for (size_t b = 0; b < nbits; ++b) {
+    queries[b] = nbits - b - 1;
+  }
+  std::vector<char> values(nbits);
+  bits.test(queries.begin(), queries.end(), values.begin());
+  for (size_t i = 0; i < nbits; ++i) {
+    bool expected = (queries[i] % 3) == static_cast<long>((nbits - 1) % 3);
+    EXPECT_EQ_U(expected, values[i] != 0);
+  }
+  bits.barrier();
+
+  // Clear all bits set in a batch:
+  bits.reset(indices.begin(), indices.end());
+  bits.barrier();
+  EXPECT_EQ_U(0, bits.count());
+}
+
+TEST_F(BitsetTest, TestAndSetTest)
+{
+  size_t nbits = 64 * dash::size();
+  dash::Bitset<> bits(nbits);
+  dash::Array<int> nfirst(dash::size());
+
+  // All units concurrently set all bits, every bit must be set first by
+  // exactly one unit:
+  int lfirst = 0;
+  for (size_t b = 0; b < nbits; ++b) {
+    if (!bits.test_and_set((b + 7 * dash::myid()) % nbits)) {
+      ++lfirst;
+    }
+  }
+  nfirst.local[0] = lfirst;
+  nfirst.barrier();
+
+  if (dash::myid() == 0) {
+    int total = 0;
+    for (size_t u = 0; u < dash::size(); ++u) {
+      total += nfirst[u];
+    }
+    EXPECT_EQ_U(static_cast<int>(nbits), total);
+  }
+  EXPECT_EQ_U(nbits, bits.count());
+}
+
+TEST_F(BitsetTest, LocalWords)
+{
+  size_t nbits = 64 * 4 * dash::size();
+  dash::Bitset<> bits(nbits);
+
+  // Set the lowest bit of every local word:
+  for (auto w = bits.lbegin(); w != bits.lend(); ++w) {
+    *w = 1;
+  }
+  bits.barrier();
+
+  EXPECT_EQ_U(4, bits.local_count());
+  EXPECT_EQ_U(4 * dash::size(), bits.count());
+  for (size_t lw = 0; lw < 4; ++lw) {
+    auto gw = bits.pattern().global(lw);
+    EXPECT_TRUE_U(bits.test(gw * 64));
+    EXPECT_FALSE_U(bits.test(gw * 64 + 1));
+  }
+}
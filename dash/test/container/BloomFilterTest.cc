@@ -0,0 +1,98 @@
+
+#include "BloomFilterTest.h"
+
+#include <dash/BloomFilter.h>
+
+#include <cctype>
+#include <functional>
+#include <string>
+#include <vector>
+
+
+TEST_F(BloomFilterTest, OptimalParameters)
+{
+  // Expected values from m = -n ln(p) / ln(2)^2, k = (m / n) ln(2):
+  EXPECT_EQ_U(9586, dash::BloomFilter<int>::optimal_num_bits(1000, 0.01));
+  EXPECT_EQ_U(7, dash::BloomFilter<int>::optimal_num_hashes(9586, 1000));
+
+  EXPECT_THROW(
+    dash::BloomFilter<int>::optimal_num_bits(1000, 1.5),
+    dash::exception::InvalidArgument);
+}
+
+TEST_F(BloomFilterTest, InsertAndContains)
+{
+  typedef long key_t;
+
+  size_t nlocal = 1000;
+  size_t nkeys  = nlocal * dash::size();
+  dash::BloomFilter<key_t> filter(nkeys, 0.01);
+
+  // Every unit inserts even keys, half of them one by one:
+  std::vector<key_t> keys;
+  for (size_t i = 0; i < nlocal; ++i) {
+    keys.push_back(2 * (dash::myid() * nlocal + i));
+  }
+  for (size_t i = 0; i < nlocal / 2; ++i) {
+    filter.insert(keys[i]);
+  }
+  filter.insert(keys.begin() + nlocal / 2, keys.end());
+  filter.barrier();
+
+  // No false negatives, including keys inserted by other units:
+  std::vector<key_t> inserted;
+  std::vector<key_t> others;
+  for (size_t i = 0; i < nkeys; ++i) {
+    inserted.push_back(2 * i);
+    others.push_back(2 * i + 1);
+  }
+  std::vector<char> found(nkeys);
+  filter.contains(inserted.begin(), inserted.end(), found.begin());
+  for (size_t i = 0; i < nkeys; ++i) {
+    EXPECT_TRUE_U(found[i]);
+  }
+  EXPECT_TRUE_U(filter.contains(inserted.back()));
+
+  // False positive rate of keys not inserted close to 1%:
+  filter.contains(others.begin(), others.end(), found.begin());
+  size_t nfalse_pos = 0;
+  for (size_t i = 0; i < nkeys; ++i) {
+    if (found[i]) {
+      ++nfalse_pos;
+    }
+  }
+  EXPECT_LT_U(nfalse_pos, nkeys / 20);
+
+  double approx_size = filter.approximate_size();
+  EXPECT_GT_U(approx_size, 0.9 * nkeys);
+  EXPECT_LT_U(approx_size, 1.1 * nkeys);
+
+  filter.clear();
+  EXPECT_FALSE_U(filter.contains(inserted.front()));
+}
+
+TEST_F(BloomFilterTest, CustomHash)
+{
+  // Hashes strings regardless of letter case:
+  struct case_insensitive_hash {
+    std::size_t operator()(const std::string & key) const
+    {
+      std::string lower(key);
+      for (auto & c : lower) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+      }
+      return std::hash<std::string>()(lower);
+    }
+  };
+
+  dash::BloomFilter<std::string, case_insensitive_hash> filter(
+    100, 0.01, dash::Team::All(), case_insensitive_hash());
+
+  if (dash::myid() == 0) {
+    filter.insert(std::string("DASH"));
+  }
+  filter.barrier();
+
+  EXPECT_TRUE_U(filter.contains(std::string("dash")));
+  EXPECT_TRUE_U(filter.contains(std::string("Dash")));
+}
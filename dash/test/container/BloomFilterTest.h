@@ -0,0 +1,21 @@
+#ifndef DASH__TEST__BLOOM_FILTER_TEST_H_
+#define DASH__TEST__BLOOM_FILTER_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::BloomFilter
+ */
+class BloomFilterTest : public dash::test::TestBase {
+protected:
+
+  BloomFilterTest() {
+    LOG_MESSAGE(">>> Test suite: BloomFilterTest");
+  }
+
+  virtual ~BloomFilterTest() {
+    LOG_MESSAGE("<<< Closing test suite: BloomFilterTest");
+  }
+};
+
+#endif // DASH__TEST__BLOOM_FILTER_TEST_H_
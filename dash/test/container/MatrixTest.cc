@@ -1676,3 +1676,46 @@ TEST_F(MatrixTest, LocalDiagonal){
     ASSERT_EQ_U(value_sub, unit);
   }
 }
+
+TEST_F(MatrixTest, LocalBlockPointers){
+  dash::TeamSpec<2> ts(dash::size(), 1);
+  ts.balance_extents();
+
+  int tilesize_y = 3;
+  int tilesize_x = 4;
+  int extent_y   = tilesize_y * 2 * ts.extent(0);
+  int extent_x   = tilesize_x * 3 * ts.extent(1);
+
+  dash::NArray<int, 2, dash::default_index_t, dash::TilePattern<2>> mat(
+    extent_y, extent_x, dash::TILE(tilesize_y), dash::TILE(tilesize_x), ts);
+
+  const auto & pattern = mat.pattern();
+  for (size_t lidx = 0; lidx < pattern.local_size(); ++lidx) {
+    auto coords = pattern.coords(pattern.global(lidx));
+    mat.lbegin()[lidx] = coords[0] * extent_x + coords[1];
+  }
+  mat.barrier();
+
+  ASSERT_EQ_U(pattern.local_blockspec().size(), mat.local.num_blocks());
+  size_t num_elements = 0;
+  for (size_t lb = 0; lb < mat.local.num_blocks(); ++lb) {
+    auto block   = pattern.local_block(lb);
+    int * lbegin = mat.local.block_lbegin(lb);
+    int * lend   = mat.local.block_lend(lb);
+    ASSERT_EQ_U(block.size(), lend - lbegin);
+    // Elements of a block are contiguous in row-major order:
+    for (int i = 0; i < block.extent(0); ++i) {
+      for (int j = 0; j < block.extent(1); ++j) {
+        int expected = (block.offset(0) + i) * extent_x + block.offset(1) + j;
+        EXPECT_EQ_U(expected, lbegin[i * block.extent(1) + j]);
+      }
+    }
+    num_elements += lend - lbegin;
+  }
+  EXPECT_EQ_U(mat.local_size(), num_elements);
+#if defined(DASH_ENABLE_ASSERTIONS)
+  EXPECT_THROW(mat.local.block_lbegin(mat.local.num_blocks()),
+               dash::exception::OutOfRange);
+#endif
+  mat.barrier();
+}
@@ -0,0 +1,132 @@
+
+#include "SparseMatrixTest.h"
+
+#include <dash/SparseMatrix.h>
+#include <dash/Array.h>
+
+#include <vector>
+
+
+TEST_F(SparseMatrixTest, AssembleFromSingleUnit)
+{
+  typedef dash::SparseMatrix<double> matrix_t;
+  typedef matrix_t::triplet_type     triplet_t;
+
+  long n = 10 * dash::size() + 3;
+  matrix_t A(n, n);
+
+  // Unit 0 contributes all entries of a tridiagonal matrix, the diagonal
+  // is split into two duplicate entries:
+  std::vector<triplet_t> triplets;
+  if (dash::myid() == 0) {
+    for (long i = 0; i < n; ++i) {
+      triplets.push_back(triplet_t { i, i, 1.0 });
+      triplets.push_back(triplet_t { i, i, 1.0 });
+      if (i > 0) {
+        triplets.push_back(triplet_t { i, i - 1, -1.0 });
+      }
+      if (i < n - 1) {
+        triplets.push_back(triplet_t { i, i + 1, -1.0 });
+      }
+    }
+  }
+  A.assemble(triplets.begin(), triplets.end());
+
+  EXPECT_EQ_U(static_cast<size_t>(3 * n - 2), A.nnz());
+  EXPECT_EQ_U(A.row_pattern().local_size(), A.local_rows());
+
+  // Every row contains its diagonal entry, merged from duplicates:
+  auto row_ptr = A.lrow_ptr();
+  auto cols    = A.lcol_indices();
+  auto values  = A.lvalues();
+  for (size_t r = 0; r < A.local_rows(); ++r) {
+    long grow = A.row_offset() + r;
+    bool found_diag = false;
+    for (auto k = row_ptr[r]; k < row_ptr[r + 1]; ++k) {
+      if (cols[k] == grow) {
+        found_diag = true;
+        EXPECT_EQ_U(2.0, values[k]);
+      } else {
+        EXPECT_EQ_U(-1.0, values[k]);
+      }
+    }
+    EXPECT_TRUE_U(found_diag);
+  }
+  if (dash::size() > 1) {
+    // Interior units reference one ghost entry on either side:
+    auto myid = dash::myid();
+    size_t nghosts_exp = (myid == 0 || myid == dash::size() - 1) ? 1 : 2;
+    EXPECT_EQ_U(nghosts_exp, A.num_ghosts());
+  }
+}
+
+TEST_F(SparseMatrixTest, MultiplyPoisson2D)
+{
+  typedef dash::SparseMatrix<double> matrix_t;
+  typedef matrix_t::triplet_type     triplet_t;
+
+  // 5-point stencil on a grid of nx x ny points:
+  long nx = 7;
+  long ny = 4 * dash::size() + 1;
+  long n  = nx * ny;
+  matrix_t A(n, n);
+
+  // Every unit contributes rows of a different block than its own to
+  // exercise redistribution:
+  std::vector<triplet_t> triplets;
+  long nunits = dash::size();
+  long myid   = dash::myid();
+  for (long i = 0; i < n; ++i) {
+    if (i % nunits != myid) {
+      continue;
+    }
+    long ix = i % nx;
+    long iy = i / nx;
+    triplets.push_back(triplet_t { i, i, 4.0 });
+    if (ix > 0)      { triplets.push_back(triplet_t { i, i - 1,  -1.0 }); }
+    if (ix < nx - 1) { triplets.push_back(triplet_t { i, i + 1,  -1.0 }); }
+    if (iy > 0)      { triplets.push_back(triplet_t { i, i - nx, -1.0 }); }
+    if (iy < ny - 1) { triplets.push_back(triplet_t { i, i + nx, -1.0 }); }
+  }
+  A.assemble(triplets.begin(), triplets.end());
+
+  EXPECT_EQ_U(static_cast<size_t>(5 * n - 2 * nx - 2 * ny), A.nnz());
+
+  matrix_t::vector_type x(A.col_pattern());
+  matrix_t::vector_type y(A.row_pattern());
+  for (size_t li = 0; li < x.lsize(); ++li) {
+    double gi    = static_cast<double>(x.pattern().global(li));
+    x.local[li]  = gi * gi;
+  }
+
+  // Repeated products must yield identical results:
+  for (int iter = 0; iter < 3; ++iter) {
+    A.multiply(x, y);
+    for (size_t li = 0; li < y.lsize(); ++li) {
+      long   i   = y.pattern().global(li);
+      long   ix  = i % nx;
+      long   iy  = i / nx;
+      auto   xv  = [](long j) { return static_cast<double>(j) * j; };
+      double exp = 4.0 * xv(i);
+      if (ix > 0)      { exp -= xv(i - 1);  }
+      if (ix < nx - 1) { exp -= xv(i + 1);  }
+      if (iy > 0)      { exp -= xv(i - nx); }
+      if (iy < ny - 1) { exp -= xv(i + nx); }
+      EXPECT_EQ_U(exp, static_cast<double>(y.local[li]));
+    }
+  }
+}
+
+TEST_F(SparseMatrixTest, InvalidLocalSizes)
+{
+  typedef dash::SparseMatrix<double> matrix_t;
+  typedef matrix_t::size_type        size_type;
+
+  // Local sizes are validated before they are accessed for the local unit:
+  std::vector<size_type> sizes(dash::size(), 4);
+  std::vector<size_type> too_short;
+  EXPECT_THROW(matrix_t(too_short, sizes),
+               dash::exception::InvalidArgument);
+  EXPECT_THROW(matrix_t(sizes, too_short),
+               dash::exception::InvalidArgument);
+}
@@ -0,0 +1,167 @@
+
+#include "VectorTest.h"
+
+#include <dash/Vector.h>
+
+#include <vector>
+
+
+TEST_F(VectorTest, Initialization)
+{
+  typedef int value_t;
+
+  auto nunits    = dash::size();
+  // Minimum number of elements allocated in a local grow operation:
+  auto lbuf_size = 2;
+  // Initial number of elements per unit:
+  auto lcap_init = 3;
+
+  dash::Vector<value_t> vec(nunits * lcap_init, lbuf_size);
+
+  EXPECT_EQ_U(0, vec.size());
+  EXPECT_EQ_U(0, vec.lsize());
+  EXPECT_TRUE_U(vec.empty());
+  EXPECT_TRUE_U(vec.local.empty());
+  EXPECT_EQ_U(nunits * lcap_init, vec.capacity());
+  EXPECT_EQ_U(lcap_init, vec.lcapacity());
+  EXPECT_EQ_U(vec.begin(), vec.end());
+}
+
+TEST_F(VectorTest, PushBackCommit)
+{
+  typedef int value_t;
+
+  auto nunits    = dash::size();
+  auto myid      = dash::myid();
+  auto lbuf_size = 2;
+  auto lcap_init = 3;
+
+  dash::Vector<value_t> vec(nunits * lcap_init, lbuf_size);
+
+  // Uneven number of elements at every unit, exceeding the initial
+  // local capacity to force geometric growth in several buckets:
+  auto nlocal = [=](int u) { return 5 * (u + 1) + 1; };
+
+  for (auto li = 0; li < nlocal(myid); ++li) {
+    vec.local.push_back(1000 * (myid + 1) + li);
+  }
+  // No commit yet, only changes of local size should be visible:
+  EXPECT_EQ_U(nlocal(myid), vec.size());
+  EXPECT_EQ_U(nlocal(myid), vec.lsize());
+  EXPECT_EQ_U(nlocal(myid), vec.local.size());
+  EXPECT_GE_U(vec.lcapacity(), vec.lsize());
+
+  // Local values are accessible before commit:
+  for (auto li = 0; li < nlocal(myid); ++li) {
+    EXPECT_EQ_U(1000 * (myid + 1) + li, vec.local[li]);
+  }
+  int li = 0;
+  for (auto lit = vec.local.begin(); lit != vec.local.end(); ++lit, ++li) {
+    EXPECT_EQ_U(1000 * (myid + 1) + li, *lit);
+  }
+  EXPECT_EQ_U(nlocal(myid), li);
+
+  vec.commit();
+
+  size_t nglobal = 0;
+  for (auto u = 0; u < nunits; ++u) {
+    nglobal += nlocal(u);
+  }
+  EXPECT_EQ_U(nglobal, vec.size());
+  EXPECT_EQ_U(nglobal, vec.end() - vec.begin());
+
+  // Global random access, elements are ordered by unit:
+  size_t gidx = 0;
+  for (auto u = 0; u < nunits; ++u) {
+    for (auto li = 0; li < nlocal(u); ++li) {
+      value_t expected = 1000 * (u + 1) + li;
+      value_t actual   = vec[gidx];
+      EXPECT_EQ_U(expected, actual);
+      EXPECT_EQ_U(u, vec.local_index_at(gidx).first);
+      EXPECT_EQ_U(li, vec.local_index_at(gidx).second);
+      ++gidx;
+    }
+  }
+  EXPECT_EQ_U(1000, static_cast<value_t>(vec.front()));
+  EXPECT_EQ_U(1000 * nunits + nlocal(nunits - 1) - 1,
+              static_cast<value_t>(vec.back()));
+
+  vec.barrier();
+}
+
+TEST_F(VectorTest, RepeatedCommit)
+{
+  typedef long value_t;
+
+  auto nunits = dash::size();
+  auto myid   = dash::myid();
+  auto rounds = 4;
+
+  dash::Vector<value_t> vec(0, 1);
+
+  // Only some units insert elements in every round so units attach
+  // different numbers of buckets in every commit:
+  std::vector<size_t> nlocal(nunits, 0);
+  for (auto r = 0; r < rounds; ++r) {
+    for (auto u = 0; u < nunits; ++u) {
+      if ((u + r) % 2 == 0) {
+        if (u == myid) {
+          for (auto i = 0; i < r + u + 1; ++i) {
+            vec.local.emplace_back(100000 * u + nlocal[u]);
+            nlocal[u]++;
+          }
+        } else {
+          nlocal[u] += r + u + 1;
+        }
+      }
+    }
+    vec.commit();
+
+    size_t gidx = 0;
+    for (auto u = 0; u < nunits; ++u) {
+      for (size_t li = 0; li < nlocal[u]; ++li) {
+        value_t expected = 100000 * u + li;
+        value_t actual   = *(vec.begin() + gidx);
+        EXPECT_EQ_U(expected, actual);
+        ++gidx;
+      }
+    }
+    EXPECT_EQ_U(gidx, vec.size());
+    vec.barrier();
+  }
+}
+
+TEST_F(VectorTest, Balance)
+{
+  typedef int value_t;
+
+  auto nunits = dash::size();
+  auto myid   = dash::myid();
+
+  dash::Vector<value_t> vec;
+
+  // All elements are inserted at the last unit:
+  size_t nglobal = 7 * nunits + 3;
+  if (myid == nunits - 1) {
+    for (size_t i = 0; i < nglobal; ++i) {
+      vec.local.push_back(i);
+    }
+  }
+  vec.balance();
+
+  EXPECT_EQ_U(nglobal, vec.size());
+  auto lsize_max = dash::math::div_ceil(nglobal, nunits);
+  auto lsize_exp = std::min<long>(
+                     lsize_max,
+                     std::max<long>(0, nglobal - myid * lsize_max));
+  EXPECT_EQ_U(lsize_exp, vec.lsize());
+
+  // Global order is preserved:
+  for (size_t li = 0; li < vec.lsize(); ++li) {
+    EXPECT_EQ_U(myid * lsize_max + li, vec.local[li]);
+  }
+  for (size_t gi = 0; gi < nglobal; ++gi) {
+    EXPECT_EQ_U(gi, static_cast<value_t>(vec[gi]));
+  }
+  vec.barrier();
+}
@@ -0,0 +1,21 @@
+#ifndef DASH__TEST__VECTOR_TEST_H_
+#define DASH__TEST__VECTOR_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::Vector
+ */
+class VectorTest : public dash::test::TestBase {
+protected:
+
+  VectorTest() {
+    LOG_MESSAGE(">>> Test suite: VectorTest");
+  }
+
+  virtual ~VectorTest() {
+    LOG_MESSAGE("<<< Closing test suite: VectorTest");
+  }
+};
+
+#endif // DASH__TEST__VECTOR_TEST_H_
@@ -0,0 +1,130 @@
+
+#include "WorkQueueTest.h"
+
+#include <dash/WorkQueue.h>
+#include <dash/Array.h>
+
+#include <vector>
+
+
+TEST_F(WorkQueueTest, LocalLIFO)
+{
+  typedef int value_t;
+
+  size_t ntasks = 100;
+  dash::WorkQueue<value_t> queue(ntasks);
+
+  EXPECT_EQ_U(ntasks, queue.capacity());
+  EXPECT_TRUE_U(queue.empty());
+
+  // Pushing tasks releases tasks to the shared portion of the queue, local
+  // order must be LIFO regardless:
+  for (size_t i = 0; i < ntasks; ++i) {
+    queue.push(100000 * dash::myid() + i);
+  }
+  EXPECT_EQ_U(ntasks, queue.size());
+
+  value_t task;
+  for (size_t i = 0; i < ntasks; ++i) {
+    EXPECT_TRUE_U(queue.pop(task));
+    EXPECT_EQ_U(100000 * dash::myid() + (ntasks - i - 1), task);
+  }
+  EXPECT_FALSE_U(queue.pop(task));
+  EXPECT_TRUE_U(queue.empty());
+
+  // Local capacity exceeded:
+  EXPECT_THROW(
+    {
+      for (size_t i = 0; i <= ntasks; ++i) {
+        queue.push(i);
+      }
+    },
+    dash::exception::RuntimeError);
+
+  queue.barrier();
+}
+
+TEST_F(WorkQueueTest, StealAndTerminate)
+{
+  typedef long value_t;
+
+  size_t ntasks = 1000;
+  dash::WorkQueue<value_t> queue(ntasks);
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < ntasks; ++i) {
+      queue.push(i);
+    }
+  }
+  queue.barrier();
+
+  value_t  task;
+  size_t   lcount = 0;
+  value_t  lsum   = 0;
+  while (queue.next(task)) {
+    ++lcount;
+    lsum += task;
+  }
+  EXPECT_TRUE_U(queue.empty());
+
+  dash::Array<size_t>  counts(dash::size());
+  dash::Array<value_t> sums(dash::size());
+  counts.local[0] = lcount;
+  sums.local[0]   = lsum;
+  counts.barrier();
+
+  if (dash::myid() == 0) {
+    size_t  total_count = 0;
+    value_t total_sum   = 0;
+    for (size_t u = 0; u < dash::size(); ++u) {
+      size_t  u_count = counts[u];
+      value_t u_sum   = sums[u];
+      LOG_MESSAGE("unit %lu processed %lu tasks", u, u_count);
+      total_count += u_count;
+      total_sum   += u_sum;
+    }
+    EXPECT_EQ_U(ntasks, total_count);
+    EXPECT_EQ_U(static_cast<value_t>(ntasks * (ntasks - 1) / 2), total_sum);
+  }
+  counts.barrier();
+}
+
+TEST_F(WorkQueueTest, SpawnTasks)
+{
+  // Binary tree of tasks with given depth spawned from a single root task
+  // at unit 0, in two rounds separated by reset of the queue:
+  typedef int value_t;
+
+  int    depth  = 10;
+  size_t nnodes = (size_t(1) << (depth + 1)) - 1;
+  dash::WorkQueue<value_t> queue(nnodes, 4, dash::Team::All());
+  dash::Array<size_t>      counts(dash::size());
+
+  for (int round = 0; round < 2; ++round) {
+    if (dash::myid() == 0) {
+      queue.push(0);
+    }
+    queue.barrier();
+
+    value_t task;
+    size_t  lcount = 0;
+    while (queue.next(task)) {
+      ++lcount;
+      if (task < depth) {
+        queue.push(task + 1);
+        queue.push(task + 1);
+      }
+    }
+    counts.local[0] = lcount;
+    counts.barrier();
+
+    if (dash::myid() == 0) {
+      size_t total_count = 0;
+      for (size_t u = 0; u < dash::size(); ++u) {
+        total_count += counts[u];
+      }
+      EXPECT_EQ_U(nnodes, total_count);
+    }
+    queue.reset();
+  }
+}
@@ -0,0 +1,21 @@
+#ifndef DASH__TEST__WORK_QUEUE_TEST_H_
+#define DASH__TEST__WORK_QUEUE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::WorkQueue
+ */
+class WorkQueueTest : public dash::test::TestBase {
+protected:
+
+  WorkQueueTest() {
+    LOG_MESSAGE(">>> Test suite: WorkQueueTest");
+  }
+
+  virtual ~WorkQueueTest() {
+    LOG_MESSAGE("<<< Closing test suite: WorkQueueTest");
+  }
+};
+
+#endif // DASH__TEST__WORK_QUEUE_TEST_H_
@@ -0,0 +1,273 @@
+#include "GhostExchangeTest.h"
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/pattern/CSRPattern.h>
+#include <dash/pattern/SFCTilePattern.h>
+#include <dash/halo/GhostExchange.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace dash;
+
+using namespace dash::halo;
+
+TEST_F(GhostExchangeTest, Array1DHalo)
+{
+  using Array_t = dash::Array<long>;
+  using index_t = typename Array_t::index_type;
+
+  const index_t size       = dash::size() * 7 + 3;
+  const index_t halo_width = 2;
+
+  Array_t array(size);
+  for(auto bound_prop : { BoundaryProp::NONE, BoundaryProp::CYCLIC }) {
+    GhostExchange<Array_t> ghost_exchange(array, halo_width, bound_prop);
+
+    const auto& pattern = array.pattern();
+    const index_t lbegin = pattern.global(0);
+    const index_t lend   = lbegin + static_cast<index_t>(array.lsize());
+
+    std::vector<index_t> expected;
+    for(index_t i = lbegin - halo_width; i < lbegin; ++i) {
+      if(i >= 0 || bound_prop == BoundaryProp::CYCLIC)
+        expected.push_back((i + size) % size);
+    }
+    for(index_t i = lend; i < lend + halo_width; ++i) {
+      if(i < size || bound_prop == BoundaryProp::CYCLIC)
+        expected.push_back(i % size);
+    }
+    ASSERT_EQ_U(expected.size(), ghost_exchange.ghost_indices().size());
+    for(std::size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ_U(expected[i], ghost_exchange.ghost_indices()[i]);
+    }
+
+    for(auto round = 0; round < 3; ++round) {
+      for(std::size_t l = 0; l < array.lsize(); ++l) {
+        array.local[l] = (lbegin + l) * 10 + round;
+      }
+      array.barrier();
+
+      ghost_exchange.update();
+      const auto& ghosts = ghost_exchange.ghosts();
+      for(std::size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ_U(expected[i] * 10 + round, ghosts[i]);
+      }
+      // elements are modified in the next round
+      array.barrier();
+    }
+  }
+}
+
+TEST_F(GhostExchangeTest, CSRPatternHalo)
+{
+  using Pattern_t = dash::CSRPattern<1>;
+  using extent_t  = typename Pattern_t::size_type;
+  using index_t   = typename Pattern_t::index_type;
+  using Array_t   = dash::Array<double, index_t, Pattern_t>;
+
+  // uneven blocks, some smaller than the halo width, some empty
+  std::vector<extent_t> local_sizes;
+  for(std::size_t u = 0; u < dash::size(); ++u) {
+    local_sizes.push_back((u % 3 == 1) ? 0 : (u % 4) * 3 + 1);
+  }
+  const index_t halo_width = 5;
+
+  Pattern_t pattern(local_sizes);
+  Array_t   array(pattern);
+  const index_t size   = pattern.size();
+  const index_t lsize  = array.lsize();
+  const index_t lbegin = (lsize > 0) ? pattern.global(0) : 0;
+  for(index_t l = 0; l < lsize; ++l) {
+    array.local[l] = 0.5 * (lbegin + l);
+  }
+  array.barrier();
+
+  GhostExchange<Array_t> ghost_exchange(array, halo_width,
+                                        BoundaryProp::CYCLIC);
+  ghost_exchange.update_async();
+  ghost_exchange.wait();
+
+  const auto& indices = ghost_exchange.ghost_indices();
+  const auto& ghosts  = ghost_exchange.ghosts();
+  if(lsize == 0) {
+    EXPECT_EQ_U(0, indices.size());
+  } else {
+    ASSERT_EQ_U(2 * halo_width, indices.size());
+    for(index_t i = 0; i < halo_width; ++i) {
+      EXPECT_EQ_U((lbegin - halo_width + i + 2 * size) % size, indices[i]);
+      EXPECT_EQ_U((lbegin + lsize + i) % size, indices[halo_width + i]);
+    }
+  }
+  for(std::size_t i = 0; i < indices.size(); ++i) {
+    EXPECT_EQ_U(0.5 * indices[i], ghosts[i]);
+  }
+
+  array.barrier();
+}
+
+TEST_F(GhostExchangeTest, UnstructuredGhosts)
+{
+  using Array_t = dash::Array<int>;
+  using index_t = typename Array_t::index_type;
+
+  const index_t size = dash::size() * 11;
+  const auto    myid = static_cast<index_t>(dash::myid().id);
+
+  Array_t array(size);
+  for(std::size_t l = 0; l < array.lsize(); ++l) {
+    array.local[l] = static_cast<int>(array.pattern().global(l)) * 3 + 1;
+  }
+  array.barrier();
+
+  // scattered indices with a contiguous run and a duplicate
+  std::vector<index_t> ghost_indices;
+  for(index_t k = 0; k < 8; ++k) {
+    ghost_indices.push_back((myid * 13 + k * 7) % size);
+  }
+  for(index_t k = 0; k < 4; ++k) {
+    ghost_indices.push_back((myid * 11 + 20 + k) % size);
+  }
+  ghost_indices.push_back(ghost_indices.front());
+
+  GhostExchange<Array_t> ghost_exchange(array, ghost_indices);
+  EXPECT_LE_U(ghost_exchange.num_owners(), dash::size());
+  EXPECT_LT_U(ghost_exchange.num_segments(), ghost_indices.size());
+
+  ghost_exchange.update();
+  const auto& ghosts = ghost_exchange.ghosts();
+  ASSERT_EQ_U(ghost_indices.size(), ghosts.size());
+  for(std::size_t i = 0; i < ghost_indices.size(); ++i) {
+    EXPECT_EQ_U(ghost_indices[i] * 3 + 1, ghosts[i]);
+
+    auto* ghost = ghost_exchange.ghost_at(ghost_indices[i]);
+    ASSERT_TRUE_U(ghost != nullptr);
+    EXPECT_EQ_U(ghost_indices[i] * 3 + 1, *ghost);
+  }
+
+  index_t no_ghost = 0;
+  while(std::find(ghost_indices.begin(), ghost_indices.end(), no_ghost)
+        != ghost_indices.end()) {
+    ++no_ghost;
+  }
+  if(no_ghost < size) {
+    EXPECT_TRUE_U(ghost_exchange.ghost_at(no_ghost) == nullptr);
+  }
+
+  array.barrier();
+}
+
+TEST_F(GhostExchangeTest, AsymmetricGhostsLoop)
+{
+  using Array_t = dash::Array<long>;
+  using index_t = typename Array_t::index_type;
+
+  const index_t nunits = dash::size();
+  const index_t lsize  = 5;
+  const index_t size   = nunits * lsize;
+  const auto    myid   = static_cast<index_t>(dash::myid().id);
+
+  Array_t array(size);
+
+  // every unit reads from its right neighbour, unit 0 additionally reads
+  // from all units: most owners do not read from their readers
+  std::vector<index_t> ghost_indices;
+  ghost_indices.push_back(((myid + 1) % nunits) * lsize);
+  if(myid == 0) {
+    for(index_t unit = 0; unit < nunits; ++unit) {
+      ghost_indices.push_back(unit * lsize + lsize - 1);
+    }
+  }
+  GhostExchange<Array_t> ghost_exchange(array, ghost_indices);
+
+  // no barriers between rounds, elements are modified right after the
+  // update returned
+  for(long round = 0; round < 50; ++round) {
+    for(index_t l = 0; l < lsize; ++l) {
+      array.local[l] = round * 1000 + array.pattern().global(l);
+    }
+    ghost_exchange.update();
+    const auto& ghosts = ghost_exchange.ghosts();
+    for(std::size_t i = 0; i < ghost_indices.size(); ++i) {
+      ASSERT_EQ_U(round * 1000 + ghost_indices[i], ghosts[i]);
+    }
+  }
+
+  array.barrier();
+}
+
+TEST_F(GhostExchangeTest, SFCTileMatrixHalo)
+{
+  using Pattern_t  = dash::SFCTilePattern<2>;
+  using Matrix_t   = dash::Matrix<long, 2, dash::default_index_t, Pattern_t>;
+  using index_t    = typename Matrix_t::index_type;
+  using Coords_t   = std::array<index_t, 2>;
+  using StencilP_t = StencilPoint<2>;
+
+  const index_t tilesize = 3;
+  const index_t ext_y    = tilesize * (dash::size() + 2);
+  const index_t ext_x    = tilesize * 4;
+  Matrix_t matrix(dash::SizeSpec<2>(ext_y, ext_x),
+                  dash::DistributionSpec<2>(dash::TILE(tilesize),
+                                            dash::TILE(tilesize)));
+  const auto& pattern = matrix.pattern();
+
+  StencilSpec<StencilP_t, 4> stencil_spec(
+    StencilP_t(-1, 0), StencilP_t(1, 0), StencilP_t(0, -1), StencilP_t(0, 1));
+
+  for(auto bound_prop : { BoundaryProp::NONE, BoundaryProp::CYCLIC }) {
+    GhostExchange<Matrix_t> ghost_exchange(
+      matrix, HaloSpec<2>(stencil_spec),
+      GlobalBoundarySpec<2>(bound_prop, bound_prop));
+
+    // every tile has four halo regions with tilesize elements each
+    const auto nblocks = pattern.local_blockspec().size();
+    if(bound_prop == BoundaryProp::CYCLIC) {
+      EXPECT_EQ_U(nblocks * 4 * tilesize,
+                  ghost_exchange.ghost_indices().size());
+    } else {
+      EXPECT_GE_U(nblocks * 4 * tilesize,
+                  ghost_exchange.ghost_indices().size());
+    }
+
+    for(long round = 0; round < 3; ++round) {
+      auto value = [&](const Coords_t& c) {
+        return round * 100000 + c[0] * ext_x + c[1];
+      };
+      for(std::size_t l = 0; l < matrix.local.size(); ++l) {
+        matrix.lbegin()[l] = value(pattern.coords(pattern.global(l)));
+      }
+      ghost_exchange.update();
+
+      // neighbours of all local elements outside of their tile
+      for(std::size_t lb = 0; lb < nblocks; ++lb) {
+        auto block = pattern.local_block(lb);
+        for(index_t i = 0; i < tilesize; ++i) {
+          for(index_t j = 0; j < tilesize; ++j) {
+            for(const auto& point : stencil_spec.specs()) {
+              index_t ni = i + point[0];
+              index_t nj = j + point[1];
+              if(ni >= 0 && ni < tilesize && nj >= 0 && nj < tilesize) {
+                continue;
+              }
+              Coords_t g{ { static_cast<index_t>(block.offset(0)) + ni,
+                            static_cast<index_t>(block.offset(1)) + nj } };
+              if(g[0] < 0 || g[0] >= ext_y || g[1] < 0 || g[1] >= ext_x) {
+                if(bound_prop == BoundaryProp::NONE) {
+                  continue;
+                }
+                g[0] = (g[0] + ext_y) % ext_y;
+                g[1] = (g[1] + ext_x) % ext_x;
+              }
+              auto* ghost = ghost_exchange.ghost_at(g);
+              ASSERT_TRUE_U(ghost != nullptr);
+              EXPECT_EQ_U(value(g), *ghost);
+            }
+          }
+        }
+      }
+    }
+    matrix.barrier();
+  }
+}
@@ -0,0 +1,12 @@
+#ifndef DASH__TEST__GHOST_EXCHANGE_TEST_H_
+#define DASH__TEST__GHOST_EXCHANGE_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for dash::halo::GhostExchange
+ */
+class GhostExchangeTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__GHOST_EXCHANGE_TEST_H_
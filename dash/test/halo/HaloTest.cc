@@ -3,6 +3,8 @@
 #include <dash/Matrix.h>
 #include <dash/Algorithm.h>
 #include <dash/halo/HaloMatrixWrapper.h>
+#include <dash/halo/HaloMatrixGroup.h>
+#include <dash/util/UnitLocality.h>
 
 #include <iostream>
 
@@ -1396,3 +1398,516 @@ TEST_F(HaloTest, HaloMatrixWrapperBigMultiStencil)
 
   dash::Team::All().barrier();
 }
+
+TEST_F(HaloTest, HaloMatrixGroup2D)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t      = StencilPoint<2>;
+  using StencilSpec_t   = StencilSpec<StencilP_t, 8>;
+
+  constexpr size_t num_fields = 3;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix_u(pattern);
+  Matrix_t matrix_v(pattern);
+  Matrix_t matrix_p(pattern);
+  std::vector<Matrix_t*> fields { &matrix_u, &matrix_v, &matrix_p };
+
+  auto init_fields = [&](long step) {
+    for(size_t f = 0; f < num_fields; ++f) {
+      auto& matrix = *fields[f];
+      const auto& offsets = matrix.local.offsets();
+      for(index_type i = 0; i < matrix.local.extent(0); ++i) {
+        for(index_type j = 0; j < matrix.local.extent(1); ++j) {
+          matrix.local[i][j] = (f + 1) * 1000000 + step * 100000 +
+                               (offsets[0] + i) * 1000 + offsets[1] + j;
+        }
+      }
+    }
+    dash::Team::All().barrier();
+  };
+  init_fields(0);
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-2, 0), StencilP_t(-1,-1), StencilP_t(-1, 1),
+      StencilP_t( 0,-2),                    StencilP_t( 0, 2),
+      StencilP_t( 1,-1), StencilP_t( 1, 1), StencilP_t( 2, 0));
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::CYCLIC);
+
+  HaloMatrixGroup<Matrix_t> halo_group(
+    bound_spec, stencil_spec, matrix_u, matrix_v, matrix_p);
+  EXPECT_EQ_U(num_fields, halo_group.num_fields());
+
+  // Reference: one halo wrapper per field
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_u(matrix_u, bound_spec, stencil_spec);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_v(matrix_v, bound_spec, stencil_spec);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_p(matrix_p, bound_spec, stencil_spec);
+  std::vector<HaloMatrixWrapper<Matrix_t>*> halo_wrappers {
+    &halo_wrapper_u, &halo_wrapper_v, &halo_wrapper_p };
+
+  for(long step = 0; step < 2; ++step) {
+    if(step > 0) {
+      init_fields(step);
+    }
+    halo_group.update_async();
+    halo_group.wait();
+    for(auto* halo_wrapper : halo_wrappers) {
+      halo_wrapper->update();
+    }
+    for(size_t f = 0; f < num_fields; ++f) {
+      const auto& halo_buffer_ref =
+        halo_wrappers[f]->halo_env().halo_memory().buffer();
+      const auto& halo_buffer = halo_group.halo_memory(f).buffer();
+      ASSERT_EQ_U(halo_buffer_ref.size(), halo_buffer.size());
+      for(size_t i = 0; i < halo_buffer.size(); ++i) {
+        EXPECT_EQ_U(halo_buffer_ref[i], halo_buffer[i]);
+      }
+    }
+    dash::Team::All().barrier();
+  }
+
+  // Stencil operator on a field of the group
+  auto stencil_op_v = halo_group.stencil_operator(1, stencil_spec);
+  auto stencil_op_v_ref = halo_wrapper_v.stencil_operator(stencil_spec);
+  auto it_ref = stencil_op_v_ref.boundary.begin();
+  auto it_bend = stencil_op_v.boundary.end();
+  for(auto it = stencil_op_v.boundary.begin(); it != it_bend; ++it, ++it_ref) {
+    for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i) {
+      EXPECT_EQ_U(it_ref.value_at(i), it.value_at(i));
+    }
+  }
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, HaloMatrixWrapperShared2D)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t      = StencilPoint<2>;
+  using StencilSpec_t   = StencilSpec<StencilP_t, 8>;
+  using HaloShared_t    = HaloMatrixWrapper<Matrix_t, SignalReady::OFF,
+                                            SharedHalos::ON>;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix(pattern);
+
+  auto init_matrix = [&](long step) {
+    const auto& offsets = matrix.local.offsets();
+    for(index_type i = 0; i < matrix.local.extent(0); ++i) {
+      for(index_type j = 0; j < matrix.local.extent(1); ++j) {
+        matrix.local[i][j] = step * 100000 + (offsets[0] + i) * 1000 +
+                             offsets[1] + j;
+      }
+    }
+    dash::Team::All().barrier();
+  };
+  init_matrix(0);
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-2, 0), StencilP_t(-1,-1), StencilP_t(-1, 1),
+      StencilP_t( 0,-2),                    StencilP_t( 0, 2),
+      StencilP_t( 1,-1), StencilP_t( 1, 1), StencilP_t( 2, 0));
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::CYCLIC);
+
+  HaloShared_t halo_wrapper(matrix, bound_spec, stencil_spec);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper_ref(matrix, bound_spec, stencil_spec);
+
+  // node-local neighbors are accessed in place, their boundary elements
+  // are not packed
+  auto is_node_local = [](dart_unit_t unit) {
+    dash::util::UnitLocality loc(dash::Team::All(), team_unit_t(unit));
+    return loc.host() == dash::util::UnitLocality().host();
+  };
+  const auto& env          = halo_wrapper.halo_env();
+  const auto& env_ref      = halo_wrapper_ref.halo_env();
+  const auto& halo_mem     = env.halo_memory();
+  const auto& halo_mem_ref = env_ref.halo_memory();
+  const auto& block_env    = halo_wrapper.halo_block().block_env();
+  int num_packed_ref = 0;
+  for(region_index_t r = 0; r < NumRegionsMax<2>; ++r) {
+    EXPECT_FALSE_U(halo_mem_ref.is_shared(r));
+    const auto* region = halo_wrapper.halo_block().halo_region(r);
+    if(region != nullptr && region->size() > 0) {
+      auto unit_from = region->begin().dart_gptr().unitid;
+      EXPECT_EQ_U(is_node_local(unit_from), halo_mem.is_shared(r));
+    }
+    auto unit_to = block_env.info(r).neighbor_id_to;
+    if(unit_to >= 0 && env_ref.needs_packing(r)) {
+      ++num_packed_ref;
+      EXPECT_EQ_U(!is_node_local(unit_to), env.needs_packing(r));
+    }
+  }
+  // column boundaries are not contiguous
+  EXPECT_GT_U(num_packed_ref, 0);
+
+  auto stencil_op     = halo_wrapper.stencil_operator(stencil_spec);
+  auto stencil_op_ref = halo_wrapper_ref.stencil_operator(stencil_spec);
+  for(long step = 0; step < 2; ++step) {
+    if(step > 0) {
+      init_matrix(step);
+    }
+    halo_wrapper.update();
+    halo_wrapper_ref.update();
+
+    auto it_ref  = stencil_op_ref.boundary.begin();
+    auto it_bend = stencil_op.boundary.end();
+    for(auto it = stencil_op.boundary.begin(); it != it_bend; ++it, ++it_ref) {
+      for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i) {
+        EXPECT_EQ_U(it_ref.value_at(i), it.value_at(i));
+      }
+    }
+
+    // halo elements of the upper left corner
+    for(index_type i = -2; i < 0; ++i) {
+      for(index_type j = -2; j < 0; ++j) {
+        auto offsets = matrix.local.offsets();
+        std::array<index_type, 2> coords {{ offsets[0] + i, offsets[1] + j }};
+        auto* halo_elem     = halo_wrapper.halo_element_at_global(coords);
+        auto* halo_elem_ref = halo_wrapper_ref.halo_element_at_global(coords);
+        ASSERT_EQ_U(halo_elem_ref == nullptr, halo_elem == nullptr);
+        if(halo_elem != nullptr) {
+          EXPECT_EQ_U(*halo_elem_ref, *halo_elem);
+        }
+      }
+    }
+    dash::Team::All().barrier();
+  }
+}
+
+TEST_F(HaloTest, BoundaryViewsAsymmetric2D)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t      = StencilPoint<2>;
+  using StencilSpec_t   = StencilSpec<StencilP_t, 5>;
+  using HaloWrapper_t   = HaloMatrixWrapper<Matrix_t>;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix(pattern);
+
+  // the corner regions are smaller than the boundary ring
+  StencilSpec_t stencil_spec(
+      StencilP_t(-2, 0), StencilP_t(-1, 1), StencilP_t( 0,-1),
+      StencilP_t( 0, 1), StencilP_t( 1, 0));
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::CYCLIC);
+
+  HaloWrapper_t halo_wrapper(matrix, bound_spec, stencil_spec);
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+
+  // inner and boundary views cover every local element exactly once
+  const auto& ext_local = matrix.local.extents();
+  std::vector<int> covered(ext_local[0] * ext_local[1], 0);
+  auto cover = [&](const ViewSpec<2, index_type>& view) {
+    for(index_type i = 0; i < view.extent(0); ++i) {
+      for(index_type j = 0; j < view.extent(1); ++j) {
+        ++covered[(view.offset(0) + i) * ext_local[1] + view.offset(1) + j];
+      }
+    }
+  };
+  cover(stencil_op.inner.view());
+  for(const auto& view : stencil_op.boundary.view()) {
+    cover(view);
+  }
+  for(auto count : covered) {
+    EXPECT_EQ_U(1, count);
+  }
+  EXPECT_EQ_U(matrix.local.size(),
+              stencil_op.inner.view().size() +
+              stencil_op.boundary.boundary_size());
+}
+
+TEST_F(HaloTest, CustomHalosGlobalCoords2D)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t      = StencilPoint<2>;
+  using StencilSpec_t   = StencilSpec<StencilP_t, 4>;
+  using HaloWrapper_t   = HaloMatrixWrapper<Matrix_t>;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix(pattern);
+  dash::fill(matrix.begin(), matrix.end(), 0);
+  dash::Team::All().barrier();
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1, 0), StencilP_t( 0,-1), StencilP_t( 0, 1),
+      StencilP_t( 1, 0));
+  GlobBoundSpec_t bound_spec(BoundaryProp::CUSTOM, BoundaryProp::CUSTOM);
+
+  HaloWrapper_t halo_wrapper(matrix, bound_spec, stencil_spec);
+  auto custom_halo = [](const std::array<dash::default_index_t,2>& coords) {
+    return static_cast<long>(coords[0] * 1000 + coords[1]);
+  };
+  halo_wrapper.set_custom_halos(custom_halo);
+  halo_wrapper.update();
+
+  // halo elements behind the global borders on both sides
+  const auto& offsets   = matrix.local.offsets();
+  const auto& ext_local = matrix.local.extents();
+  for(dim_t d = 0; d < 2; ++d) {
+    for(index_type g : { index_type(-1), index_type(ext_per_dim) }) {
+      for(index_type k = 0; k < ext_local[1 - d]; ++k) {
+        std::array<index_type, 2> coords;
+        coords[d]     = g;
+        coords[1 - d] = offsets[1 - d] + k;
+        auto* halo_elem = halo_wrapper.halo_element_at_global(coords);
+        bool at_border = (g < 0) ? offsets[d] == 0
+                                 : offsets[d] + ext_local[d] == ext_per_dim;
+        ASSERT_EQ_U(at_border, halo_elem != nullptr);
+        if(halo_elem != nullptr) {
+          EXPECT_EQ_U(custom_halo({{ coords[0], coords[1] }}), *halo_elem);
+        }
+      }
+    }
+  }
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, TemporalStencilOperator2D)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+  using StencilP_t      = StencilPoint<2>;
+  using StencilSpec_t   = StencilSpec<StencilP_t, 5>;
+  using HaloWrapper_t   = HaloMatrixWrapper<Matrix_t>;
+
+  constexpr int num_steps  = 3;
+  constexpr int num_rounds = 2;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim,ext_per_dim), dist_spec, team_spec, dash::Team::All());
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-2, 0), StencilP_t(-1, 1), StencilP_t( 0,-1),
+      StencilP_t( 0, 1), StencilP_t( 1, 0));
+
+  // custom halo values have to be periodic in the cyclic dimension 0
+  auto custom_halo = [&](const std::array<dash::default_index_t,2>& coords) {
+    long ext = ext_per_dim;
+    return 7 * ((coords[0] + ext) % ext) + 3 * coords[1] + 500;
+  };
+  auto op = [&](long* center, long* center_dst, index_type offset,
+                const std::array<index_type, 5>& offsets) {
+    long value = 2 * *center;
+    for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i) {
+      value += (i + 1) * center[offsets[i]];
+    }
+    *center_dst = value % 1000003;
+  };
+  auto op_bnd = [&](auto it) {
+    long value = 2 * *it;
+    for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i) {
+      value += (i + 1) * it.value_at(i);
+    }
+    return value % 1000003;
+  };
+
+  std::array<GlobBoundSpec_t, 2> bound_specs {{
+    GlobBoundSpec_t(BoundaryProp::NONE, BoundaryProp::NONE),
+    GlobBoundSpec_t(BoundaryProp::CYCLIC, BoundaryProp::CUSTOM) }};
+  for(const auto& bound_spec : bound_specs) {
+    Matrix_t matrix_a(pattern);
+    Matrix_t matrix_b(pattern);
+    Matrix_t matrix_t(pattern);
+    for(auto* matrix : { &matrix_a, &matrix_b, &matrix_t }) {
+      const auto& offsets = matrix->local.offsets();
+      for(index_type i = 0; i < matrix->local.extent(0); ++i) {
+        for(index_type j = 0; j < matrix->local.extent(1); ++j) {
+          matrix->local[i][j] = (offsets[0] + i) * 1000 + offsets[1] + j;
+        }
+      }
+    }
+    dash::Team::All().barrier();
+
+    // Reference: one halo update per step
+    HaloWrapper_t halo_wrapper_a(matrix_a, bound_spec, stencil_spec);
+    HaloWrapper_t halo_wrapper_b(matrix_b, bound_spec, stencil_spec);
+    halo_wrapper_a.set_custom_halos(custom_halo);
+    halo_wrapper_b.set_custom_halos(custom_halo);
+    auto stencil_op_a = halo_wrapper_a.stencil_operator(stencil_spec);
+    auto stencil_op_b = halo_wrapper_b.stencil_operator(stencil_spec);
+    auto* current_halo = &halo_wrapper_a;
+    auto* new_halo     = &halo_wrapper_b;
+    auto* current_op   = &stencil_op_a;
+    auto* new_op       = &stencil_op_b;
+
+    // Temporal blocking: one halo update per num_steps steps
+    HaloWrapper_t halo_wrapper_t(matrix_t, bound_spec,
+                                 temporal_halo_spec(stencil_spec, num_steps));
+    halo_wrapper_t.set_custom_halos(custom_halo);
+    auto stencil_op_t =
+      halo_wrapper_t.temporal_stencil_operator(stencil_spec, num_steps);
+    EXPECT_EQ_U(num_steps, stencil_op_t.num_steps());
+
+    for(auto round = 0; round < num_rounds; ++round) {
+      for(auto step = 0; step < num_steps; ++step) {
+        current_halo->update();
+        auto* new_begin = new_halo->matrix().lbegin();
+        current_op->inner.update(new_begin, op);
+        current_op->boundary.update(new_begin, op_bnd);
+        std::swap(current_halo, new_halo);
+        std::swap(current_op, new_op);
+        dash::Team::All().barrier();
+      }
+
+      halo_wrapper_t.update();
+      // results are written in place, neighbors have to finish their update
+      dash::Team::All().barrier();
+      if(round % 2 == 0) {
+        stencil_op_t.update(matrix_t.lbegin(), op);
+      } else {
+        // separate destination, elements not updated have to be copied
+        std::vector<long> result(matrix_t.local.size(), -1);
+        stencil_op_t.update(result.data(), op);
+        std::copy(result.begin(), result.end(), matrix_t.lbegin());
+      }
+      dash::Team::All().barrier();
+
+      const auto& matrix_ref = current_halo->matrix();
+      for(index_type i = 0; i < matrix_t.local.extent(0); ++i) {
+        for(index_type j = 0; j < matrix_t.local.extent(1); ++j) {
+          EXPECT_EQ_U(static_cast<long>(matrix_ref.local[i][j]),
+                      static_cast<long>(matrix_t.local[i][j]));
+        }
+      }
+      dash::Team::All().barrier();
+    }
+  }
+}
+
+TEST_F(HaloTest, StencilOperatorInnerRows3D)
+{
+  using Pattern_t  = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<double, 3, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+
+  using StencilP_t    = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 6>;
+  using HaloWrapper_t = HaloMatrixWrapper<Matrix_t>;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext_per_dim, ext_per_dim, ext_per_dim),
+                    dist_spec, team_spec, dash::Team::All());
+
+  Matrix_t matrix(pattern);
+  Matrix_t matrix_ref(pattern);
+  Matrix_t matrix_rows(pattern);
+  Matrix_t matrix_tiled(pattern);
+  for(auto l = 0; l < matrix.local.size(); ++l) {
+    matrix.lbegin()[l] = (dash::myid() * 37 + l * 11) % 101;
+  }
+  dash::fill(matrix_ref.begin(), matrix_ref.end(), -1.0);
+  dash::fill(matrix_rows.begin(), matrix_rows.end(), -1.0);
+  dash::fill(matrix_tiled.begin(), matrix_tiled.end(), -1.0);
+  dash::Team::All().barrier();
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(0.5, -1, 0, 0), StencilP_t(0.25, 1, 0, 0),
+      StencilP_t(-1.0, 0, -2, 0), StencilP_t(2.0, 0, 1, 0),
+      StencilP_t(0.125, 0, 0, -1), StencilP_t(4.0, 0, 0, 1));
+  const double coefficient_center = -3.0;
+
+  HaloWrapper_t halo_wrapper(matrix, stencil_spec);
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+
+  stencil_op.inner.update(matrix_ref.lbegin(),
+    [&](auto* center, auto* center_dst, auto offset, const auto& offsets) {
+      double value = coefficient_center * *center;
+      for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i) {
+        value += stencil_spec[i].coefficient() * center[offsets[i]];
+      }
+      *center_dst = value;
+    });
+
+  std::size_t num_rows = 0;
+  stencil_op.inner.update_rows(matrix_rows.lbegin(),
+    [&](const double* center, double* center_dst, index_type num_elems,
+        const std::array<index_type, 6>& offsets) {
+      ++num_rows;
+      for(index_type j = 0; j < num_elems; ++j) {
+        double value = coefficient_center * center[j];
+        for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i) {
+          value += stencil_spec[i].coefficient() * center[j + offsets[i]];
+        }
+        center_dst[j] = value;
+      }
+    });
+
+  const auto& view_inner = stencil_op.inner.view();
+  if(view_inner.size() > 0) {
+    EXPECT_EQ_U(view_inner.size() / view_inner.extent(2), num_rows);
+  }
+
+  stencil_op.inner.update_weighted(matrix_tiled.lbegin(), coefficient_center,
+                                   {{3, 7, 0}});
+
+  for(auto l = 0; l < matrix.local.size(); ++l) {
+    EXPECT_EQ_U(matrix_ref.lbegin()[l], matrix_rows.lbegin()[l]);
+    EXPECT_EQ_U(matrix_ref.lbegin()[l], matrix_tiled.lbegin()[l]);
+  }
+
+  // untiled weighted update
+  dash::fill(matrix_tiled.begin(), matrix_tiled.end(), -1.0);
+  dash::Team::All().barrier();
+  stencil_op.inner.update_weighted(matrix_tiled.lbegin(), coefficient_center);
+  for(auto l = 0; l < matrix.local.size(); ++l) {
+    EXPECT_EQ_U(matrix_ref.lbegin()[l], matrix_tiled.lbegin()[l]);
+  }
+
+  dash::Team::All().barrier();
+}
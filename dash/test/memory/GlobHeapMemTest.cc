@@ -614,3 +614,77 @@ TEST_F(GlobHeapMemTest, Unbalanced_ShrinkAttachedBucket)
 
   EXPECT_EQ_U(gdmem.size(), (dash::size() - 1) * initial_local_capacity + unit_0_lsize_diff);
 }
+
+TEST_F(GlobHeapMemTest, RandomAccessManyBuckets)
+{
+  typedef int value_t;
+
+  auto nunits = dash::size();
+  auto myid   = dash::myid();
+  int  rounds = 6;
+
+  // Units attach differing numbers of buckets in every commit, including
+  // empty buckets and units without any local elements:
+  auto num_buckets = [](int unit, int round) { return (unit + round) % 3; };
+  auto bucket_size = [](int unit, int round, int bucket) {
+                       return (unit * 3 + round + bucket) % 5;
+                     };
+
+  dash::GlobHeapMem<value_t> gdmem(0);
+  std::vector<size_t> nlocal(nunits, 0);
+  for (int r = 0; r < rounds; ++r) {
+    for (int u = 0; u < static_cast<int>(nunits); ++u) {
+      for (int b = 0; b < num_buckets(u, r); ++b) {
+        size_t bsize = bucket_size(u, r, b);
+        if (u == myid) {
+          size_t lsize_old = gdmem.local_size();
+          gdmem.grow(bsize);
+          auto lbegin = gdmem.lbegin();
+          for (size_t li = lsize_old; li < lsize_old + bsize; ++li) {
+            *(lbegin + li) = 1000 * u + li;
+          }
+        }
+        nlocal[u] += bsize;
+      }
+    }
+    gdmem.commit();
+  }
+  size_t gsize = std::accumulate(nlocal.begin(), nlocal.end(), 0);
+  EXPECT_EQ_U(gsize, gdmem.size());
+
+  // Expected value at every global index:
+  std::vector<value_t> expected;
+  for (size_t u = 0; u < nunits; ++u) {
+    EXPECT_EQ_U(nlocal[u], gdmem.local_size(dash::team_unit_t(u)));
+    for (size_t li = 0; li < nlocal[u]; ++li) {
+      expected.push_back(1000 * u + li);
+    }
+  }
+
+  // Random access from global index, forward and backward:
+  auto gbegin = gdmem.begin();
+  auto glast  = gdmem.begin() + (gsize - 1);
+  for (size_t i = 0; i < gsize; ++i) {
+    size_t  gidx = (i * 7 + myid) % gsize;
+    value_t actual;
+    dash::get_value(&actual, gbegin + gidx);
+    EXPECT_EQ_U(expected[gidx], actual);
+    dash::get_value(&actual, glast - (gsize - 1 - gidx));
+    EXPECT_EQ_U(expected[gidx], actual);
+    auto git = dash::GlobHeapMem<value_t>::pointer(&gdmem, gidx);
+    EXPECT_EQ_U(gidx, git.pos());
+  }
+
+  // Access from unit and local offset:
+  for (dash::team_unit_t u{0}; u < nunits; ++u) {
+    size_t goffs = std::accumulate(nlocal.begin(), nlocal.begin() + u, 0);
+    for (size_t li = 0; li < nlocal[u]; ++li) {
+      auto    gptr = gdmem.at(u, li);
+      value_t actual;
+      dash::get_value(&actual, gptr);
+      EXPECT_EQ_U(expected[goffs + li], actual);
+      EXPECT_EQ_U(goffs + li, gptr.pos());
+    }
+  }
+  dash::barrier();
+}
@@ -0,0 +1,253 @@
+#include "SFCTilePatternTest.h"
+
+#include <dash/pattern/SFCTilePattern.h>
+#include <dash/pattern/BlockPattern.h>
+#include <dash/pattern/TilePattern.h>
+
+#include <dash/util/PatternMetrics.h>
+
+#include <dash/algorithm/Copy.h>
+
+#include <dash/Matrix.h>
+#include <dash/Dimensional.h>
+#include <dash/TeamSpec.h>
+
+#include <cstdlib>
+#include <vector>
+
+
+namespace {
+
+/**
+ * Validates that local and global index mappings of the pattern are
+ * inverse to each other and that every unit is mapped to a contiguous,
+ * balanced segment of the curve.
+ */
+template <class PatternT>
+void check_mapping(const PatternT & pattern)
+{
+  typedef typename PatternT::index_type index_t;
+
+  auto nunits  = pattern.num_units();
+  auto nblocks = pattern.blockspec().size();
+
+  size_t total_size = 0;
+  for (dash::team_unit_t unit{0}; unit < nunits; ++unit) {
+    auto l_blocks = pattern.local_blockspec(unit).size();
+    EXPECT_LE_U(nblocks / nunits, l_blocks);
+    EXPECT_GE_U((nblocks + nunits - 1) / nunits, l_blocks);
+    EXPECT_EQ_U(l_blocks * pattern.max_blocksize(),
+                pattern.local_size(unit));
+    total_size += pattern.local_size(unit);
+
+    for (size_t lb = 0; lb < l_blocks; ++lb) {
+      auto block   = pattern.local_block(unit, lb);
+      auto g_block = pattern.block_at(block.offsets());
+      EXPECT_EQ_U(unit, pattern.unit_at(block.offsets()));
+      if (lb > 0) {
+        auto prev = pattern.block_at(pattern.local_block(unit, lb-1)
+                                            .offsets());
+        EXPECT_EQ_U(pattern.block_curve_pos(prev) + 1,
+                    pattern.block_curve_pos(g_block));
+      }
+    }
+  }
+  EXPECT_EQ_U(pattern.size(), total_size);
+
+  for (index_t g = 0; g < pattern.size(); ++g) {
+    auto g_coords = pattern.coords(g);
+    auto l_pos    = pattern.local_index(g_coords);
+    auto l_coords = pattern.local(g_coords);
+    EXPECT_EQ_U(l_pos.unit, l_coords.unit);
+    EXPECT_EQ_U(l_pos.unit, pattern.unit_at(g_coords));
+    EXPECT_EQ_U(g_coords, pattern.global(l_pos.unit, l_coords.coords));
+    if (l_pos.unit == pattern.team().myid()) {
+      EXPECT_EQ_U(l_pos.index, pattern.local_at(l_coords.coords));
+      EXPECT_EQ_U(g, pattern.global(l_pos.index));
+    }
+  }
+}
+
+} // namespace
+
+TEST_F(SFCTilePatternTest, Distribute2DimHilbert)
+{
+  typedef dash::SFCTilePattern<2, dash::SFCurve::HILBERT> pattern_t;
+
+  // Block grid with power-of-two extents:
+  size_t block_rows = 3;
+  size_t block_cols = 2;
+  pattern_t pattern(dash::SizeSpec<2>(8 * block_rows, 8 * block_cols),
+                    dash::DistributionSpec<2>(dash::TILE(block_rows),
+                                              dash::TILE(block_cols)));
+  check_mapping(pattern);
+
+  // Consecutive blocks on the Hilbert curve are adjacent:
+  auto nblocks = pattern.blockspec().size();
+  std::vector<int> curve_blocks(nblocks);
+  for (size_t b = 0; b < nblocks; ++b) {
+    curve_blocks[pattern.block_curve_pos(b)] = b;
+  }
+  for (size_t pos = 1; pos < nblocks; ++pos) {
+    auto prev = pattern.blockspec().coords(curve_blocks[pos-1]);
+    auto curr = pattern.blockspec().coords(curve_blocks[pos]);
+    auto dist = std::abs(static_cast<int>(prev[0]) -
+                         static_cast<int>(curr[0])) +
+                std::abs(static_cast<int>(prev[1]) -
+                         static_cast<int>(curr[1]));
+    EXPECT_EQ_U(1, dist);
+  }
+}
+
+TEST_F(SFCTilePatternTest, Distribute3DimMorton)
+{
+  typedef dash::SFCTilePattern<3, dash::SFCurve::MORTON> pattern_t;
+
+  // Block grid with non-power-of-two extents:
+  pattern_t pattern(dash::SizeSpec<3>(5 * 2, 3 * 3, 6 * 2),
+                    dash::DistributionSpec<3>(dash::TILE(2),
+                                              dash::TILE(3),
+                                              dash::TILE(2)));
+  check_mapping(pattern);
+
+  typedef dash::SFCTilePattern<3, dash::SFCurve::HILBERT> hilbert_t;
+  hilbert_t hilbert(dash::SizeSpec<3>(5 * 2, 3 * 3, 6 * 2),
+                    dash::DistributionSpec<3>(dash::TILE(2),
+                                              dash::TILE(3),
+                                              dash::TILE(2)));
+  check_mapping(hilbert);
+}
+
+TEST_F(SFCTilePatternTest, MatrixAccess)
+{
+  typedef dash::SFCTilePattern<2>                               pattern_t;
+  typedef dash::Matrix<int, 2, dash::default_index_t, pattern_t> matrix_t;
+
+  size_t tilesize = 3;
+  size_t extent_y = tilesize * (dash::size() + 2);
+  size_t extent_x = tilesize * 5;
+  matrix_t matrix(dash::SizeSpec<2>(extent_y, extent_x),
+                  dash::DistributionSpec<2>(dash::TILE(tilesize),
+                                            dash::TILE(tilesize)));
+  const auto & pattern = matrix.pattern();
+
+  // Local tiles are contiguous in local memory:
+  for (size_t lb = 0; lb < matrix.local.num_blocks(); ++lb) {
+    auto block = pattern.local_block(lb);
+    int * tile = matrix.local.block_lbegin(lb);
+    for (size_t i = 0; i < tilesize; ++i) {
+      for (size_t j = 0; j < tilesize; ++j) {
+        tile[i * tilesize + j] = (block.offset(0) + i) * extent_x +
+                                 block.offset(1) + j;
+      }
+    }
+  }
+  matrix.barrier();
+
+  if (dash::myid() == 0) {
+    for (size_t i = 0; i < extent_y; ++i) {
+      for (size_t j = 0; j < extent_x; ++j) {
+        int value = matrix(i, j);
+        EXPECT_EQ_U(static_cast<int>(i * extent_x + j), value);
+      }
+    }
+  }
+
+  // Copy a range in global block order spanning tiles of several units:
+  size_t tile_elems = tilesize * tilesize;
+  size_t copy_begin = tile_elems + 2;
+  size_t copy_end   = matrix.size() - tile_elems - 1;
+  std::vector<int> buffer(copy_end - copy_begin);
+  dash::copy(matrix.begin() + copy_begin,
+             matrix.begin() + copy_end,
+             buffer.data());
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    auto coords = pattern.coords(copy_begin + i);
+    EXPECT_EQ_U(static_cast<int>(coords[0] * extent_x + coords[1]),
+                buffer[i]);
+  }
+  matrix.barrier();
+}
+
+TEST_F(SFCTilePatternTest, Metrics)
+{
+  typedef dash::SFCTilePattern<2> sfc_pattern_t;
+  typedef dash::TilePattern<2>    tile_pattern_t;
+  typedef dash::Pattern<2>        block_pattern_t;
+
+  dash::TeamSpec<2> teamspec;
+  teamspec.balance_extents();
+  auto nunits = teamspec.size();
+
+  size_t tilesize = 2;
+  size_t nblocks  = 16;
+  dash::SizeSpec<2>         sizespec(nblocks * tilesize, nblocks * tilesize);
+  dash::DistributionSpec<2> distspec(dash::TILE(tilesize),
+                                     dash::TILE(tilesize));
+
+  sfc_pattern_t   sfc_pattern(sizespec, distspec, teamspec);
+  tile_pattern_t  tile_pattern(sizespec, distspec, teamspec);
+  block_pattern_t block_pattern(sizespec,
+                                dash::DistributionSpec<2>(
+                                  dash::BLOCKED, dash::BLOCKED),
+                                teamspec);
+
+  dash::util::PatternMetrics<sfc_pattern_t>   sfc_metrics(sfc_pattern);
+  dash::util::PatternMetrics<tile_pattern_t>  tile_metrics(tile_pattern);
+  dash::util::PatternMetrics<block_pattern_t> block_metrics(block_pattern);
+
+  LOG_MESSAGE("SFCTilePattern: neighbors: %d, comm volume: %d (max: %d)",
+              sfc_metrics.max_neighbors_per_unit(),
+              sfc_metrics.comm_volume(),
+              sfc_metrics.max_comm_volume_per_unit());
+  LOG_MESSAGE("TilePattern:    neighbors: %d, comm volume: %d (max: %d)",
+              tile_metrics.max_neighbors_per_unit(),
+              tile_metrics.comm_volume(),
+              tile_metrics.max_comm_volume_per_unit());
+  LOG_MESSAGE("Pattern:        neighbors: %d, comm volume: %d (max: %d)",
+              block_metrics.max_neighbors_per_unit(),
+              block_metrics.comm_volume(),
+              block_metrics.max_comm_volume_per_unit());
+
+  EXPECT_LE_U(sfc_metrics.max_blocks_per_unit(),
+              sfc_metrics.min_blocks_per_unit() + 1);
+  if (nunits == 1) {
+    EXPECT_EQ_U(0, sfc_metrics.comm_volume());
+    EXPECT_EQ_U(0, sfc_metrics.max_neighbors_per_unit());
+    return;
+  }
+  // Units are mapped to compact regions instead of cyclic tiles, which
+  // reduces the communication volume as long as every unit is assigned
+  // several tiles. Cyclic tiles only border units adjacent in the team
+  // spec, so neighbor counts are compared to the blocked distribution:
+  ASSERT_LE_U(2 * nunits, nblocks * nblocks);
+  EXPECT_LT_U(sfc_metrics.comm_volume(), tile_metrics.comm_volume());
+  EXPECT_LT_U(sfc_metrics.max_comm_volume_per_unit(),
+              tile_metrics.max_comm_volume_per_unit());
+  // Compact curve segments stay close to the rectangular blocks of the
+  // blocked distribution:
+  EXPECT_LE_U(sfc_metrics.comm_volume(), 2 * block_metrics.comm_volume());
+  EXPECT_LE_U(sfc_metrics.max_comm_volume_per_unit(),
+              2 * block_metrics.max_comm_volume_per_unit());
+  EXPECT_LE_U(sfc_metrics.max_neighbors_per_unit(),
+              2 * block_metrics.max_neighbors_per_unit());
+  for (dash::team_unit_t unit{0}; unit < nunits; ++unit) {
+    EXPECT_GT_U(sfc_metrics.unit_comm_volume(unit), 0);
+    EXPECT_LE_U(sfc_metrics.unit_neighbors(unit),
+                sfc_metrics.max_neighbors_per_unit());
+  }
+}
+
+TEST_F(SFCTilePatternTest, TeamSpecSizeMismatch)
+{
+  typedef dash::SFCTilePattern<2> pattern_t;
+
+  size_t tilesize = 2;
+  size_t nblocks  = 4 * dash::size();
+  dash::SizeSpec<2>         sizespec(nblocks * tilesize, tilesize);
+  dash::DistributionSpec<2> distspec(dash::TILE(tilesize),
+                                     dash::TILE(tilesize));
+  EXPECT_THROW(
+    pattern_t(sizespec, distspec, dash::TeamSpec<2>(dash::size() + 1, 1)),
+    dash::exception::InvalidArgument);
+}
@@ -0,0 +1,22 @@
+#ifndef DASH__TEST__SFC_TILE_PATTERN_TEST_H_
+#define DASH__TEST__SFC_TILE_PATTERN_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for class dash::SFCTilePattern
+ */
+class SFCTilePatternTest : public dash::test::TestBase {
+protected:
+
+  SFCTilePatternTest() {
+    LOG_MESSAGE(">>> Test suite: SFCTilePatternTest");
+  }
+
+  virtual ~SFCTilePatternTest() {
+    LOG_MESSAGE("<<< Closing test suite: SFCTilePatternTest");
+  }
+
+};
+
+#endif // DASH__TEST__SFC_TILE_PATTERN_TEST_H_